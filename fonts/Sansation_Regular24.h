@@ -0,0 +1,1142 @@
+/* The font vlw file can be converted to a byte array using:
+
+   https://tomeko.net/online_tools/file_to_hex.php?lang=en
+
+   Paste the byte array into a sketch tab and add two lines
+   at the start with a unique font name:
+
+                const uint8_t  fontName[] PROGMEM = {
+
+   At the end add:
+
+        };
+
+   See example below. Include the tab in the main sketch, e.g.:
+
+        #include "NotoSansBold15.h"
+*/
+
+
+const uint8_t  SansationRegular24[] PROGMEM = {
+0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xE8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x30,
+0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x14,
+0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
+0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x03,
+0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x15,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x14,
+0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06,
+0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x14,
+0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xB4,
+0x1C, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF,
+0xE5, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x81, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xDD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFE, 0xF9, 0x0C, 0x00, 0x00, 0x00,
+0x8E, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x3E, 0xB4, 0xB4, 0xB4,
+0xB4, 0xED, 0xFF, 0xD0, 0xB4, 0xB4, 0xB4, 0xC3, 0xFF, 0xF9, 0xB4, 0xB4, 0xB4, 0xB4, 0x83, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xC5, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xF8, 0x06, 0x00, 0x00, 0x00, 0x95,
+0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xC4, 0x00,
+0x00, 0x00, 0x00, 0xD0, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x96, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61,
+0xB4, 0xB4, 0xB4, 0xB4, 0xEB, 0xFF, 0xD1, 0xB4, 0xB4, 0xB4, 0xC2, 0xFF, 0xFB, 0xB4, 0xB4, 0xB4,
+0xB4, 0x60, 0x00, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xC1, 0x00, 0x00,
+0x00, 0x00, 0xD2, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1,
+0xFF, 0x7D, 0x00, 0x00, 0x00, 0x16, 0xFE, 0xFA, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xE3, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xF1, 0x04, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x81,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x04, 0x72, 0xD1, 0xF0, 0xFF,
+0xFF, 0xFF, 0xF2, 0xC7, 0x55, 0x86, 0xFF, 0xFF, 0xCE, 0xA0, 0x97, 0xAC, 0xC9, 0xFA, 0x88, 0xE2,
+0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x1D, 0xF1, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xC3, 0xFF, 0xA1, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF7, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF5, 0xCD, 0x6A, 0x01, 0x00, 0x1D, 0x80, 0xA4, 0xB4, 0xB4, 0xCD, 0xFF, 0xFF,
+0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x39, 0xFF, 0xF5, 0x50, 0x73, 0x39, 0x1B, 0x07, 0x0B, 0x37, 0xC2, 0xFF, 0xC1, 0x80,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2A, 0x1B, 0x65, 0x95, 0xAB, 0xFF, 0xFF, 0x9E,
+0x57, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x12, 0x99, 0xE2, 0xF8, 0xDF, 0x88, 0x06, 0x00, 0x00,
+0x00, 0x00, 0x37, 0xFA, 0xFF, 0x75, 0xAA, 0xFC, 0x45, 0x09, 0x65, 0xFF, 0x82, 0x00, 0x00, 0x00,
+0x13, 0xE1, 0xFF, 0xB2, 0x01, 0xEF, 0xE1, 0x00, 0x00, 0x09, 0xFF, 0xC7, 0x00, 0x00, 0x01, 0xB6,
+0xFF, 0xDF, 0x11, 0x00, 0xE4, 0xFC, 0x46, 0x08, 0x66, 0xFF, 0xBB, 0x00, 0x00, 0x7B, 0xFF, 0xF8,
+0x34, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0x00, 0x41, 0xFC, 0xFF, 0x69, 0x00,
+0x00, 0x00, 0x00, 0x4F, 0x98, 0xAC, 0x94, 0x3E, 0x00, 0x18, 0xE8, 0xFF, 0xA6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xD7, 0x0C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xF5, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4B, 0xFE, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1F, 0xED, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x06, 0xC9, 0xFF, 0xCF, 0x08, 0x13, 0x9F, 0xED, 0xFF, 0xE8, 0x8C, 0x06, 0x00, 0x00, 0x00, 0x93,
+0xFF, 0xF1, 0x24, 0x00, 0xA5, 0xFF, 0x91, 0x47, 0xAB, 0xFF, 0x7D, 0x00, 0x00, 0x56, 0xFF, 0xFF,
+0x52, 0x00, 0x00, 0xEC, 0xEC, 0x01, 0x00, 0x17, 0xFF, 0xC3, 0x00, 0x26, 0xF2, 0xFF, 0x8E, 0x00,
+0x00, 0x00, 0xEB, 0xE4, 0x00, 0x00, 0x0C, 0xFF, 0xC2, 0x09, 0xD2, 0xFF, 0xC6, 0x05, 0x00, 0x00,
+0x00, 0xA0, 0xFF, 0x57, 0x0A, 0x7A, 0xFF, 0x78, 0x9F, 0xFF, 0xEC, 0x1D, 0x00, 0x00, 0x00, 0x00,
+0x0F, 0x95, 0xE3, 0xF8, 0xDD, 0x81, 0x04, 0x00, 0x08, 0x6B, 0xBB, 0xE6, 0xF8, 0xF8, 0xE7, 0xCC,
+0x9A, 0x29, 0x00, 0x00, 0x00, 0x17, 0xD6, 0xFF, 0xFF, 0xE1, 0xC4, 0xBA, 0xCA, 0xE4, 0xFF, 0x58,
+0x00, 0x00, 0x00, 0xA0, 0xFF, 0xE2, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x13, 0x00, 0x00,
+0x00, 0xEB, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x6E,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x73, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xF0, 0x60, 0x16,
+0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xB3, 0xFF, 0xF8, 0xCD, 0xB4, 0xB4, 0xB4, 0xB4,
+0xBF, 0xFF, 0xFF, 0xB4, 0xB4, 0x88, 0xFF, 0xD5, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x00, 0x00, 0xDF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFD, 0x00,
+0x00, 0xF9, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xEB, 0x00, 0x00, 0xE6,
+0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xB7, 0x00, 0x00, 0x99, 0xFF, 0xE8,
+0x3C, 0x00, 0x00, 0x00, 0x09, 0x7A, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x15, 0xD5, 0xFF, 0xFF, 0xE4,
+0xC8, 0xCC, 0xF5, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0xC1, 0xEB, 0xFB, 0xF6,
+0xDD, 0xA5, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x02, 0xDE, 0xFF, 0x4A, 0x00, 0x49, 0xFF, 0xDF, 0x02,
+0x00, 0xAD, 0xFF, 0x7C, 0x00, 0x07, 0xF4, 0xFF, 0x2D, 0x00, 0x46, 0xFF, 0xE2, 0x00, 0x00, 0x82,
+0xFF, 0xA6, 0x00, 0x00, 0xAF, 0xFF, 0x79, 0x00, 0x00, 0xD7, 0xFF, 0x50, 0x00, 0x00, 0xEA, 0xFF,
+0x3D, 0x00, 0x00, 0xF9, 0xFF, 0x2F, 0x00, 0x00, 0xF9, 0xFF, 0x2E, 0x00, 0x00, 0xEA, 0xFF, 0x3D,
+0x00, 0x00, 0xD7, 0xFF, 0x50, 0x00, 0x00, 0xAE, 0xFF, 0x79, 0x00, 0x00, 0x81, 0xFF, 0xA7, 0x00,
+0x00, 0x46, 0xFF, 0xE2, 0x00, 0x00, 0x07, 0xF4, 0xFF, 0x2D, 0x00, 0x00, 0xAD, 0xFF, 0x7C, 0x00,
+0x00, 0x49, 0xFF, 0xDF, 0x02, 0x00, 0x02, 0xDE, 0xFF, 0x4B, 0x25, 0xFE, 0xF6, 0x11, 0x00, 0x00,
+0x00, 0xBB, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x0D, 0xF9, 0xFF,
+0x22, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA9, 0x00, 0x00, 0x00,
+0x53, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFB, 0x02, 0x00, 0x00, 0x17, 0xFF, 0xFF, 0x10,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x17, 0xFF,
+0xFF, 0x10, 0x00, 0x00, 0x2A, 0xFF, 0xFB, 0x02, 0x00, 0x00, 0x53, 0xFF, 0xD5, 0x00, 0x00, 0x00,
+0x80, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x6D, 0x00, 0x00, 0x0D, 0xF9, 0xFF, 0x22, 0x00,
+0x00, 0x56, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0x6F, 0x00, 0x00, 0x24, 0xFE, 0xF6, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x17, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x2A, 0x28, 0x00, 0xF3, 0x79, 0x06,
+0x4C, 0x00, 0x9A, 0xFE, 0xAD, 0xE7, 0xB3, 0xE3, 0xFE, 0x1B, 0x36, 0x6D, 0xB2, 0xFF, 0xED, 0x81,
+0x53, 0x0F, 0x00, 0x16, 0xD6, 0xC0, 0xFA, 0x77, 0x00, 0x00, 0x00, 0xBA, 0xF7, 0x1F, 0x92, 0xFF,
+0x3F, 0x00, 0x00, 0x14, 0x54, 0x00, 0x13, 0x58, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB4, 0xBF, 0xFF, 0xFF, 0xB4, 0xB4, 0xB4, 0xB4,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xF9, 0x11,
+0x00, 0x7B, 0xFF, 0xB1, 0x00, 0x00, 0xD4, 0xFF, 0x57, 0x00, 0x2E, 0xFF, 0xF3, 0x0A, 0x00, 0x87,
+0xFF, 0xA4, 0x00, 0x00, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xB4, 0xB4, 0x1C, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF,
+0xE3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xEF, 0xFF, 0x64, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xD8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1A, 0xF6, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xCC, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFB, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xA9, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFE,
+0xFF, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xAD, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFC, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xC7, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xF8, 0x1E,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD5, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x61, 0xFF, 0xF2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1,
+0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xEA, 0x0D, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x9E, 0xDA, 0xF3, 0xF8, 0xE3, 0xAE,
+0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9B, 0xFF, 0xFF, 0xEC, 0xC2, 0xBC, 0xDF, 0xFF, 0xFF,
+0xC0, 0x11, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xF2, 0x5B, 0x02, 0x00, 0x00, 0x00, 0x3D, 0xDE, 0xFF,
+0xBA, 0x00, 0x00, 0x25, 0xFE, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xF5, 0xFF,
+0x4E, 0x00, 0x86, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xAE,
+0x00, 0xC2, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xE8, 0x00,
+0xE8, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x0F, 0xF8,
+0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1F, 0xF9, 0xFF,
+0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x20, 0xEA, 0xFF, 0x40,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x10, 0xC4, 0xFF, 0x6D, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0xEB, 0x00, 0x89, 0xFF, 0xBE, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xB1, 0x00, 0x28, 0xFE, 0xFF, 0x4A, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x24, 0xF6, 0xFF, 0x51, 0x00, 0x00, 0x92, 0xFF, 0xF3, 0x5D, 0x03, 0x00,
+0x00, 0x00, 0x3E, 0xDF, 0xFF, 0xBE, 0x01, 0x00, 0x00, 0x05, 0x9F, 0xFF, 0xFF, 0xED, 0xC1, 0xBB,
+0xE0, 0xFF, 0xFF, 0xC4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xA1, 0xDC, 0xF4, 0xF8, 0xE5,
+0xB1, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x35, 0x7C, 0x19, 0xA7, 0xEC, 0xFF, 0xFF, 0x28,
+0x80, 0x80, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x02, 0x4E, 0xA2, 0xD8, 0xF5,
+0xFA, 0xEA, 0xC1, 0x73, 0x0B, 0x00, 0x00, 0x86, 0xFF, 0xFE, 0xDC, 0xBF, 0xBE, 0xDC, 0xFF, 0xFF,
+0xDD, 0x1D, 0x00, 0x6F, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x33, 0xDC, 0xFF, 0xB0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+0xFF, 0xFD, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xBE, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xF8, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x13, 0xDB, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xCE, 0xFF, 0xBC,
+0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xD5, 0xFF, 0xBF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x3E, 0xE9, 0xFF, 0xA8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0xFC, 0xFD,
+0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xBD, 0xFF, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xC3, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x1C, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x2F, 0x88, 0xC0, 0xE0, 0xF3,
+0xFB, 0xEB, 0xC5, 0x7D, 0x13, 0x00, 0x00, 0x80, 0xFF, 0xF4, 0xD6, 0xC2, 0xBD, 0xD7, 0xFE, 0xFF,
+0xEA, 0x2D, 0x00, 0x32, 0x37, 0x04, 0x00, 0x00, 0x00, 0x00, 0x23, 0xCA, 0xFF, 0xC8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+0xFF, 0xF3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x49, 0xDD, 0xFF, 0x88, 0x00, 0x00,
+0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x03, 0x00, 0x00, 0x00, 0x87, 0xB4, 0xB4,
+0xB4, 0xC3, 0xEF, 0xFF, 0xD1, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xB3,
+0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFE, 0x0C, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFC, 0x0C, 0x34, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xD6,
+0xFF, 0xB7, 0x00, 0x80, 0xFF, 0xF5, 0xD6, 0xC1, 0xBD, 0xD8, 0xFF, 0xFF, 0xE1, 0x22, 0x00, 0x2F,
+0x89, 0xC1, 0xE1, 0xF4, 0xFB, 0xEC, 0xC3, 0x77, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x91, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFD, 0xF1,
+0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xD8, 0xFF, 0x66, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x34, 0xFC, 0xF4, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD3,
+0xFF, 0x6C, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0xC2, 0x01, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0xF6, 0x24, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x00, 0x00, 0x04, 0xCD, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00,
+0x7A, 0xFF, 0xC7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0xF8, 0xFF, 0xCF,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xBF, 0xFF, 0xFF, 0x7C, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0x5A, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD2, 0xDE, 0xF4, 0xF8, 0xE6, 0xB9, 0x68, 0x07, 0x00, 0x00, 0xFF,
+0xF0, 0xD0, 0xC4, 0xB8, 0xBD, 0xE0, 0xFF, 0xFF, 0xD3, 0x17, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x37, 0xDD, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+0xFF, 0xF9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x67, 0xFF, 0xE4, 0x00, 0x62, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x56, 0xF3,
+0xFF, 0x79, 0x00, 0xFF, 0xFF, 0xE7, 0xCE, 0xB9, 0xC0, 0xEA, 0xFF, 0xFF, 0xA3, 0x03, 0x00, 0x6C,
+0xA5, 0xD5, 0xEB, 0xFB, 0xF4, 0xD9, 0xA3, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x6D, 0xC3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xC2, 0xFF, 0xF0,
+0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0xFF, 0xAC, 0x16, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2D, 0xEE, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0xDE, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xB7,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFD, 0x6A, 0x86, 0xA1, 0xAF,
+0xA1, 0x76, 0x24, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+0x8A, 0x00, 0x00, 0xC4, 0xFF, 0xB2, 0x4B, 0x1D, 0x0C, 0x0A, 0x2C, 0x90, 0xFC, 0xFF, 0x6B, 0x00,
+0xEC, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDD, 0x00, 0xFB, 0xFF, 0x2B,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0x14, 0xF2, 0xFF, 0x37, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x22, 0xD2, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x26, 0xFF, 0xFF, 0x12, 0x91, 0xFF, 0xC8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0xDE,
+0x00, 0x26, 0xF8, 0xFF, 0x97, 0x0A, 0x00, 0x00, 0x00, 0x58, 0xF4, 0xFF, 0x73, 0x00, 0x00, 0x5C,
+0xFA, 0xFF, 0xF2, 0xC1, 0xC1, 0xE6, 0xFF, 0xFF, 0xA9, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x9E, 0xDE,
+0xF7, 0xF8, 0xE2, 0xAF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xC0, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x10, 0xEF, 0xFC, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xA2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF0, 0xFD, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x83, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xF1, 0xFE, 0x2D, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+0xF2, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xB5, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x14, 0xF3, 0xFF, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89,
+0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF4, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xF5,
+0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x9E, 0xD8, 0xF5, 0xFC, 0xF2,
+0xD1, 0x91, 0x22, 0x00, 0x00, 0x00, 0x5B, 0xFC, 0xFF, 0xF3, 0xC9, 0xBB, 0xD1, 0xFC, 0xFF, 0xF4,
+0x3B, 0x00, 0x04, 0xEB, 0xFF, 0xA3, 0x0C, 0x00, 0x00, 0x00, 0x1A, 0xC7, 0xFF, 0xC7, 0x00, 0x20,
+0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xF7, 0x00, 0x12, 0xFF, 0xFF, 0x1C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xE7, 0x00, 0x00, 0xC7, 0xFF, 0xAC, 0x11, 0x00, 0x00,
+0x00, 0x18, 0xC6, 0xFF, 0x91, 0x00, 0x00, 0x2A, 0xE5, 0xFF, 0xF6, 0xCB, 0xB9, 0xCD, 0xFA, 0xFF,
+0xB7, 0x0A, 0x00, 0x00, 0x2B, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6F, 0x00, 0x00,
+0x30, 0xF1, 0xFE, 0x92, 0x2F, 0x0E, 0x0E, 0x2C, 0x86, 0xF9, 0xFF, 0x6C, 0x00, 0xB8, 0xFF, 0x8F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xE8, 0x02, 0xF1, 0xFF, 0x3E, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x1B, 0xF5, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x16, 0xFF, 0xFF, 0x1B, 0xCB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xEF,
+0x03, 0x6C, 0xFF, 0xF9, 0x5D, 0x02, 0x00, 0x00, 0x00, 0x41, 0xE8, 0xFF, 0x92, 0x00, 0x03, 0xA8,
+0xFF, 0xFF, 0xEA, 0xC7, 0xBF, 0xDF, 0xFF, 0xFF, 0xC5, 0x0D, 0x00, 0x00, 0x00, 0x50, 0xAF, 0xE2,
+0xF8, 0xFA, 0xE8, 0xB9, 0x63, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x91, 0xCE, 0xF0, 0xFB, 0xEF,
+0xCE, 0x89, 0x1C, 0x00, 0x00, 0x00, 0x74, 0xFC, 0xFF, 0xF3, 0xC6, 0xB8, 0xCE, 0xFC, 0xFF, 0xF2,
+0x49, 0x00, 0x46, 0xFF, 0xFF, 0x7C, 0x09, 0x00, 0x00, 0x00, 0x1A, 0xB1, 0xFF, 0xF2, 0x1D, 0xB5,
+0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD6, 0xFF, 0x89, 0xEB, 0xFF, 0x44, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xCE, 0xFB, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3B, 0xFF, 0xF0, 0xE9, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x2C, 0xFF, 0xFA, 0xAC, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xE7,
+0x35, 0xFA, 0xFF, 0xAE, 0x3C, 0x0C, 0x02, 0x09, 0x1F, 0x49, 0xB4, 0xFF, 0xB9, 0x00, 0x4F, 0xEC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x0B, 0x5A, 0x91, 0xAA,
+0xAD, 0x9A, 0x77, 0x75, 0xFF, 0xF2, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+0xE1, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFF, 0xB0, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xD2, 0xFF, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x08, 0x74, 0xF5, 0xFF, 0xA2, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDA,
+0xFF, 0xF0, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x9A, 0x15, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xB4, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xB4, 0xB4, 0x1C, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0xB4, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xF2, 0x08, 0x00, 0x88, 0xFF, 0xA1, 0x00,
+0x01, 0xE0, 0xFF, 0x47, 0x00, 0x3D, 0xFF, 0xEA, 0x04, 0x00, 0x97, 0xFF, 0x94, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x20, 0x8D, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAE, 0xFD, 0xFF, 0xBB, 0x34,
+0x00, 0x00, 0x07, 0x60, 0xCF, 0xFF, 0xF5, 0x98, 0x2A, 0x00, 0x00, 0x19, 0x82, 0xEA, 0xFF, 0xE0,
+0x76, 0x11, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xC2, 0x53, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFA, 0xFC, 0xAA, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x83, 0xEA, 0xFF,
+0xD1, 0x65, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x61, 0xD0, 0xFF, 0xEE, 0x8C, 0x22,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xAF, 0xFD, 0xFD, 0xB4, 0x31, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x21, 0x8E, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC4, 0x55, 0x04, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEA, 0xFF, 0xE2, 0x77, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x61, 0xCF, 0xFF, 0xF5, 0x98, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x3E, 0xAD, 0xFC, 0xFF, 0xBA, 0x4A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8A, 0xEE,
+0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x74, 0xE0, 0xFF, 0x7A, 0x00, 0x00, 0x00,
+0x00, 0x2F, 0x9B, 0xF6, 0xFF, 0xBB, 0x4B, 0x01, 0x00, 0x04, 0x56, 0xC3, 0xFF, 0xF5, 0x99, 0x2A,
+0x00, 0x00, 0x00, 0x7E, 0xE5, 0xFF, 0xE2, 0x78, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC5,
+0x56, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x85, 0xB1, 0xD9, 0xEB, 0xFA, 0xF7, 0xE2, 0xB5, 0x64, 0x05, 0x00, 0xFF,
+0xFB, 0xDA, 0xC8, 0xB9, 0xC4, 0xE2, 0xFF, 0xFF, 0xCE, 0x12, 0x2B, 0x05, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3D, 0xE7, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xE7,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x76, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x26, 0x7D, 0xFA, 0xFF,
+0x79, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x99, 0x04, 0x00, 0x00, 0xFF, 0xFF,
+0xBF, 0xAF, 0x9F, 0x76, 0x29, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xB4, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x71, 0xA7, 0xD6, 0xE8, 0xF8, 0xF7,
+0xE7, 0xD4, 0xA4, 0x6D, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xAD, 0xFC,
+0xFF, 0xFF, 0xF1, 0xCE, 0xBF, 0xBA, 0xCA, 0xE7, 0xFF, 0xFF, 0xFB, 0xA7, 0x19, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x46, 0xEF, 0xFF, 0xEA, 0x84, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x75,
+0xE3, 0xFF, 0xEC, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xF3, 0xFF, 0xB4, 0x14, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xA9, 0xFF, 0xEF, 0x28, 0x00, 0x00, 0xC7, 0xFF, 0xBF,
+0x05, 0x00, 0x12, 0x94, 0xCC, 0xE9, 0xFA, 0xF4, 0xD6, 0x96, 0x25, 0x00, 0x00, 0x03, 0xBB, 0xFF,
+0xBD, 0x00, 0x42, 0xFF, 0xFB, 0x23, 0x00, 0x00, 0x28, 0xFF, 0xE1, 0xC7, 0xB8, 0xC6, 0xF0, 0xFF,
+0xF5, 0x3A, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0x39, 0x8F, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x07, 0x13,
+0x00, 0x00, 0x00, 0x00, 0x05, 0x97, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x86, 0xCC, 0xFF,
+0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x6E, 0xFF, 0xC5, 0xE6, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x12, 0x69, 0x9D, 0xB0, 0xAC,
+0x9F, 0x98, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xE2, 0xF8, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+0x36, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF5,
+0xF6, 0xFF, 0x31, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xBE, 0x30, 0x08, 0x07, 0x14, 0x52, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFA, 0xE4, 0xFF, 0x42, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xED, 0xC7, 0xFF, 0x6C, 0x00,
+0x00, 0x22, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x50,
+0xFF, 0xCF, 0x8C, 0xFF, 0xAB, 0x00, 0x00, 0x06, 0xF5, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x2D, 0xBC,
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x9F, 0x41, 0xFF, 0xFA, 0x1A, 0x00, 0x00, 0x86, 0xFF,
+0xFF, 0xCD, 0xBB, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xD2, 0xFF, 0x51, 0x00, 0xCD,
+0xFF, 0xAD, 0x00, 0x00, 0x02, 0x6E, 0xD0, 0xF7, 0xF9, 0xD9, 0x94, 0x37, 0xFF, 0xFF, 0x3B, 0x0C,
+0x87, 0xFF, 0xD3, 0x02, 0x00, 0x37, 0xF8, 0xFF, 0x94, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x26, 0x00, 0x00, 0x00, 0x58, 0xF8, 0xFF, 0xD2,
+0x5C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x7A, 0xA8, 0xA3, 0x6B, 0x0D, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x32, 0xC7, 0xFF, 0xFF, 0xFD, 0xD8, 0xC2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x85, 0xBE, 0xE1, 0xF2,
+0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xD0, 0xFF, 0xF5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x89, 0xFF, 0xE6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x27, 0xFE, 0xDE, 0x02, 0xCA, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x73, 0x00, 0x58, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF6, 0xF5, 0x11, 0x00, 0x04, 0xE2, 0xFF, 0x44, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x75, 0xFF, 0xB6, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE6, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFE,
+0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91,
+0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x51, 0x00, 0xBD, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF7, 0x15, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xE0, 0x03, 0x08, 0xB4, 0xB8, 0xB8,
+0xB8, 0xB8, 0xDF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4A, 0xFF, 0xE9, 0x07, 0x00, 0x00, 0x27, 0xFE, 0xF6, 0x13, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0xDE, 0xFF, 0x63, 0x00, 0x00, 0x98, 0xFF, 0x9C, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xD5, 0x00, 0x13, 0xF6, 0xFF, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF9, 0xFF, 0x48, 0x7B, 0xFF, 0xC2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFB, 0xE6, 0xAF, 0x3F, 0x00, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xC0,
+0xEC, 0xFF, 0xFD, 0x50, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xAD, 0xFF, 0xD0,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xF8, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xE0, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0xBC, 0xFF, 0x86, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x13, 0x5E, 0xD5, 0xFF, 0xB1, 0x09,
+0xFF, 0xFF, 0x28, 0x00, 0x1F, 0xDE, 0xFE, 0xFF, 0xFE, 0x7B, 0x01, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x17, 0x94, 0xA7, 0xC8, 0xFE, 0xFF, 0xB5, 0x10, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x29, 0xE2, 0xFF, 0x95, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xE3,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xF9, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xDF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0xD8, 0xFF, 0x94, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xCB, 0xF8, 0xFF, 0xDE, 0x16,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xD4, 0x88, 0x12, 0x00, 0x00, 0x00, 0x00, 0x05,
+0x53, 0x9F, 0xD1, 0xEB, 0xFA, 0xF3, 0xE1, 0xC3, 0x8A, 0x2F, 0x00, 0x00, 0x42, 0xE0, 0xFF, 0xFF,
+0xF7, 0xCE, 0xBC, 0xBE, 0xD4, 0xF1, 0xFF, 0x80, 0x00, 0x4C, 0xFC, 0xFF, 0xC8, 0x4C, 0x05, 0x00,
+0x00, 0x00, 0x00, 0x03, 0x35, 0x33, 0x10, 0xEF, 0xFF, 0xA1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0xE1, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBE, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xE7, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x34, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xB9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x35, 0xF6, 0xFF, 0xD5, 0x55, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x33,
+0x00, 0x00, 0x30, 0xD5, 0xFF, 0xFF, 0xF9, 0xCF, 0xBC, 0xBD, 0xD3, 0xF1, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x02, 0x4B, 0x9B, 0xD1, 0xEC, 0xFA, 0xF4, 0xE2, 0xC3, 0x8B, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF7, 0xE6, 0xC0, 0x84, 0x22, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4,
+0xB4, 0xBD, 0xD5, 0xFD, 0xFF, 0xFD, 0x8B, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x7A, 0xF8, 0xFF, 0x9E, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x43, 0xFC, 0xFF, 0x45, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x9D, 0xFF, 0xB2, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x42, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x14, 0xFF, 0xFF, 0x13, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0xFF, 0xFF, 0x23, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+0xFF, 0xFF, 0x18, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF,
+0xFC, 0x06, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xCF,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x87, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xF8, 0x1C, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x95, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0xFF, 0xFF,
+0xBF, 0xB4, 0xB4, 0xB4, 0xBD, 0xD7, 0xFF, 0xFF, 0xF4, 0x62, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF7, 0xE5, 0xBA, 0x77, 0x13, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x5A, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x5A, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+0x5F, 0xA6, 0xD8, 0xEE, 0xFB, 0xEE, 0xDB, 0xB2, 0x77, 0x0D, 0x00, 0x00, 0x4E, 0xE9, 0xFF, 0xFF,
+0xF3, 0xCA, 0xBA, 0xC3, 0xDA, 0xFA, 0xFF, 0x28, 0x00, 0x56, 0xFE, 0xFF, 0xBE, 0x41, 0x02, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0x4B, 0x11, 0x13, 0xF2, 0xFF, 0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xDD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xC0, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF,
+0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x33, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x0B, 0xDF, 0xFF, 0x4E, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xAB, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x5E, 0xFF, 0xEB, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x05, 0xDD, 0xFF, 0xAA, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x32, 0xF4, 0xFF, 0xC6, 0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x2D, 0xD1, 0xFF, 0xFF, 0xF1, 0xC8, 0xB8, 0xC0, 0xE2, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x01, 0x48, 0x98, 0xCE, 0xEB, 0xFA, 0xF3, 0xDD, 0xB3, 0x6E, 0x0A, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF,
+0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x24,
+0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFC, 0x0C, 0x00, 0x00, 0x25, 0xD1, 0xFF, 0xB9, 0x00, 0x5F, 0xD6,
+0xFC, 0xFF, 0xE8, 0x26, 0x00, 0x7E, 0xF2, 0xCD, 0x85, 0x14, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xE7, 0xFF, 0xAB, 0x04, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x24, 0xE5, 0xFF, 0xAB, 0x04, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0xE3, 0xFF, 0xAB, 0x04, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x20, 0xE1, 0xFF, 0xAB, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x1E, 0xDF,
+0xFF, 0xAB, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x1C, 0xDD, 0xFF, 0xAB,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x1A, 0xDB, 0xFF, 0xAB, 0x04, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x7F, 0xFF, 0xDD, 0x04, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x4A, 0xFD, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFD, 0x56, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xF9, 0x44, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBE, 0xFF, 0xF3, 0x34, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xFF, 0xEA, 0x25, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE2, 0xFF, 0xDF, 0x19, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0xFF, 0xD2, 0x10, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFC, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xFB, 0xF5, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0xE0, 0xFC, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xA4, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x59, 0xFF, 0xA7, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x2E, 0xFF, 0xEB, 0x09, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x34, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0xB8, 0xFF,
+0x6B, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xC0, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00,
+0x43, 0xFF, 0xDD, 0x03, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0x4C, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0xCC, 0xFF, 0x57, 0x00, 0x00, 0x28, 0xFE, 0xD7, 0x01, 0x00, 0x28, 0xFF, 0xFF,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x57, 0xFF, 0xCC, 0x00, 0x00, 0x9B, 0xFF, 0x64, 0x00, 0x00, 0x28,
+0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x03, 0xDE, 0xFF, 0x42, 0x16, 0xF7, 0xE9, 0x08, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xB8, 0x83, 0xFF, 0x7D,
+0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x0A, 0xEC, 0xFF, 0xF2,
+0xF5, 0x13, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x81,
+0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x14, 0xF6, 0xFD, 0x24, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF, 0x65, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF, 0xF7, 0x2F, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xA1, 0xFF, 0xDA, 0x0D, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x29, 0xB7, 0xFF, 0xA9, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x14, 0xE4, 0xFF, 0x6A, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x3D, 0xFC, 0xF8, 0x33, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x7A, 0xFF, 0xDD, 0x0F, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x01, 0xB8, 0xFF, 0xAE, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x15, 0xE5, 0xFF, 0x70, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0xFA, 0x37, 0x00, 0xFF, 0xFF,
+0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xE0, 0x11, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0xFF, 0xB2, 0xFF, 0xFF, 0x28, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xE5, 0xFF, 0xFF, 0xFF, 0x28, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x06,
+0x5A, 0xA3, 0xD7, 0xEE, 0xFB, 0xF0, 0xDB, 0xA9, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+0xE3, 0xFF, 0xFF, 0xED, 0xC6, 0xB8, 0xC4, 0xE7, 0xFF, 0xFF, 0xE8, 0x49, 0x00, 0x00, 0x00, 0x47,
+0xFC, 0xFF, 0xB7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB0, 0xFF, 0xFD, 0x4C, 0x00, 0x0C,
+0xEB, 0xFF, 0x96, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xED, 0x0D,
+0x6D, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xFF,
+0x6F, 0xB5, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
+0xFF, 0xB5, 0xE4, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x46, 0xFF, 0xE3, 0xF7, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x30, 0xFF, 0xF6, 0xF7, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x32, 0xFF, 0xF7, 0xE5, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x49, 0xFF, 0xE4, 0xB8, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xB8, 0x71, 0xFF, 0xE3, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x05, 0xE1, 0xFF, 0x72, 0x0E, 0xEE, 0xFF, 0x9B, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xF0, 0x0F, 0x00, 0x4C, 0xFD, 0xFF, 0xBB, 0x39, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x31, 0xB2, 0xFF, 0xFE, 0x51, 0x00, 0x00, 0x00, 0x46, 0xE6, 0xFF, 0xFF,
+0xEC, 0xC5, 0xB8, 0xC3, 0xE8, 0xFF, 0xFF, 0xEB, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5D,
+0xA6, 0xD9, 0xF0, 0xFC, 0xF2, 0xDD, 0xAC, 0x65, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF5, 0xD7, 0x93, 0x1D, 0x00, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB5, 0xCD,
+0xF8, 0xFF, 0xEE, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xD1, 0xFF, 0xAD,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xED, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xF8, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x64, 0xFF, 0xD5, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xE8, 0xFF, 0x77,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x2E, 0x8C, 0xF6, 0xFF, 0xBD, 0x06, 0xFF, 0xFF, 0x28, 0x00,
+0x4D, 0xEF, 0xFF, 0xFF, 0xF5, 0x87, 0x07, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x24, 0xE3, 0xAF, 0x68,
+0x13, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+0x5A, 0xA3, 0xD7, 0xEE, 0xFB, 0xF0, 0xDB, 0xA9, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+0xE3, 0xFF, 0xFF, 0xED, 0xC6, 0xB8, 0xC4, 0xE7, 0xFF, 0xFF, 0xE8, 0x49, 0x00, 0x00, 0x00, 0x47,
+0xFC, 0xFF, 0xB7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB0, 0xFF, 0xFD, 0x4C, 0x00, 0x0C,
+0xEB, 0xFF, 0x96, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xED, 0x0D,
+0x6D, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xFF,
+0x6F, 0xB5, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
+0xFF, 0xB5, 0xE4, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x46, 0xFF, 0xE3, 0xF7, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x30, 0xFF, 0xF6, 0xF7, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x32, 0xFF, 0xF8, 0xE5, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x49, 0xFF, 0xE7, 0xB8, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xBC, 0x71, 0xFF, 0xE3, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x05, 0xE1, 0xFF, 0x74, 0x0E, 0xEE, 0xFF, 0x9B, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xF0, 0x15, 0x00, 0x4C, 0xFD, 0xFF, 0xBB, 0x39, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x31, 0xB2, 0xFF, 0xFE, 0x5B, 0x00, 0x00, 0x00, 0x46, 0xE6, 0xFF, 0xFF,
+0xEC, 0xC5, 0xB8, 0xC3, 0xE8, 0xFF, 0xFF, 0xF1, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5E,
+0xA7, 0xDA, 0xF0, 0xFD, 0xFF, 0xFF, 0xCE, 0x74, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1A, 0xDF, 0xFF, 0xD6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xE8, 0xFF, 0xCB, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF0, 0xFF, 0xBE, 0x04, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xE5, 0x56, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xE5, 0xAC, 0x3A, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xC0, 0xEC, 0xFF, 0xFC, 0x49, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xAB, 0xFF, 0xCB, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xF7, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x3F, 0xFF, 0xEA, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+0xB4, 0xFF, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x39, 0xBF, 0xFF, 0xCC,
+0x0E, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x0F, 0xA8, 0xE2, 0xFF, 0xF5, 0x88, 0x0A, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x18, 0xFF, 0xFF, 0xB8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x94, 0xFF, 0xFA, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x06, 0xCB, 0xFF, 0xE0, 0x11, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x21, 0xEF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x4F, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D,
+0xFF, 0xFA, 0x37, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC5, 0xFF,
+0xE1, 0x11, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xEC, 0xFF, 0xB2,
+0x01, 0x00, 0x00, 0x45, 0x9C, 0xD0, 0xEF, 0xFB, 0xF5, 0xE6, 0xD6, 0xAE, 0x7C, 0x24, 0x08, 0xB0,
+0xFF, 0xFF, 0xF1, 0xC9, 0xB8, 0xC1, 0xD4, 0xE8, 0xFF, 0xFF, 0x68, 0x86, 0xFF, 0xEF, 0x57, 0x04,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x59, 0x35, 0xE1, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xE2, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xEC, 0x5B, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB7, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFE, 0xF1, 0xCC, 0x83, 0x12, 0x00, 0x00, 0x00, 0x40, 0x87, 0xA9, 0xB3, 0xB4,
+0xB6, 0xCF, 0xFA, 0xFF, 0xE4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+0xD1, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xEA,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xD9, 0x38, 0x60, 0x23, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x58, 0xF3, 0xFF, 0x7B, 0x68, 0xFF, 0xFF, 0xED, 0xD7, 0xC4, 0xB7, 0xC4, 0xEE,
+0xFF, 0xFF, 0xAC, 0x06, 0x24, 0x7B, 0xAB, 0xD3, 0xE5, 0xF3, 0xFC, 0xF3, 0xD7, 0xA2, 0x47, 0x00,
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xF3, 0xFF, 0x36,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFF, 0xF1, 0xD1, 0xFF, 0x68, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xCF, 0x88, 0xFF, 0xD4, 0x08, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xD6, 0xFF, 0x86, 0x18, 0xED, 0xFF, 0xBD, 0x26, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xBF, 0xFF, 0xEC, 0x16, 0x00, 0x38, 0xE5, 0xFF, 0xFF, 0xD9, 0xBB, 0xBC, 0xDA, 0xFF, 0xFF,
+0xE4, 0x36, 0x00, 0x00, 0x00, 0x0F, 0x70, 0xBB, 0xE8, 0xF9, 0xF9, 0xE7, 0xBA, 0x6E, 0x0E, 0x00,
+0x00, 0x7B, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+0xFF, 0xBA, 0x13, 0xF5, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+0xEA, 0xFF, 0x49, 0x00, 0x97, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x61, 0xFF, 0xD6, 0x01, 0x00, 0x26, 0xFE, 0xFD, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xCE, 0xFF, 0x65, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3E, 0xFF, 0xEB, 0x08, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xAC, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0x74, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1E, 0xFC, 0xF8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xE1, 0x04, 0x00,
+0x00, 0x00, 0x00, 0x89, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE4, 0xFF, 0x57,
+0x00, 0x00, 0x00, 0x09, 0xED, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFF,
+0xC9, 0x00, 0x00, 0x00, 0x66, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+0xF4, 0xFF, 0x3A, 0x00, 0x00, 0xD4, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x93, 0xFF, 0xAC, 0x00, 0x43, 0xFF, 0xD6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x23, 0xFD, 0xFC, 0x20, 0xB2, 0xFF, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xAF, 0xFD, 0xEB, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xF8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x53, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFE, 0x1F, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0x96, 0x27, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xBB, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0x63, 0x03, 0xF7, 0xFF,
+0x1C, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFC, 0xF1, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCE, 0xFF, 0x31, 0x00, 0xCF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0x88, 0xD6, 0xFF,
+0x36, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF9, 0xF9, 0x05, 0x00, 0xA3, 0xFF, 0x72, 0x00, 0x00, 0x00,
+0x00, 0xC0, 0xFF, 0x31, 0x7C, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xCC, 0x00, 0x00,
+0x77, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x19, 0xFD, 0xD9, 0x00, 0x22, 0xFF, 0xEB, 0x05, 0x00, 0x00,
+0x00, 0x61, 0xFF, 0x99, 0x00, 0x00, 0x4B, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x82, 0x00,
+0x00, 0xC7, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x92, 0xFF, 0x67, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x01,
+0x00, 0x00, 0xC5, 0xFF, 0x2A, 0x00, 0x00, 0x6D, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0x34,
+0x00, 0x00, 0x00, 0xF1, 0xFF, 0x20, 0x00, 0x1D, 0xFE, 0xD3, 0x00, 0x00, 0x00, 0x16, 0xFB, 0xF8,
+0x10, 0x00, 0x01, 0xF1, 0xFA, 0x07, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x4B, 0x00, 0x73, 0xFF, 0x7B,
+0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0x66, 0x00, 0x24, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x9B,
+0xFF, 0x77, 0x00, 0xCA, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xC4, 0x00, 0x55, 0xFF,
+0x9D, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA2, 0x21, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x0D, 0xF6, 0xFF, 0x22, 0x86, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xCE, 0x78, 0xFF,
+0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0x7E, 0xB7, 0xFF, 0x38, 0x00, 0x00, 0x00,
+0x00, 0x16, 0xFF, 0xF6, 0xD1, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xDB,
+0xE7, 0xFC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x05, 0xED, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF,
+0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xFF, 0xA1, 0x00, 0x00,
+0x00, 0x4D, 0xFD, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xDB, 0xFF,
+0xB1, 0x01, 0x00, 0x78, 0xFF, 0xF6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBC, 0xFF,
+0xD3, 0x0C, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xE4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF,
+0xEC, 0x21, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC9, 0xFF, 0xC8, 0x07, 0x00, 0x00, 0x00, 0x66, 0xFF,
+0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xE5, 0xFF, 0xA1, 0x00, 0x00, 0x3F, 0xFA,
+0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xF7, 0xFF, 0x75, 0x21, 0xEB,
+0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xFD, 0xE0,
+0xFF, 0xBE, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF,
+0xFF, 0xDE, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86,
+0xFF, 0xFF, 0xDD, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
+0xFF, 0xFD, 0xE0, 0xFF, 0xBE, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+0xF6, 0xFF, 0x75, 0x21, 0xEB, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+0xE5, 0xFF, 0xA2, 0x00, 0x00, 0x3F, 0xFA, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+0xC9, 0xFF, 0xC8, 0x07, 0x00, 0x00, 0x00, 0x67, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xA4, 0xFF, 0xE4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xEB, 0x21, 0x00, 0x00, 0x00,
+0x78, 0xFF, 0xF7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBD, 0xFF, 0xD2, 0x0C, 0x00,
+0x4C, 0xFD, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xDB, 0xFF, 0xB0,
+0x01, 0x01, 0xC8, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF,
+0x3D, 0x00, 0x35, 0xFE, 0xFD, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD4, 0xFF, 0x9F,
+0x00, 0x00, 0x00, 0x9E, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xED, 0x15,
+0x00, 0x00, 0x00, 0x17, 0xF1, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEF, 0xFF, 0x65, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xE1, 0x09, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xC6, 0x01, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x05, 0xD8, 0xFF, 0x7E, 0x00, 0x00, 0x32, 0xFD, 0xFB, 0x2F, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xF5, 0x1C, 0x00, 0xC4, 0xFF, 0x8D, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xA5, 0x5C, 0xFF, 0xE4, 0x0C, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xF9, 0xFF, 0xED, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xD8, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xE8, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x0D, 0xD2, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xB5, 0xFF, 0xB3,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF, 0xD5, 0x0D, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xEE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x46, 0xFB, 0xFC, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xF0, 0xFF,
+0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xDD, 0xFF, 0x9D, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC3, 0xFF, 0xC5, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xA2, 0xFF, 0xE2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF,
+0xF6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFE, 0xFF, 0x57, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xF1, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0x5A, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xBF,
+0xB4, 0xB4, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x71, 0xFF, 0xEA, 0x0C, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x61, 0xFF, 0xF2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD5,
+0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xF8, 0x1E, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFC, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xB9, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFE, 0xFF,
+0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xBD, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFB, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x99, 0xFF, 0xCB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
+0xF6, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xD8, 0x03,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xEF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xE3, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xB4,
+0xB4, 0xB4, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x80, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x45, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xD2, 0x9D,
+0xFB, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x4B, 0x19, 0xF5, 0xAF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x09, 0xE3, 0xC2, 0x00, 0x00, 0x82, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7A,
+0xFF, 0x39, 0x00, 0x00, 0x0C, 0xE8, 0xC8, 0x00, 0x00, 0x00, 0x15, 0xF1, 0xAF, 0x00, 0x00, 0x00,
+0x00, 0x68, 0xFF, 0x56, 0x00, 0x00, 0x94, 0xFC, 0x29, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD7, 0xDD,
+0x06, 0x26, 0xFB, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0x71, 0xB4, 0xB4, 0xB4,
+0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x80, 0x7F, 0x14, 0x00, 0x08, 0xAD, 0xFF, 0xB9, 0x02, 0x00,
+0x02, 0x94, 0xFF, 0x81, 0x00, 0x8C, 0xC4, 0xE6, 0xF9, 0xF7, 0xDE, 0xA6, 0x3C, 0x00, 0x00, 0x00,
+0xFF, 0xF3, 0xD0, 0xBB, 0xC7, 0xF1, 0xFF, 0xFE, 0x62, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x00,
+0x0B, 0xA0, 0xFF, 0xED, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x21,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x44, 0xB0, 0xE5, 0xFA,
+0xF3, 0xE0, 0xCD, 0xFF, 0xFF, 0x28, 0x5C, 0xFE, 0xFF, 0xE5, 0xBD, 0xBF, 0xD1, 0xE3, 0xFF, 0xFF,
+0x28, 0xD9, 0xFF, 0x8E, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFA, 0xFF, 0x34, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xE1, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x11, 0x7D, 0xFF,
+0xFF, 0x28, 0x74, 0xFF, 0xFF, 0xD2, 0xB9, 0xCE, 0xFA, 0xFE, 0xF6, 0xFF, 0x28, 0x00, 0x64, 0xC9,
+0xF4, 0xFA, 0xE1, 0xA0, 0x34, 0x5F, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA6, 0xD2, 0xF1, 0xF9, 0xE3, 0xAC, 0x45, 0x00, 0x00, 0xFF,
+0xFF, 0xFF, 0xE5, 0xC4, 0xC3, 0xEB, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+0x02, 0x6E, 0xFE, 0xFF, 0x47, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xAF,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xE5, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x30, 0xFF, 0xFA, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF,
+0xF2, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xD6, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xC5, 0xFF, 0x95, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0x0D, 0x98, 0xFF,
+0xF9, 0x28, 0xFF, 0xFF, 0xF4, 0xC9, 0xB8, 0xC3, 0xF4, 0xFF, 0xF9, 0x5D, 0x00, 0x9B, 0xC2, 0xE3,
+0xF0, 0xFB, 0xF5, 0xD9, 0x99, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x87, 0xC8, 0xED, 0xFB, 0xF5,
+0xE3, 0xBC, 0x00, 0x5C, 0xF6, 0xFF, 0xF7, 0xCA, 0xB7, 0xC0, 0xD1, 0xF6, 0x31, 0xFB, 0xFF, 0x8E,
+0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xE2, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x2D, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF,
+0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xC7, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1E, 0xF2, 0xFF, 0xA3, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x45, 0xEE, 0xFF,
+0xF9, 0xCB, 0xB7, 0xBF, 0xD1, 0xF5, 0x00, 0x00, 0x18, 0x80, 0xC7, 0xED, 0xFB, 0xF6, 0xE3, 0xBD,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x45, 0xAC,
+0xE3, 0xF9, 0xF1, 0xD2, 0xA6, 0xFF, 0xFF, 0x00, 0x88, 0xFF, 0xFF, 0xEA, 0xC2, 0xC5, 0xE6, 0xFF,
+0xFF, 0xFF, 0x48, 0xFF, 0xFD, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xB0, 0xFF, 0xA0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xE6, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0xFA, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xF5, 0xFF,
+0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xDB, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0xA1, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x3B,
+0xFF, 0xFF, 0x7B, 0x03, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x00, 0x84, 0xFF, 0xFF, 0xE8, 0xBB,
+0xBF, 0xD8, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x4D, 0xB8, 0xEC, 0xFD, 0xF9, 0xEA, 0xD0, 0xA8, 0x6E,
+0x00, 0x00, 0x4B, 0xB2, 0xE7, 0xFA, 0xF1, 0xCA, 0x76, 0x08, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xDB,
+0xBD, 0xD6, 0xFD, 0xFF, 0xC9, 0x09, 0x47, 0xFF, 0xEF, 0x3F, 0x00, 0x00, 0x00, 0x37, 0xEB, 0xFF,
+0x7B, 0xAE, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xCF, 0xE5, 0xFF, 0x3B, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xF4, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF8, 0xF5, 0xFF, 0xC0, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xA4, 0xD8, 0xFF, 0x3D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x27, 0xF8, 0xFE, 0x78, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x56,
+0xF6, 0xFF, 0xF4, 0xC8, 0xB7, 0xC0, 0xD1, 0xF8, 0x60, 0x00, 0x00, 0x23, 0x8F, 0xD1, 0xF2, 0xFC,
+0xF1, 0xE0, 0xB6, 0x37, 0x00, 0x00, 0x20, 0x5F, 0x79, 0x73, 0x50, 0x0E, 0x03, 0x9A, 0xFE, 0xFF,
+0xFF, 0xFF, 0xFF, 0x80, 0x7B, 0xFF, 0xEF, 0x77, 0x41, 0x3E, 0x5B, 0x44, 0xDA, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xB4, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x9C,
+0xD9, 0xF4, 0xFB, 0xEF, 0xE1, 0xC0, 0x9A, 0x00, 0x6B, 0xFC, 0xFF, 0xEE, 0xBF, 0xB9, 0xC7, 0xED,
+0xFF, 0xFF, 0x36, 0xFD, 0xFF, 0x7B, 0x05, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xA4, 0xFF, 0xAA,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xE0, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0xF8, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xF7, 0xFF,
+0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xDE, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0xA3, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x39,
+0xFE, 0xFF, 0x71, 0x02, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x00, 0x76, 0xFE, 0xFF, 0xE6, 0xBB,
+0xC3, 0xE5, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3D, 0xA9, 0xE3, 0xF9, 0xF2, 0xD3, 0xA6, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xEC, 0x00, 0x17, 0x02, 0x00, 0x00,
+0x00, 0x00, 0x1B, 0xC8, 0xFF, 0xA6, 0x00, 0xB0, 0xF5, 0xD0, 0xC0, 0xB9, 0xCF, 0xFC, 0xFF, 0xE2,
+0x1F, 0x00, 0x5A, 0xB4, 0xE0, 0xF2, 0xFC, 0xEF, 0xC9, 0x7E, 0x11, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x36, 0x7A, 0xCB, 0xF3, 0xF9, 0xE1,
+0x9F, 0x24, 0x00, 0xFF, 0xFF, 0xF1, 0xFF, 0xEC, 0xBF, 0xC7, 0xF4, 0xFF, 0xF1, 0x28, 0xFF, 0xFF,
+0xE6, 0x58, 0x03, 0x00, 0x00, 0x16, 0xCC, 0xFF, 0xA9, 0xFF, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4E, 0xFF, 0xE9, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFD, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xB4,
+0xB4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF,
+0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0xB4, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0x22, 0xFF, 0xFF,
+0x0E, 0x00, 0x64, 0xFF, 0xE0, 0x00, 0x07, 0xD6, 0xFF, 0x96, 0x00, 0x30, 0xE9, 0xF7, 0x25, 0x00,
+0x00, 0x13, 0x43, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x55, 0x8B, 0xCD, 0xE8, 0xFB, 0xEB, 0xBA, 0x51, 0x00,
+0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xC1, 0xBC, 0xE1, 0xFF, 0xFF, 0x67, 0x00, 0xFF, 0xFF, 0xA6,
+0x33, 0x00, 0x00, 0x00, 0x01, 0x87, 0xFF, 0xDC, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x32, 0xFF, 0xF6, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xC4,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x04, 0x25, 0x58, 0xB6, 0xFF, 0xEC, 0x31, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x4B, 0xFF, 0xFF, 0xEA, 0x8E, 0x19, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x08, 0xCD, 0xFF,
+0xD9, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x20, 0xED, 0xFF, 0xAE, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x47, 0xFD, 0xFF, 0x78, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFC, 0x43, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x01, 0xB2, 0xFF, 0xEA, 0x1D, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF,
+0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0x93, 0x16, 0x89, 0xD8, 0xF9, 0xEF, 0xBE, 0x49, 0x00, 0x23,
+0x96, 0xDF, 0xFA, 0xE9, 0xA7, 0x24, 0x00, 0xFF, 0xE6, 0xEC, 0xFF, 0xDA, 0xBD, 0xE6, 0xFF, 0xFE,
+0x9E, 0xF8, 0xFF, 0xD1, 0xBF, 0xEF, 0xFF, 0xEB, 0x19, 0xFF, 0xFF, 0xDE, 0x3E, 0x00, 0x00, 0x08,
+0xB9, 0xFF, 0xFF, 0xCB, 0x2D, 0x00, 0x00, 0x12, 0xD6, 0xFF, 0x86, 0xFF, 0xFF, 0x32, 0x00, 0x00,
+0x00, 0x00, 0x48, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xC1, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xD5, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+0xD8, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x50, 0xFF, 0xD8, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x50, 0xFF, 0xD8, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xD8, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xD8, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xD8, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xD8, 0xFF, 0x95, 0x0C,
+0x71, 0xC5, 0xF1, 0xF9, 0xE1, 0x9F, 0x24, 0x00, 0xFF, 0xE6, 0xE2, 0xFF, 0xEC, 0xBF, 0xC7, 0xF4,
+0xFF, 0xF1, 0x28, 0xFF, 0xFF, 0xE6, 0x58, 0x03, 0x00, 0x00, 0x16, 0xCC, 0xFF, 0xA9, 0xFF, 0xFF,
+0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xE9, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x2B, 0xFF, 0xFD, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x00, 0x00, 0x36, 0xA2, 0xDD, 0xF6, 0xF7, 0xDD, 0xA2, 0x36, 0x00, 0x00, 0x00, 0x70, 0xFD,
+0xFF, 0xEB, 0xBE, 0xBD, 0xEB, 0xFF, 0xFD, 0x70, 0x00, 0x36, 0xFD, 0xFF, 0x75, 0x04, 0x00, 0x00,
+0x04, 0x76, 0xFF, 0xFD, 0x36, 0xA2, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF,
+0xA2, 0xDE, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xDE, 0xF7, 0xFF, 0x2E,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0xF8, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x30, 0xFF, 0xF7, 0xE0, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF,
+0xDE, 0xA5, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xA2, 0x39, 0xFE, 0xFF,
+0x79, 0x04, 0x00, 0x00, 0x04, 0x7A, 0xFF, 0xFD, 0x37, 0x00, 0x73, 0xFE, 0xFF, 0xEB, 0xBD, 0xBD,
+0xEB, 0xFF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x39, 0xA5, 0xE0, 0xF8, 0xF8, 0xDF, 0xA3, 0x37, 0x00,
+0x00, 0x9A, 0xBE, 0xDE, 0xED, 0xF9, 0xF8, 0xE2, 0xAA, 0x42, 0x00, 0x00, 0xFF, 0xFF, 0xEE, 0xC9,
+0xBB, 0xC6, 0xEE, 0xFF, 0xFF, 0x87, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x04, 0x78, 0xFF,
+0xFF, 0x48, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xB1, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFF, 0xE7, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x31, 0xFF, 0xFA, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xF2, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xD4, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xB9, 0xFF, 0x95, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x05, 0x83, 0xFF, 0xFA, 0x2A, 0xFF,
+0xFF, 0xFF, 0xE3, 0xC1, 0xBD, 0xED, 0xFF, 0xFC, 0x63, 0x00, 0xFF, 0xFF, 0xA6, 0xD4, 0xF4, 0xF7,
+0xDE, 0xA0, 0x31, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x30, 0x9C, 0xD9, 0xF4, 0xFB, 0xEF, 0xE1, 0xC0, 0x9A, 0x00, 0x6B, 0xFC, 0xFF,
+0xEE, 0xBF, 0xB9, 0xC7, 0xED, 0xFF, 0xFF, 0x36, 0xFD, 0xFF, 0x7B, 0x05, 0x00, 0x00, 0x00, 0x28,
+0xFF, 0xFF, 0xA4, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xE0, 0xFF, 0x50,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xF8, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0xF7, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xDE, 0xFF,
+0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xA3, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0x39, 0xFE, 0xFF, 0x71, 0x02, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x00,
+0x76, 0xFE, 0xFF, 0xE6, 0xBB, 0xC3, 0xE5, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3D, 0xA9, 0xE3, 0xF9,
+0xF2, 0xD3, 0xA6, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0xFF, 0x95, 0x1B, 0x96, 0xE2, 0x7D, 0xFF, 0xE7, 0xEB, 0xFF, 0xD5, 0x5D, 0xFF, 0xFF, 0xD3,
+0x30, 0x00, 0x00, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00,
+0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x44, 0xAD, 0xE1, 0xF8, 0xF9, 0xE9,
+0xD2, 0xA2, 0x42, 0x66, 0xFF, 0xFF, 0xEB, 0xC3, 0xBB, 0xCF, 0xEA, 0xFF, 0x88, 0xE1, 0xFF, 0x91,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2C, 0xF4, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xCA, 0xFF, 0x9E, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFA, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF4, 0xCB, 0x63, 0x00, 0x00, 0x21, 0x82, 0xA4, 0xB4, 0xB4, 0xCF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x35, 0xFF, 0xFA, 0x31, 0x32, 0x02, 0x00, 0x00, 0x00, 0x05, 0x98, 0xFF, 0xDB, 0x80, 0xFF, 0xF0,
+0xD2, 0xBC, 0xC1, 0xEB, 0xFF, 0xFE, 0x5D, 0x3E, 0xA2, 0xD1, 0xEA, 0xF9, 0xF9, 0xE2, 0xAC, 0x40,
+0x00, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xBF, 0xB4, 0xB4, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF,
+0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0xE7, 0xFF, 0x5A, 0x00, 0x00, 0xA0, 0xFF, 0xF7,
+0xBE, 0xB8, 0x13, 0xA6, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF,
+0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0xFE, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xEC,
+0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0xB1, 0xFF, 0xD2, 0x1E, 0x00, 0x00,
+0x09, 0x66, 0xEC, 0xFF, 0xFF, 0x34, 0xF8, 0xFF, 0xFA, 0xD5, 0xCE, 0xF6, 0xFF, 0xD2, 0xE5, 0xFF,
+0x00, 0x35, 0xB2, 0xED, 0xFB, 0xE7, 0xAF, 0x54, 0x03, 0x9B, 0xFF, 0xCE, 0xFF, 0x87, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x82, 0x6A, 0xFF, 0xE5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2E,
+0xFF, 0xFB, 0x1B, 0x0F, 0xF6, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xAC, 0x00, 0x00,
+0xA1, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xE8, 0xFF, 0x42, 0x00, 0x00, 0x3D, 0xFF, 0xF7, 0x10,
+0x00, 0x00, 0x4D, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x68, 0x00, 0x00, 0xAC, 0xFF,
+0x6C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xC8, 0x00, 0x12, 0xF9, 0xF3, 0x0E, 0x00, 0x00, 0x00,
+0x00, 0x15, 0xFA, 0xFF, 0x28, 0x6B, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF,
+0x88, 0xCA, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xF0, 0xFF, 0xC2, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7E, 0xFF, 0xE7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xB9, 0x00, 0x00,
+0x00, 0x00, 0x30, 0xFF, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x7D, 0x34, 0xFF, 0xF1,
+0x02, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x05, 0xF7, 0xFF, 0x39, 0x02,
+0xEF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0xDD, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF0,
+0x03, 0x00, 0xAF, 0xFF, 0x6A, 0x00, 0x00, 0x35, 0xFF, 0xBE, 0xE5, 0xFF, 0x35, 0x00, 0x00, 0x68,
+0xFF, 0xB0, 0x00, 0x00, 0x6C, 0xFF, 0xA5, 0x00, 0x00, 0x8C, 0xFF, 0x5B, 0x84, 0xFF, 0x92, 0x00,
+0x00, 0x9D, 0xFF, 0x6C, 0x00, 0x00, 0x2A, 0xFF, 0xE0, 0x00, 0x01, 0xE2, 0xF2, 0x0A, 0x21, 0xFE,
+0xEA, 0x04, 0x00, 0xD3, 0xFF, 0x27, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0x1B, 0x3B, 0xFF, 0x9C, 0x00,
+0x00, 0xBA, 0xFF, 0x4C, 0x0B, 0xFC, 0xE3, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0x56, 0x92, 0xFF,
+0x3D, 0x00, 0x00, 0x56, 0xFF, 0xAA, 0x3E, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0x93,
+0xE6, 0xDC, 0x00, 0x00, 0x00, 0x06, 0xEA, 0xF7, 0x83, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x1F,
+0xFF, 0xF3, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF4, 0xFF, 0x17, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xDC, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0x8E,
+0x00, 0x00, 0x00, 0x53, 0xFF, 0xF9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD6, 0xFF, 0xA1, 0x00,
+0x8D, 0xFF, 0xE2, 0x13, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xD3, 0x0A, 0x00, 0x04, 0xC4, 0xFF, 0xB8,
+0x02, 0x00, 0x6B, 0xFF, 0xF2, 0x26, 0x00, 0x00, 0x00, 0x1A, 0xE9, 0xFF, 0x7F, 0x35, 0xF9, 0xFF,
+0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFC, 0xFD, 0xE9, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0xC8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B,
+0xFF, 0xFF, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFC, 0xFD, 0xE9, 0xFF, 0x91,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xE9, 0xFF, 0x7F, 0x36, 0xF9, 0xFF, 0x55, 0x00, 0x00, 0x00,
+0x04, 0xC3, 0xFF, 0xB8, 0x02, 0x00, 0x6B, 0xFF, 0xF2, 0x26, 0x00, 0x00, 0x8D, 0xFF, 0xE2, 0x13,
+0x00, 0x00, 0x00, 0xA6, 0xFF, 0xD3, 0x0A, 0x52, 0xFF, 0xFA, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0C,
+0xD6, 0xFF, 0xA1, 0x83, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0xD2, 0x20,
+0xFE, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0x69, 0x00, 0xBB, 0xFF, 0x94, 0x00,
+0x00, 0x00, 0x00, 0x3B, 0xFF, 0xF2, 0x0C, 0x00, 0x57, 0xFF, 0xED, 0x06, 0x00, 0x00, 0x00, 0x9D,
+0xFF, 0x95, 0x00, 0x00, 0x06, 0xEC, 0xFF, 0x51, 0x00, 0x00, 0x0C, 0xF3, 0xFF, 0x2B, 0x00, 0x00,
+0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x62, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFA,
+0x14, 0x00, 0xC5, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x6E, 0x27, 0xFF, 0xE8,
+0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xCC, 0x8A, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0C, 0xF3, 0xFF, 0xF2, 0xFC, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C,
+0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFF, 0xFF, 0x46, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xD6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1B, 0xE1, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xE6, 0xFF,
+0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFE, 0x93, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF2, 0xFD, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1E, 0xE6, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD5, 0xFF, 0x91, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0xB0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA7, 0xFF,
+0xCA, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xDF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x6A, 0xFF, 0xEE, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFD, 0xF9, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF6, 0xFF, 0xE6, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xCB, 0xFF, 0x5D, 0x00, 0x00,
+0x00, 0x54, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xDE,
+0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x20,
+0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xCE, 0x00, 0x00, 0x06,
+0x46, 0xEA, 0xFF, 0x59, 0x00, 0x00, 0x80, 0xFF, 0xF3, 0x62, 0x00, 0x00, 0x00, 0x61, 0xED, 0xFF,
+0xAD, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xCC, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xE1,
+0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x24, 0x00,
+0x00, 0x00, 0x00, 0xF3, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0x4E, 0x00, 0x00, 0x00,
+0x00, 0xA5, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x02,
+0xC9, 0xFF, 0x60, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF,
+0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF,
+0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28,
+0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x28, 0x36,
+0xFD, 0xE5, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF,
+0xD2, 0x00, 0x00, 0x00, 0x00, 0x23, 0xFF, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x1C,
+0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x45, 0x00, 0x00,
+0x00, 0x00, 0xA8, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFB, 0xF4, 0x50, 0x07, 0x00, 0x00,
+0x00, 0x4A, 0xE6, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x90, 0xFD, 0xF0, 0x61, 0x00, 0x00, 0x5B, 0xFF,
+0xDE, 0x17, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0x73, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0x40, 0x00,
+0x00, 0x00, 0x01, 0xFB, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00,
+0x27, 0xFF, 0xFA, 0x06, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF,
+0x76, 0x00, 0x00, 0x00, 0x37, 0xFE, 0xE5, 0x0D, 0x00, 0x00, 0x00, 0x48, 0x9F, 0xA3, 0x73, 0x2A,
+0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xBE, 0xCC, 0xFB, 0x74, 0x1A, 0x0B,
+0x32, 0x7A, 0xC2, 0xF1, 0xEC, 0x96, 0x00, 0x11, 0x53, 0x61, 0x6E, 0x73, 0x61, 0x74, 0x69, 0x6F,
+0x6E, 0x20, 0x52, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x11, 0x53, 0x61, 0x6E, 0x73, 0x61,
+0x74, 0x69, 0x6F, 0x6E, 0x20, 0x52, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x01
+};
\ No newline at end of file
@@ -0,0 +1,774 @@
+// Generated by tools/clock_atlas.py from fonts/NotoSans_Regular42pt7b.h, do not edit.
+#ifndef CLOCK_DIGITS_h
+#define CLOCK_DIGITS_h
+
+#include "GlyphAtlas.h"
+
+#define CLOCK_DIGITS_COUNT  11
+#define CLOCK_DIGITS_ASCENT 32
+
+const AtlasGlyph clock_digits_glyphs[] PROGMEM = {
+  { 0x0030, 21, 23, 1, 31, 0, 52, 0 },  // '0'
+  { 0x0031, 16, 23, 1, 30, 52, 33, 460 },  // '1'
+  { 0x0032, 21, 23, 1, 31, 85, 34, 725 },  // '2'
+  { 0x0033, 21, 23, 1, 31, 119, 36, 1112 },  // '3'
+  { 0x0034, 23, 23, 0, 30, 155, 37, 1513 },  // '4'
+  { 0x0035, 21, 23, 1, 30, 192, 35, 1906 },  // '5'
+  { 0x0036, 21, 23, 1, 31, 227, 44, 2326 },  // '6'
+  { 0x0037, 21, 23, 1, 30, 271, 30, 2775 },  // '7'
+  { 0x0038, 21, 23, 1, 31, 301, 45, 3088 },  // '8'
+  { 0x0039, 21, 23, 1, 31, 346, 42, 3571 },  // '9'
+  { 0x003A, 8, 14, 3, 24, 388, 16, 4023 },  // ':'
+};
+
+const uint8_t clock_digits_spans[] PROGMEM = {
+  0, 7, 7, 1, 5, 11, 2, 4, 13, 3, 3, 15, 4, 2, 17, 5, 2, 17, 6, 1, 9, 6, 11, 9,
+  7, 1, 8, 7, 13, 7, 8, 1, 7, 8, 13, 8, 9, 0, 8, 9, 13, 8, 10, 0, 8, 10, 14, 7,
+  11, 0, 7, 11, 14, 7, 12, 0, 7, 12, 14, 7, 13, 0, 7, 13, 14, 7, 14, 0, 7, 14, 14, 7,
+  15, 0, 7, 15, 14, 7, 16, 0, 7, 16, 14, 7, 17, 0, 7, 17, 14, 7, 18, 0, 7, 18, 14, 7,
+  19, 0, 7, 19, 14, 7, 20, 0, 7, 20, 14, 7, 21, 0, 8, 21, 14, 7, 22, 0, 8, 22, 13, 8,
+  23, 1, 7, 23, 13, 8, 24, 1, 8, 24, 13, 7, 25, 1, 9, 25, 11, 9, 26, 2, 18, 27, 2, 17,
+  28, 3, 15, 29, 4, 14, 30, 5, 11, 31, 7, 7, 0, 9, 7, 1, 8, 8, 2, 6, 10, 3, 5, 11,
+  4, 4, 12, 5, 3, 13, 6, 1, 15, 7, 0, 16, 8, 1, 15, 9, 2, 5, 9, 9, 7, 10, 2, 4,
+  10, 9, 7, 11, 3, 2, 11, 9, 7, 12, 9, 7, 13, 9, 7, 14, 9, 7, 15, 9, 7, 16, 9, 7,
+  17, 9, 7, 18, 9, 7, 19, 9, 7, 20, 9, 7, 21, 9, 7, 22, 9, 7, 23, 9, 7, 24, 9, 7,
+  25, 9, 7, 26, 9, 7, 27, 9, 7, 28, 9, 7, 29, 9, 7, 0, 7, 7, 1, 4, 13, 2, 3, 15,
+  3, 1, 18, 4, 0, 19, 5, 0, 20, 6, 1, 9, 6, 11, 9, 7, 2, 5, 7, 13, 7, 8, 3, 3,
+  8, 13, 7, 9, 13, 7, 10, 13, 7, 11, 13, 7, 12, 12, 8, 13, 12, 8, 14, 11, 8, 15, 10, 8,
+  16, 9, 9, 17, 8, 9, 18, 7, 9, 19, 6, 9, 20, 5, 9, 21, 5, 8, 22, 4, 8, 23, 3, 8,
+  24, 2, 8, 25, 1, 20, 26, 0, 21, 27, 0, 21, 28, 0, 21, 29, 0, 21, 30, 0, 21, 0, 6, 8,
+  1, 3, 13, 2, 1, 17, 3, 0, 19, 4, 0, 19, 5, 1, 19, 6, 2, 5, 6, 11, 9, 7, 2, 3,
+  7, 12, 8, 8, 13, 7, 9, 13, 7, 10, 13, 7, 11, 12, 7, 12, 10, 9, 13, 4, 14, 14, 4, 12,
+  15, 4, 12, 16, 4, 14, 17, 4, 15, 18, 9, 11, 19, 12, 9, 20, 13, 8, 21, 14, 7, 22, 14, 7,
+  23, 13, 8, 24, 0, 2, 24, 13, 8, 25, 0, 5, 25, 11, 10, 26, 0, 20, 27, 0, 20, 28, 0, 19,
+  29, 0, 18, 30, 0, 16, 31, 4, 9, 0, 12, 7, 1, 11, 8, 2, 10, 9, 3, 10, 9, 4, 9, 10,
+  5, 8, 11, 6, 8, 11, 7, 7, 12, 8, 6, 13, 9, 6, 13, 10, 5, 14, 11, 4, 7, 11, 12, 7,
+  12, 4, 7, 12, 12, 7, 13, 3, 7, 13, 12, 7, 14, 3, 6, 14, 12, 7, 15, 2, 7, 15, 12, 7,
+  16, 1, 7, 16, 12, 7, 17, 1, 6, 17, 12, 7, 18, 0, 23, 19, 0, 23, 20, 0, 23, 21, 0, 23,
+  22, 0, 23, 23, 0, 23, 24, 12, 7, 25, 12, 7, 26, 12, 7, 27, 12, 7, 28, 12, 7, 29, 12, 7,
+  0, 2, 17, 1, 2, 17, 2, 2, 17, 3, 2, 17, 4, 2, 17, 5, 2, 17, 6, 1, 7, 7, 1, 7,
+  8, 1, 7, 9, 1, 7, 10, 1, 7, 10, 9, 4, 11, 1, 15, 12, 1, 17, 13, 1, 18, 14, 1, 19,
+  15, 1, 19, 16, 2, 6, 16, 9, 11, 17, 12, 9, 18, 13, 8, 19, 13, 8, 20, 13, 8, 21, 13, 8,
+  22, 13, 8, 23, 0, 3, 23, 12, 8, 24, 0, 6, 24, 10, 10, 25, 0, 20, 26, 0, 19, 27, 0, 18,
+  28, 0, 17, 29, 1, 15, 30, 4, 9, 0, 11, 8, 1, 8, 11, 2, 6, 13, 3, 5, 14, 4, 4, 15,
+  5, 3, 16, 6, 2, 10, 6, 18, 1, 7, 2, 8, 8, 2, 7, 9, 1, 7, 10, 1, 6, 11, 1, 6,
+  11, 9, 7, 12, 0, 7, 12, 8, 10, 13, 0, 19, 14, 0, 20, 15, 0, 20, 16, 0, 21, 17, 0, 9,
+  17, 13, 8, 18, 0, 8, 18, 14, 7, 19, 0, 8, 19, 14, 7, 20, 0, 7, 20, 14, 7, 21, 0, 8,
+  21, 14, 7, 22, 0, 8, 22, 14, 7, 23, 1, 7, 23, 14, 7, 24, 1, 8, 24, 13, 8, 25, 1, 9,
+  25, 12, 9, 26, 2, 18, 27, 2, 18, 28, 3, 16, 29, 4, 14, 30, 5, 12, 31, 8, 6, 0, 0, 21,
+  1, 0, 21, 2, 0, 21, 3, 0, 21, 4, 0, 21, 5, 0, 21, 6, 13, 7, 7, 12, 8, 8, 12, 8,
+  9, 11, 8, 10, 11, 8, 11, 11, 7, 12, 10, 8, 13, 10, 7, 14, 9, 8, 15, 9, 8, 16, 8, 8,
+  17, 8, 8, 18, 8, 7, 19, 7, 8, 20, 7, 8, 21, 6, 8, 22, 6, 8, 23, 5, 8, 24, 5, 8,
+  25, 5, 7, 26, 4, 8, 27, 4, 8, 28, 3, 8, 29, 3, 8, 0, 7, 7, 1, 5, 12, 2, 3, 15,
+  3, 2, 17, 4, 2, 18, 5, 1, 19, 6, 1, 8, 6, 12, 8, 7, 1, 7, 7, 13, 7, 8, 1, 7,
+  8, 13, 7, 9, 1, 7, 9, 13, 7, 10, 1, 8, 10, 12, 8, 11, 2, 8, 11, 11, 8, 12, 2, 17,
+  13, 3, 15, 14, 4, 13, 15, 5, 11, 16, 3, 15, 17, 2, 17, 18, 1, 19, 19, 1, 8, 19, 12, 8,
+  20, 0, 8, 20, 13, 8, 21, 0, 7, 21, 14, 7, 22, 0, 7, 22, 14, 7, 23, 0, 7, 23, 14, 7,
+  24, 0, 7, 24, 14, 7, 25, 0, 8, 25, 13, 8, 26, 0, 21, 27, 1, 19, 28, 1, 18, 29, 2, 16,
+  30, 4, 13, 31, 7, 7, 0, 7, 6, 1, 4, 12, 2, 3, 14, 3, 2, 16, 4, 1, 18, 5, 1, 18,
+  6, 0, 9, 6, 11, 9, 7, 0, 8, 7, 12, 8, 8, 0, 7, 8, 13, 8, 9, 0, 7, 9, 13, 8,
+  10, 0, 7, 10, 14, 7, 11, 0, 7, 11, 14, 7, 12, 0, 7, 12, 14, 7, 13, 0, 8, 13, 13, 8,
+  14, 0, 8, 14, 12, 9, 15, 0, 21, 16, 1, 20, 17, 1, 20, 18, 2, 19, 19, 3, 18, 20, 5, 7,
+  20, 14, 7, 21, 14, 6, 22, 13, 7, 23, 13, 7, 24, 11, 8, 25, 9, 10, 26, 2, 16, 27, 2, 15,
+  28, 2, 15, 29, 2, 13, 30, 2, 12, 31, 2, 8, 0, 2, 4, 1, 0, 7, 2, 0, 8, 3, 0, 8,
+  4, 0, 8, 5, 0, 8, 6, 0, 7, 7, 1, 5, 17, 2, 4, 18, 0, 7, 19, 0, 8, 20, 0, 8,
+  21, 0, 8, 22, 0, 8, 23, 0, 7, 24, 1, 5
+};
+
+const uint16_t clock_digits_day[] PROGMEM = {
+  0x0861, 0x4208, 0x630C, 0x6B6D, 0x632C, 0x4208, 0x0861, 0x2965, 0xAD75, 0xF7BE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9D33, 0x1903, 0x6B4D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x52AA, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x31C6, 0xF7BE,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xEF9D, 0x2965, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0xAD95,
+  0xD6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD95, 0x39E7, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x8C91, 0x0020, 0x0000, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x31C6, 0x8CB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x0000, 0xBDF7, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0xD6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D,
+  0x528A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x0000, 0x18E3, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x2124, 0x0861, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965,
+  0x4228, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x5ACB, 0x634C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0xAD95, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C0F, 0x8450, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5D6,
+  0x94D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xA554, 0x7C0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x9D13, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17, 0xA574,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D2, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xCE79, 0xA554, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D2, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xCE79, 0x9D13, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x7BEF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x8CB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA554,
+  0x7C0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5D6, 0x7C2F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xB5F6, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA574, 0x5B0B, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8450, 0x39C7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x634C, 0x0881, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2144, 0x0861, 0xF7DE,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3A07, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x6B6D, 0x528A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x0040, 0x73CE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6,
+  0x18E3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CB1, 0x0020, 0x0000, 0x7C2F, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x94D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xDF1B, 0xB5D6, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6DA, 0x0000,
+  0x18C3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x39E7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C0F, 0x3A07, 0xDF1B, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x73CE, 0x0000, 0x10A2, 0x8C91,
+  0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xAD95, 0x2985, 0x0020, 0x31A6, 0x52AA,
+  0x630C, 0x5ACB, 0x39E7, 0x0861, 0x2965, 0xD6DA, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xB5D6, 0x52CA,
+  0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0x8450, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x10A2, 0xB5F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x2985, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x5AEB, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0020, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5D6, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7,
+  0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0020, 0x73CE, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xBDF7, 0xA534, 0xFFFF, 0xFFFF, 0xF7DE, 0x73CE, 0x7C0F, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xBDF7, 0x0040, 0xC658, 0xEF7D, 0x4248, 0x8450, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xBDF7, 0x18E3, 0x2124, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7,
+  0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x8C91, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0861, 0x39C7, 0x52AA, 0x5B0B, 0x52AA, 0x4208, 0x0881,
+  0x0040, 0x634C, 0xBE17, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xC638, 0x5AEB,
+  0x0020, 0x528A, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xC638, 0x1903, 0x0861, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x18E3, 0x18C3, 0xCE99,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0861, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xF7BE, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x4208, 0x18E3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8C71, 0x2965, 0x0000, 0x1082, 0x94B2,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CB1, 0x31A6, 0xEF9D, 0xFFFF, 0xBE17, 0x2124,
+  0xB5D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x52AA, 0x8C91, 0x0020, 0x6B6D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C,
+  0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x8CB1, 0x2144, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0xAD75, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x4A69, 0x2965, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA554, 0x10C2, 0xDEFB,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x0881, 0x0881, 0xCE99, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xEF9D, 0x31A6, 0x0040, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE,
+  0x4A69, 0x0020, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x5AEB, 0x0000, 0xA534,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x630C, 0x8CB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x6B4D, 0x7C0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D, 0x6B8D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B8D, 0x5AEB, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x6B8D, 0x4A69, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x528A,
+  0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x3A07, 0x2965,
+  0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xC658, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x4A69,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x10C2, 0x31C6, 0x4A69, 0x5AEB,
+  0x5ACB, 0x4A69, 0x2144, 0x0000, 0x31A6, 0x94B2, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xEF9D, 0xA554, 0x4A69, 0x3A07, 0xC658, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17, 0x18E3, 0x73CE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x1903, 0x1903, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7,
+  0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75C, 0xC658, 0xB5D6, 0xCE99, 0xF7DE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x8450, 0xFFFF, 0xEF9D, 0x8C71, 0x2985,
+  0x18E3, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x0020, 0x8450, 0x18E3,
+  0x10A2, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CB1, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x8450, 0x9D13, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0xD6BA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x18E3, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D2,
+  0x10C2, 0x7C2F, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x0861, 0x18E3, 0x94B2, 0x94B2,
+  0x94F2, 0xA554, 0xCE79, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5D6, 0x1082, 0x3186,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xBE17, 0x528A, 0x3186,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x6B4D, 0x2124, 0x3186,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658,
+  0x4228, 0x2945, 0xD6DA, 0xD6DA, 0xDEFB, 0xE75C, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0020, 0x2985, 0x7BCF, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x634C, 0x0861, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75C, 0x0040,
+  0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4248, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x6B8D, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x10C2, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x52AA, 0x0861, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x31C6, 0xCE99, 0xEF7D, 0x94D2, 0x4A69, 0x0861, 0x1903, 0x9CF3, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x0000, 0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE,
+  0xD6DA, 0xADB5, 0x9D13, 0x9CF3, 0xAD75, 0xCE99, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x738E, 0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x0020, 0xCE99,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x10A2, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x8450, 0x0040,
+  0x0000, 0x4248, 0x94D2, 0xD6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xF7DE, 0xCE79, 0x7BEF, 0x10C2, 0x0861, 0x2985, 0x4A69, 0x52CA, 0x630C, 0x5ACB, 0x4A49, 0x31A6,
+  0x0040, 0x7BEF, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0x9CF3, 0x2965, 0xF7BE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x0000, 0xC658, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x9D13, 0x73CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x2144, 0xF7BE,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x0000, 0xC638, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x2124, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6DA,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,
+  0x6B8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x6B4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x9CF3, 0x5B0B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x1903, 0xEF9D, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xF7BE, 0x18E3, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x0000, 0xB5D6,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C0F, 0x73CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13,
+  0x632C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x0020, 0x7C0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x9D13, 0x18E3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x31A6, 0x8430, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0xAD95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x8430, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x0020,
+  0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x10C2, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xF7DE, 0x31C6, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0xAD75, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x8450, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x52AA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x2965, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x94B2, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x2104, 0x2104, 0x2104, 0x0040, 0xDEFB, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0xB5B6, 0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xC638,
+  0xC638, 0xC638, 0xC638, 0xC638, 0xC638, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C,
+  0xC638, 0xC638, 0xC638, 0x2985, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x8430,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x9D13, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x9D13, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x8450, 0xF7DE,
+  0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE, 0xF7DE,
+  0xF7DE, 0xF7DE, 0x4A69, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0xAD95, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x4A69, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0xE73C,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
+  0x630C, 0x630C, 0x630C, 0x18E3, 0x0000, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x0881,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x2104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xB5B6, 0x31A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x4248, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x8450, 0x0861, 0x1903, 0x1903, 0x0861, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xDEFB, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x9D13, 0x39E7, 0x6B6D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xB5B6, 0x10A2, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x10C2, 0x8C91, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xC658, 0x0000, 0x4A49, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEB, 0x0020,
+  0x6B8D, 0x7BEF, 0x4228, 0x18E3, 0x0000, 0x0040, 0x31A6, 0x7C2F, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x2144, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE,
+  0x10A2, 0x6B4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x18E3, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x0040, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x528A, 0x10C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x52CA, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x2124, 0x52AA, 0x0000, 0x0861, 0xCE99, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x39C7, 0xFFFF, 0xDF1B, 0x8C91, 0x4228, 0x0881, 0x0000, 0x4248,
+  0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C0F, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xDF1B, 0xC658, 0xB5F6, 0xC658, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xE75C, 0x0881, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52CA, 0x39C7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x738E, 0x2985, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x3A07, 0x1903, 0x7C0F,
+  0xC658, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0xB5D6, 0x52AA,
+  0x0000, 0x0040, 0x2965, 0x4A49, 0x52CA, 0x630C, 0x52CA, 0x4228, 0x2965, 0x0000, 0x0040, 0x2945,
+  0x39E7, 0x4A49, 0x4A69, 0x4228, 0x31A6, 0x0881, 0x1903, 0x8430, 0xC658, 0xF7BE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x18C3, 0xA554, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x4A69, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x5ACB, 0xF7DE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x2985,
+  0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0xBDF7, 0xAD75, 0x9D13,
+  0xAD95, 0xCE79, 0xBE17, 0x0000, 0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75C, 0x7BCF,
+  0x2124, 0x0000, 0x630C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0881, 0xD6BA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x0020, 0x31C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2985,
+  0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E,
+  0x0000, 0x39C7, 0x634C, 0x73AE, 0x632C, 0x4208, 0x0020, 0x0000, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x3A07, 0x5B0B, 0xD6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x8C91, 0x10A2,
+  0x18E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18C3, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x2965, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xF7DE, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xE73C, 0x10A2, 0x4248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D33, 0x52AA,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD95, 0x6B6D, 0x634C, 0x9D13,
+  0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x18C3, 0x632C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x52CA, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x634C, 0x634C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0xBE17, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0841,
+  0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17, 0x4A49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xDEFB, 0x4A89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0x31A6, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x0000, 0x4228, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99,
+  0x0020, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x52CA, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xBDF7, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x8C71, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x73CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB,
+  0x0861, 0x0861, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x10A2, 0xF7BE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5D6, 0x0881, 0x0861, 0xADB5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xF7DE, 0x1903, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xB5B6,
+  0xAD95, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA554, 0x0040, 0xD6DA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xEF7D, 0x2124, 0x2965, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x52AA, 0x1903, 0xC658, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75C, 0x4228, 0x0000, 0x5AEB, 0xC638,
+  0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x7C0F, 0x0881, 0x10A2, 0x3A07, 0x52CA,
+  0x5AEB, 0x4248, 0x2124, 0xCE79, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D,
+  0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xB5F6,
+  0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0xDEFB, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xC658, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2,
+  0x52AA, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C,
+  0x630C, 0x7C2F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965, 0x8C91, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0861, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA,
+  0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x0000, 0x0000, 0xD6DA, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x10A2,
+  0xB5D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D33, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x39C7, 0x94D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x0881, 0xEF9D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xE75C, 0x0040, 0x0000, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8450, 0x52AA, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x1903, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xAD95, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4248, 0x9D13, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xD6DA, 0x0000, 0x10A2, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x6B8D, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x0881, 0x0020, 0xE73C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D2, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x2965, 0xC658, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0xA554, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x0020,
+  0x18E3, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xF7BE, 0x10C2, 0x0020, 0x2985, 0x4A69, 0x52CA, 0x4A69, 0x31C6, 0x0841, 0x4A69,
+  0xAD95, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xBE17, 0x632C, 0x0020, 0x10A2,
+  0xB5D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xD6BA, 0x2985, 0x10A2, 0xD6DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x2985, 0xAD95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,
+  0x0020, 0x2144, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x6B8D, 0x4A69, 0x634C,
+  0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xDF1B, 0x0881, 0x0020, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2,
+  0x8450, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7C0F, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xAD95, 0x8450, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x39E7, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xAD95, 0x632C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C91, 0x632C,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8450, 0x18E3, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xEF7D, 0x10C2, 0x0040, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0xA534, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x2144, 0x10A2, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xBDF7, 0x18C3, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CF3, 0xE75C,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1B, 0x18E3, 0x2144, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x2124, 0x1903, 0xC638,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x7BEF, 0x0040, 0x3A07,
+  0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x2144, 0x0881, 0x9D13,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8430,
+  0x0020, 0x18E3, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17, 0x0881, 0x0040, 0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xEF7D, 0x6B8D, 0x18E3, 0xA574, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,
+  0x0020, 0x8450, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x2144, 0x632C, 0xF7BE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0861, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE,
+  0x2965, 0x4A89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x18E3, 0x4A49, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x94D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D, 0x6B8D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B0B, 0x4228, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x94B2, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B0B, 0x39E7, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x9D13, 0x634C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D13, 0x73CE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x39E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE,
+  0x4248, 0x2144, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x0000, 0xE73C, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x9D13, 0x52AA, 0x3A07, 0x528A, 0x8C71, 0xEF9D, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x0020, 0x634C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x5AEB, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8470, 0x0000, 0x8430, 0xF7BE, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x6B6D, 0x2124,
+  0x8470, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6DA, 0x7BEF, 0x10C2,
+  0x18C3, 0x4228, 0x52AA, 0x630C, 0x52AA, 0x4228, 0x10C2, 0x0841, 0x2985, 0x4228, 0x4228, 0x2985,
+  0x0861, 0x0000, 0x52AA, 0xB5D6, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xB5F6, 0x5AEB,
+  0x0000, 0x18E3, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xCE79, 0x2965, 0x2124, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75C, 0x31C6, 0x0020, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C,
+  0x10A2, 0x6B8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE99, 0xC638, 0xEF9D,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x0000, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xD6DA, 0x2965, 0x0881, 0xA554, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x2965, 0x31A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x2985, 0x0020, 0xC638, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D2, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBE17,
+  0x3A07, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75C, 0x0000, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x8430, 0x0000, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2144, 0xA534,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B8D, 0xB5D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x5B0B, 0xA554, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73CE, 0xA554, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x7BCF, 0x94D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0xC658, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8450, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB,
+  0x0000, 0x2985, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D2, 0x4228, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D, 0x2124, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x94B2, 0x0040, 0xE75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x9CF3, 0x52AA,
+  0x4A69, 0x7C0F, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8450, 0x8430,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0841, 0xD6DA, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0xCE99, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x6B6D, 0x2144, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xC658, 0x0861, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x10A2, 0x94B2,
+  0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x94B2, 0x0040, 0x0861, 0xF7DE, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0x2965, 0x0861, 0x528A, 0x73CE, 0x8450, 0x7C2F, 0x5AEB, 0x0881, 0x39E7,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x0020, 0x8450, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5D6,
+  0x0841, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B8D, 0x8C91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xF7BE, 0x10A2, 0x0000, 0x7C0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0020, 0x4A69,
+  0xC658, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x18E3, 0x8430, 0xB5F6, 0x94D2, 0x8450,
+  0x8C91, 0x9D13, 0xBDF7, 0xEF9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D,
+  0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0x9CF3, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x4208, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0xA554, 0x4248, 0x0000, 0x10C2, 0x4228, 0x52CA, 0x630C, 0x5B0B,
+  0x528A, 0x4208, 0x1903, 0x2124, 0x4A69, 0x3A07, 0x0861, 0x0040, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xE75C, 0x52AA, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x1082, 0xB5D6, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0x52AA, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x1903, 0x1082, 0xDEFB,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0040, 0x632C, 0x8C71, 0x7C0F, 0x39E7, 0x31A6, 0x5AEB,
+  0x4A89, 0x10A2, 0x0861, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x632C, 0x7C0F, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x10A2, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x4A89, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x8450, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x18E3, 0x0861, 0xCE99, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0x6B6D,
+  0x0020, 0x52AA, 0x7BEF, 0x738E, 0x2965
+};
+
+const uint16_t clock_digits_night[] PROGMEM = {
+  0x0800, 0x2000, 0x3000, 0x3800, 0x3000, 0x2000, 0x0000, 0x1000, 0x5800, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x5000, 0x1000, 0x3000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x2800, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x1800, 0x7800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7800, 0x1000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x5800,
+  0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x1800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x4800, 0x0000, 0x0000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x1800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0000, 0x6000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000,
+  0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000, 0x0800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x1000, 0x0000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1000,
+  0x2000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x2800, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x5800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800,
+  0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x5000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x5000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x5000, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x5000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x6800, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x3800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6800, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000,
+  0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x5800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6800, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x1800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x3000, 0x0800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1000, 0x0000, 0x7800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x3000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0000, 0x3800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6800, 0x0000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800,
+  0x1000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x0000, 0x0000, 0x4000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7000, 0x5800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0000,
+  0x0800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x1800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x2000, 0x7000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x3800, 0x0000, 0x0800, 0x4800,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5800, 0x1800, 0x0000, 0x1800, 0x2800,
+  0x3000, 0x2800, 0x1800, 0x0000, 0x1800, 0x6800, 0x7800, 0x7800, 0x7800, 0x7800, 0x5800, 0x2800,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x4000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0800, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6000, 0x1800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6000, 0x2800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x6000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000,
+  0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x3800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x5000, 0x8000, 0x8000, 0x7800, 0x3800, 0x4000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x0000, 0x6000, 0x7800, 0x2000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x6000, 0x0800, 0x1000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000,
+  0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x4800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x1800, 0x2800, 0x3000, 0x2800, 0x2000, 0x0800,
+  0x0000, 0x3000, 0x6000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x6000, 0x2800,
+  0x0000, 0x2800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x1000, 0x0000, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0800, 0x0800, 0x6800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x2000, 0x0800, 0x7000, 0x8000, 0x8000, 0x8000, 0x7800, 0x4800, 0x1000, 0x0000, 0x0800, 0x4800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x1800, 0x7800, 0x8000, 0x6000, 0x1000,
+  0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x2800, 0x4800, 0x0000, 0x3800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000,
+  0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x4800, 0x1000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x5800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x2000, 0x1000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0800, 0x7000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0800, 0x0800, 0x6800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7800, 0x1800, 0x0000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x2800, 0x0000, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x2800, 0x0000, 0x5000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x3000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x3800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x3000, 0x7800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3800, 0x2800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2800,
+  0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2800, 0x2000, 0x1000,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x6000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0800, 0x1800, 0x2000, 0x3000,
+  0x2800, 0x2000, 0x1000, 0x0000, 0x1800, 0x4800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7800, 0x5000, 0x2000, 0x2000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0800, 0x3800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7000, 0x1000, 0x1000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000,
+  0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x6000, 0x5800, 0x6800, 0x7800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1800, 0x4000, 0x8000, 0x7800, 0x4800, 0x1800,
+  0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x0000, 0x4000, 0x0800,
+  0x0800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x5800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x4000, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x6800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800,
+  0x0800, 0x4000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0000, 0x0800, 0x4800, 0x4800,
+  0x4800, 0x5000, 0x6800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x0800, 0x1800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x6000, 0x2800, 0x1800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x3000, 0x1000, 0x1800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000,
+  0x2000, 0x1000, 0x6800, 0x6800, 0x7000, 0x7000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x4000, 0x0000, 0x1800, 0x3800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3000, 0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000,
+  0x1000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x7000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x0800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x2800, 0x0000, 0x4800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x1800, 0x6800, 0x7800, 0x4800, 0x2000, 0x0000, 0x1000, 0x5000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x6800, 0x5800, 0x5000, 0x5000, 0x5800, 0x6800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x6800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x4000, 0x0000,
+  0x0000, 0x2000, 0x4800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x7800, 0x6800, 0x3800, 0x0800, 0x0800, 0x1800, 0x2000, 0x2800, 0x3000, 0x2800, 0x2000, 0x1800,
+  0x0000, 0x4000, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x5000, 0x1000, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x5000, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x1000, 0x7800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x6000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x1000, 0x7800, 0x8000, 0x8000, 0x8000, 0x6800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x6000, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x5000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x1000, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x7800, 0x0800, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x5800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000,
+  0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x5000, 0x0800, 0x7800, 0x8000, 0x8000, 0x8000, 0x7800, 0x1800, 0x4000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x5000, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x4000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0000,
+  0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0800, 0x7000, 0x8000, 0x8000, 0x8000,
+  0x7800, 0x1800, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x5800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x4000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x2800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x4800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x1000, 0x1000, 0x1000, 0x0000, 0x7000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x7000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x5800, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x6000,
+  0x6000, 0x6000, 0x6000, 0x6000, 0x6000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000,
+  0x6000, 0x6000, 0x6000, 0x1800, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x4000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x5000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x4000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x5000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x4000, 0x7800,
+  0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800,
+  0x7800, 0x7800, 0x2000, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x5800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x2800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x7000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x3000, 0x3000, 0x0800, 0x0000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x1000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x5800, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x2000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x4000, 0x0800, 0x1000, 0x1000, 0x0000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x5000, 0x2000, 0x3000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x5800, 0x0800, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0800, 0x4800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x0000, 0x2000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x0000,
+  0x3800, 0x3800, 0x2000, 0x0800, 0x0000, 0x0000, 0x1800, 0x4000, 0x7800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6000, 0x1000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x0800, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x1000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x0000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x2800, 0x0800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1800, 0x2800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x0800, 0x1000, 0x2800, 0x0000, 0x0000, 0x6800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6800, 0x1800, 0x8000, 0x7000, 0x4800, 0x2000, 0x0800, 0x0000, 0x2000,
+  0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x1800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7000, 0x6000, 0x5800, 0x6000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7000, 0x0800, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x1800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x3800, 0x1800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x2000, 0x1000, 0x4000,
+  0x6000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5800, 0x2800,
+  0x0000, 0x0000, 0x1000, 0x2000, 0x2800, 0x3000, 0x2800, 0x2000, 0x1000, 0x0000, 0x0000, 0x1000,
+  0x1800, 0x2000, 0x2800, 0x2000, 0x1800, 0x0800, 0x1000, 0x4000, 0x6000, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0800, 0x5000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2800, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x1800,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x6000, 0x5800, 0x5000,
+  0x5800, 0x6800, 0x6000, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x3800,
+  0x1000, 0x0000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0800, 0x6800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1800,
+  0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800,
+  0x0000, 0x1800, 0x3000, 0x3800, 0x3000, 0x2000, 0x0000, 0x0000, 0x7800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x2000, 0x3000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x4800, 0x0800,
+  0x1000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x1800, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x7800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7000, 0x0800, 0x2000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x2800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x3000, 0x3000, 0x5000,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x3000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x2800, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x3000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x6000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x5000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0000,
+  0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x2000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7000, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x1800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x0000, 0x2000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800,
+  0x0000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0800, 0x2800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x4800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000,
+  0x0000, 0x0000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x0800, 0x7800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x0800, 0x0800, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7800, 0x1000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5800,
+  0x5800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x6800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7800, 0x1000, 0x1000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x2800, 0x1000, 0x6000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x2000, 0x0000, 0x2800, 0x6000,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x4000, 0x0800, 0x0800, 0x2000, 0x2800,
+  0x2800, 0x2000, 0x1000, 0x6800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800,
+  0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0x5800,
+  0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x7000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800,
+  0x2800, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000,
+  0x3000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1000, 0x4800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6000, 0x0000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800,
+  0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000, 0x0000, 0x6800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x3800, 0x2000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0800,
+  0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x1000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x1800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x0800, 0x7800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x7000, 0x0000, 0x0000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x2800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x1000, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x5800, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x5000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x6800, 0x0000, 0x0800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x3800, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x0000, 0x7000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x1800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x1800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x2800, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000,
+  0x0800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x4000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7800, 0x0800, 0x0000, 0x1800, 0x2000, 0x2800, 0x2800, 0x1800, 0x0000, 0x2000,
+  0x5800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x6000, 0x3000, 0x0000, 0x0800,
+  0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x6800, 0x1800, 0x0800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x1800, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800,
+  0x0000, 0x1000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x3800, 0x2000, 0x3000,
+  0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x3800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x7000, 0x0800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800,
+  0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x5800, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x1800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x5800, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x3000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x0800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x7800, 0x0800, 0x0000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2000, 0x5000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x1000, 0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x6000, 0x0800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5000, 0x7000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x1000, 0x1000, 0x7000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x1000, 0x1000, 0x6000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x4000, 0x0000, 0x2000,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x1000, 0x0800, 0x5000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x4000,
+  0x0000, 0x0800, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x6000, 0x0800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x7800, 0x3800, 0x0800, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000,
+  0x0000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x1000, 0x3000, 0x7800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x0000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x1800, 0x2800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x2000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x5000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x3800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x2000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x4800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x1800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x5000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x3800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800,
+  0x2000, 0x1000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x0000, 0x7000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5000, 0x2800, 0x2000, 0x2800, 0x4800, 0x7800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000, 0x3000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x2800, 0x0000, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x0000, 0x4000, 0x7800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x3000, 0x1000,
+  0x4000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x4000, 0x0800,
+  0x0800, 0x2000, 0x2800, 0x3000, 0x2800, 0x2000, 0x0800, 0x0000, 0x1800, 0x2000, 0x2000, 0x1800,
+  0x0000, 0x0000, 0x2800, 0x5800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5800, 0x3000,
+  0x0000, 0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x6800, 0x1000, 0x1000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x1800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000,
+  0x0800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x6000, 0x7800,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800, 0x0000, 0x7000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6800, 0x1000, 0x0800, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x1000, 0x1800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x1800, 0x0000, 0x6000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6000,
+  0x2000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000, 0x0000, 0x4800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x4000, 0x0000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x1000, 0x5000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x5800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x3000, 0x5000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x5000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x6000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7000,
+  0x0000, 0x1800, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x2000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x3000, 0x1000, 0x6800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x4800, 0x0000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x5000, 0x2800,
+  0x2800, 0x4000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x4000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x6800, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x3800, 0x1000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x6000, 0x0800, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x0800, 0x4800,
+  0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x4800, 0x0000, 0x0000, 0x7800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x1800, 0x0800, 0x2800, 0x3800, 0x4000, 0x4000, 0x3000, 0x0800, 0x2000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5800,
+  0x0000, 0x7000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x7800, 0x0800, 0x0000, 0x4000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x5000, 0x0000, 0x2000,
+  0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x1000, 0x4000, 0x5800, 0x4800, 0x4000,
+  0x4800, 0x5000, 0x6000, 0x7800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x3000,
+  0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x5000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4800, 0x0000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x6800, 0x2000, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7000, 0x5000, 0x2000, 0x0000, 0x0800, 0x2000, 0x2800, 0x3000, 0x3000,
+  0x2800, 0x2000, 0x1000, 0x1000, 0x2000, 0x2000, 0x0000, 0x0000, 0x5800, 0x8000, 0x8000, 0x8000,
+  0x7000, 0x2800, 0x3800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x5800, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x2800, 0x4800, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x7800, 0x1000, 0x0800, 0x7000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x4000, 0x0000, 0x3000, 0x4800, 0x4000, 0x1800, 0x1800, 0x2800,
+  0x2800, 0x0800, 0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x7800, 0x3000, 0x4000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x2800, 0x6000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x2800, 0x4000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x7800, 0x0800, 0x0000, 0x6800, 0x8000, 0x8000, 0x8000, 0x7800, 0x3000,
+  0x0000, 0x2800, 0x4000, 0x3800, 0x1000
+};
+
+#endif
@@ -1,3 +1,4 @@
+// Generated by tools/font_subset.py from fonts/NotoSans_Regular16pt7b.h, do not edit.
 /* The font vlw file can be converted to a byte array using:
 
    https://tomeko.net/online_tools/file_to_hex.php?lang=en
@@ -18,7 +19,7 @@
 
 
 const uint8_t  NotoSansBold16[] PROGMEM = {
-0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xF0,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
@@ -30,90 +31,69 @@ const uint8_t  NotoSansBold16[] PROGMEM = {
 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xF0,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03,
 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11,
 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06,
 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x04,
 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0C,
 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0D,
 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09,
 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0A,
+0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09,
 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x0C,
 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B,
 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C,
@@ -124,643 +104,348 @@ const uint8_t  NotoSansBold16[] PROGMEM = {
 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A,
 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57,
 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20,
-0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xB3, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x0F,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x5A, 0x6C, 0x5B, 0xCC, 0xFF, 0xCF, 0xBF, 0xFF, 0xC1, 0xB2, 0xFF, 0xB3, 0xA5, 0xFF, 0xA6,
-0x98, 0xFF, 0x98, 0x8A, 0xFF, 0x8B, 0x7D, 0xFF, 0x7D, 0x17, 0x34, 0x17, 0x24, 0x6A, 0x21, 0xCB,
-0xFF, 0xC5, 0xB3, 0xFF, 0xAC, 0x06, 0x2E, 0x05, 0x26, 0xAC, 0x99, 0x00, 0x9F, 0xAC, 0x20, 0x29,
-0xFF, 0xD4, 0x00, 0xDD, 0xFF, 0x20, 0x16, 0xFF, 0xC1, 0x00, 0xCA, 0xFF, 0x0D, 0x04, 0xFE, 0xAE,
-0x00, 0xB7, 0xF9, 0x00, 0x00, 0x6E, 0x48, 0x00, 0x4C, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20,
-0x10, 0x00, 0x1E, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0x65, 0x0F, 0xFF, 0xA0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x35, 0x3F, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x82, 0xA0, 0xDD,
-0xFF, 0xA7, 0xC3, 0xFF, 0xBC, 0xA0, 0x07, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x0C, 0x00, 0x00, 0x0F, 0xFE, 0xA2, 0x00, 0xD6, 0xDD, 0x00, 0x00, 0x00, 0x12, 0x30, 0x62,
-0xFF, 0x8E, 0x35, 0xFD, 0xBC, 0x30, 0x18, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x84, 0x00, 0x28, 0x6C, 0xD0, 0xFE, 0x6E, 0xB2, 0xFF, 0x8F, 0x6C, 0x37, 0x00, 0x00, 0x00,
-0xD2, 0xDD, 0x00, 0xA0, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0xAF, 0x00, 0xD0, 0xE8,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x04, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x97, 0xDD, 0xFF, 0xF0, 0xCE, 0x87, 0x10, 0x0C,
-0xDD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xEB, 0x06, 0x44, 0xFF, 0xFF, 0x3F, 0xFF, 0x16, 0x37, 0x4D,
-0x00, 0x2D, 0xFF, 0xFF, 0x9F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xB3,
-0x41, 0x00, 0x00, 0x00, 0x00, 0x49, 0xC1, 0xFF, 0xFF, 0xFF, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x04,
-0xFF, 0xAB, 0xFF, 0xFF, 0x4B, 0x35, 0x68, 0x1C, 0x04, 0xFF, 0x24, 0xF9, 0xFF, 0x59, 0x50, 0xFF,
-0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xE8, 0x15, 0x1E, 0x96, 0xD5, 0xF2, 0xFF, 0xE2, 0xA2, 0x23, 0x00,
-0x00, 0x00, 0x00, 0x04, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x94, 0x09, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x76, 0xF7, 0xFF, 0xDD, 0x37, 0x00, 0x00, 0x06, 0xCF, 0xD3, 0x08, 0x00, 0x00, 0x24, 0xFE,
-0xE9, 0x9A, 0xFF, 0xD1, 0x00, 0x00, 0x7E, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x51, 0xFF, 0x90, 0x00,
-0xDA, 0xFE, 0x08, 0x26, 0xF8, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xAD, 0x0B, 0xEC, 0xF7,
-0x02, 0xBF, 0xF0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xFF, 0xFD, 0xFF, 0x9E, 0x62, 0xFF,
-0x67, 0x3B, 0x8D, 0x8E, 0x3C, 0x00, 0x00, 0x18, 0x84, 0xA0, 0x6E, 0x1B, 0xED, 0xC5, 0x3D, 0xFD,
-0xFF, 0xFF, 0xFE, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFA, 0x2C, 0x93, 0xFF, 0x62, 0x53,
-0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x85, 0x00, 0xA0, 0xFF, 0x3F, 0x2C, 0xFF, 0xB5,
-0x00, 0x00, 0x00, 0x09, 0xDD, 0xDC, 0x08, 0x00, 0x6F, 0xFF, 0xBD, 0xB5, 0xFF, 0x87, 0x00, 0x00,
-0x00, 0x87, 0xFF, 0x44, 0x00, 0x00, 0x08, 0xB1, 0xFF, 0xFF, 0xC1, 0x13, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB8, 0xEF, 0xEC,
-0xAE, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEB, 0xFF, 0xED, 0xF3, 0xFF, 0xD5, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x53, 0xFF, 0xE7, 0x09, 0x28, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x4E,
-0xFF, 0xF0, 0x07, 0x47, 0xFF, 0xF6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xEB, 0xFF, 0xB4, 0xF2,
-0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFE, 0x87, 0x01, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x72, 0xFE, 0xFF, 0xFF, 0xFE, 0x64, 0x00, 0x23, 0xFF, 0xFF, 0x54, 0x1E, 0xFC,
-0xFF, 0xA2, 0x5F, 0xFD, 0xFE, 0x64, 0x8B, 0xFF, 0xE9, 0x05, 0x52, 0xFF, 0xFF, 0x38, 0x00, 0x5D,
-0xFD, 0xFE, 0xF9, 0xFF, 0x5F, 0x00, 0x42, 0xFF, 0xFF, 0x9A, 0x11, 0x10, 0xA7, 0xFF, 0xFF, 0xD9,
-0x00, 0x00, 0x04, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x0F,
-0x82, 0xD6, 0xF5, 0xE7, 0xBA, 0x4F, 0x66, 0xFF, 0xFF, 0x84, 0x26, 0xAC, 0x99, 0x29, 0xFF, 0xD4,
-0x16, 0xFF, 0xC1, 0x04, 0xFE, 0xAE, 0x00, 0x6E, 0x48, 0x00, 0x00, 0x37, 0x50, 0x16, 0x00, 0x1D,
-0xF5, 0xE4, 0x08, 0x00, 0xA1, 0xFF, 0x6B, 0x00, 0x0F, 0xF7, 0xFA, 0x12, 0x00, 0x5F, 0xFF, 0xB7,
-0x00, 0x00, 0x97, 0xFF, 0x7F, 0x00, 0x00, 0xC6, 0xFF, 0x4E, 0x00, 0x00, 0xDC, 0xFF, 0x38, 0x00,
-0x00, 0xEB, 0xFF, 0x28, 0x00, 0x00, 0xE4, 0xFF, 0x30, 0x00, 0x00, 0xD3, 0xFF, 0x42, 0x00, 0x00,
-0xAE, 0xFF, 0x6A, 0x00, 0x00, 0x7A, 0xFF, 0x9E, 0x00, 0x00, 0x2F, 0xFF, 0xE6, 0x02, 0x00, 0x00,
-0xCD, 0xFF, 0x43, 0x00, 0x00, 0x4A, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x81, 0xA4, 0x1C, 0x06, 0x4F,
-0x46, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xD5, 0x00, 0x00,
-0x00, 0x00, 0xDA, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x4D, 0xFF,
-0xCA, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
-0x00, 0xF8, 0xFF, 0x1B, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x11, 0x00, 0x00, 0x15, 0xFF, 0xFD, 0x02,
-0x00, 0x00, 0x3E, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0xBE, 0xFF,
-0x54, 0x00, 0x00, 0x1A, 0xFD, 0xEF, 0x07, 0x00, 0x00, 0x91, 0xFF, 0x75, 0x00, 0x00, 0x07, 0x9D,
-0x99, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xEB, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
-0xCA, 0x00, 0x00, 0x00, 0x8A, 0x89, 0x40, 0xD9, 0xB6, 0x49, 0x91, 0x79, 0xD8, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xB7, 0x1F, 0x35, 0xAB, 0xFF, 0xFF, 0x8E, 0x34, 0x1C, 0x00, 0x35, 0xFA, 0xBF,
-0xE4, 0xED, 0x1D, 0x00, 0x00, 0xBB, 0xFF, 0x49, 0x6D, 0xFF, 0x9B, 0x00, 0x00, 0x04, 0x57, 0x01,
-0x07, 0x58, 0x02, 0x00, 0x00, 0x00, 0x00, 0x41, 0xE8, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x48, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x01, 0x08, 0x08, 0x4D, 0xFF, 0x70, 0x08, 0x08, 0x02, 0x28,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x1B, 0xB0, 0xB0, 0xC6, 0xFF, 0xD1, 0xB0, 0xB0,
-0x31, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x6C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x88, 0x39, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x22,
-0x00, 0xD7, 0xFF, 0x6F, 0x08, 0xFC, 0xFF, 0x1F, 0x36, 0xFF, 0xC4, 0x00, 0x5E, 0xE8, 0x5C, 0x00,
-0x20, 0xBC, 0xBC, 0xBC, 0xBC, 0x05, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0x38, 0x38, 0x38,
-0x38, 0x01, 0x00, 0x39, 0x67, 0x10, 0x07, 0xF8, 0xFF, 0x91, 0x03, 0xE4, 0xFF, 0x78, 0x00, 0x0F,
-0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x54, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xC1,
-0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0x35, 0x00, 0x00,
-0x00, 0x1C, 0xFF, 0xED, 0x02, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9,
-0xFF, 0x63, 0x00, 0x00, 0x00, 0x02, 0xEC, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xD7, 0x00,
-0x00, 0x00, 0x00, 0x7B, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x4B, 0x00, 0x00, 0x00,
-0x0C, 0xFA, 0xF9, 0x0B, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF,
-0x79, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xEA, 0x01, 0x00,
-0x00, 0x00, 0x3A, 0xA8, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7D, 0x94, 0x6D, 0x0E,
-0x00, 0x00, 0x00, 0x40, 0xF6, 0xFF, 0xFF, 0xFF, 0xDC, 0x16, 0x00, 0x02, 0xDA, 0xFF, 0xCF, 0x6F,
-0xE8, 0xFF, 0x9F, 0x00, 0x35, 0xFF, 0xFF, 0x36, 0x00, 0x6D, 0xFF, 0xF5, 0x07, 0x63, 0xFF, 0xFD,
-0x04, 0x00, 0x33, 0xFF, 0xFF, 0x30, 0x79, 0xFF, 0xF1, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x4A, 0x7C,
-0xFF, 0xEB, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x50, 0x70, 0xFF, 0xF6, 0x00, 0x00, 0x24, 0xFF, 0xFF,
-0x44, 0x4D, 0xFF, 0xFF, 0x16, 0x00, 0x46, 0xFF, 0xFF, 0x24, 0x10, 0xFA, 0xFF, 0x6C, 0x00, 0x9E,
-0xFF, 0xE4, 0x00, 0x00, 0x94, 0xFF, 0xFE, 0xE3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x08, 0x9E, 0xFB,
-0xFF, 0xF6, 0x8A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x5B, 0x6C, 0x2A, 0x00, 0x00, 0x0F, 0xB2, 0xFF, 0xFF, 0x64, 0x00, 0x2A, 0xD9, 0xFF,
-0xFF, 0xFF, 0x64, 0x14, 0xF1, 0xFF, 0xA2, 0xFC, 0xFF, 0x64, 0x00, 0x77, 0x78, 0x05, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D,
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03,
+0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA,
+0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x6C, 0x5B,
+0xCC, 0xFF, 0xCF, 0xBF, 0xFF, 0xC1, 0xB2, 0xFF, 0xB3, 0xA5, 0xFF, 0xA6, 0x98, 0xFF, 0x98, 0x8A,
+0xFF, 0x8B, 0x7D, 0xFF, 0x7D, 0x17, 0x34, 0x17, 0x24, 0x6A, 0x21, 0xCB, 0xFF, 0xC5, 0xB3, 0xFF,
+0xAC, 0x06, 0x2E, 0x05, 0x00, 0x00, 0x03, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x76, 0xF7, 0xFF, 0xDD, 0x37, 0x00, 0x00, 0x06, 0xCF, 0xD3, 0x08, 0x00, 0x00,
+0x24, 0xFE, 0xE9, 0x9A, 0xFF, 0xD1, 0x00, 0x00, 0x7E, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x51, 0xFF,
+0x90, 0x00, 0xDA, 0xFE, 0x08, 0x26, 0xF8, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xAD, 0x0B,
+0xEC, 0xF7, 0x02, 0xBF, 0xF0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xFF, 0xFD, 0xFF, 0x9E,
+0x62, 0xFF, 0x67, 0x3B, 0x8D, 0x8E, 0x3C, 0x00, 0x00, 0x18, 0x84, 0xA0, 0x6E, 0x1B, 0xED, 0xC5,
+0x3D, 0xFD, 0xFF, 0xFF, 0xFE, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFA, 0x2C, 0x93, 0xFF,
+0x62, 0x53, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x45, 0xFF, 0x85, 0x00, 0xA0, 0xFF, 0x3F, 0x2C,
+0xFF, 0xB5, 0x00, 0x00, 0x00, 0x09, 0xDD, 0xDC, 0x08, 0x00, 0x6F, 0xFF, 0xBD, 0xB5, 0xFF, 0x87,
+0x00, 0x00, 0x00, 0x87, 0xFF, 0x44, 0x00, 0x00, 0x08, 0xB1, 0xFF, 0xFF, 0xC1, 0x13, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xB8,
+0xEF, 0xEC, 0xAE, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEB, 0xFF, 0xED, 0xF3, 0xFF, 0xD5,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xE7, 0x09, 0x28, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00,
+0x00, 0x4E, 0xFF, 0xF0, 0x07, 0x47, 0xFF, 0xF6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xEB, 0xFF,
+0xB4, 0xF2, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFE, 0x87, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xFE, 0xFF, 0xFF, 0xFE, 0x64, 0x00, 0x23, 0xFF, 0xFF, 0x54,
+0x1E, 0xFC, 0xFF, 0xA2, 0x5F, 0xFD, 0xFE, 0x64, 0x8B, 0xFF, 0xE9, 0x05, 0x52, 0xFF, 0xFF, 0x38,
+0x00, 0x5D, 0xFD, 0xFE, 0xF9, 0xFF, 0x5F, 0x00, 0x42, 0xFF, 0xFF, 0x9A, 0x11, 0x10, 0xA7, 0xFF,
+0xFF, 0xD9, 0x00, 0x00, 0x04, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00,
+0x00, 0x0F, 0x82, 0xD6, 0xF5, 0xE7, 0xBA, 0x4F, 0x66, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x37, 0x50,
+0x16, 0x00, 0x1D, 0xF5, 0xE4, 0x08, 0x00, 0xA1, 0xFF, 0x6B, 0x00, 0x0F, 0xF7, 0xFA, 0x12, 0x00,
+0x5F, 0xFF, 0xB7, 0x00, 0x00, 0x97, 0xFF, 0x7F, 0x00, 0x00, 0xC6, 0xFF, 0x4E, 0x00, 0x00, 0xDC,
+0xFF, 0x38, 0x00, 0x00, 0xEB, 0xFF, 0x28, 0x00, 0x00, 0xE4, 0xFF, 0x30, 0x00, 0x00, 0xD3, 0xFF,
+0x42, 0x00, 0x00, 0xAE, 0xFF, 0x6A, 0x00, 0x00, 0x7A, 0xFF, 0x9E, 0x00, 0x00, 0x2F, 0xFF, 0xE6,
+0x02, 0x00, 0x00, 0xCD, 0xFF, 0x43, 0x00, 0x00, 0x4A, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x81, 0xA4,
+0x1C, 0x06, 0x4F, 0x46, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x3B, 0xFF,
+0xD5, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x91, 0x00, 0x00,
+0x00, 0x4D, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+0x0D, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1B, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x11, 0x00, 0x00, 0x15,
+0xFF, 0xFD, 0x02, 0x00, 0x00, 0x3E, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xA1, 0x00, 0x00,
+0x00, 0xBE, 0xFF, 0x54, 0x00, 0x00, 0x1A, 0xFD, 0xEF, 0x07, 0x00, 0x00, 0x91, 0xFF, 0x75, 0x00,
+0x00, 0x07, 0x9D, 0x99, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x22, 0x00, 0xD7, 0xFF, 0x6F, 0x08,
+0xFC, 0xFF, 0x1F, 0x36, 0xFF, 0xC4, 0x00, 0x5E, 0xE8, 0x5C, 0x00, 0x20, 0xBC, 0xBC, 0xBC, 0xBC,
+0x05, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x09, 0x38, 0x38, 0x38, 0x38, 0x01, 0x00, 0x39, 0x67,
+0x10, 0x07, 0xF8, 0xFF, 0x91, 0x03, 0xE4, 0xFF, 0x78, 0x00, 0x0F, 0x2B, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0x54, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x91,
+0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xED, 0x02,
+0x00, 0x00, 0x00, 0x63, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0x63, 0x00, 0x00, 0x00,
+0x02, 0xEC, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF,
+0x91, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x0C, 0xFA, 0xF9, 0x0B, 0x00,
+0x00, 0x00, 0x4D, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00,
+0xD9, 0xFF, 0x33, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xEA, 0x01, 0x00, 0x00, 0x00, 0x3A, 0xA8, 0x75,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7D, 0x94, 0x6D, 0x0E, 0x00, 0x00, 0x00, 0x40, 0xF6,
+0xFF, 0xFF, 0xFF, 0xDC, 0x16, 0x00, 0x02, 0xDA, 0xFF, 0xCF, 0x6F, 0xE8, 0xFF, 0x9F, 0x00, 0x35,
+0xFF, 0xFF, 0x36, 0x00, 0x6D, 0xFF, 0xF5, 0x07, 0x63, 0xFF, 0xFD, 0x04, 0x00, 0x33, 0xFF, 0xFF,
+0x30, 0x79, 0xFF, 0xF1, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x4A, 0x7C, 0xFF, 0xEB, 0x00, 0x00, 0x18,
+0xFF, 0xFF, 0x50, 0x70, 0xFF, 0xF6, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0x44, 0x4D, 0xFF, 0xFF, 0x16,
+0x00, 0x46, 0xFF, 0xFF, 0x24, 0x10, 0xFA, 0xFF, 0x6C, 0x00, 0x9E, 0xFF, 0xE4, 0x00, 0x00, 0x94,
+0xFF, 0xFE, 0xE3, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x08, 0x9E, 0xFB, 0xFF, 0xF6, 0x8A, 0x01, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5B, 0x6C, 0x2A,
+0x00, 0x00, 0x0F, 0xB2, 0xFF, 0xFF, 0x64, 0x00, 0x2A, 0xD9, 0xFF, 0xFF, 0xFF, 0x64, 0x14, 0xF1,
+0xFF, 0xA2, 0xFC, 0xFF, 0x64, 0x00, 0x77, 0x78, 0x05, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08,
+0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00,
-0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00,
-0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF,
-0xFF, 0x64, 0x00, 0x00, 0x30, 0x7A, 0x8E, 0x6C, 0x15, 0x00, 0x00, 0x0B, 0xA4, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF0, 0x33, 0x00, 0x1B, 0xE5, 0xF8, 0x97, 0x78, 0xE7, 0xFF, 0xBF, 0x00, 0x00, 0x31, 0x2C,
-0x00, 0x00, 0x75, 0xFF, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xD2, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x1C, 0xF2, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCA, 0xFF, 0xC8, 0x06,
-0x00, 0x00, 0x00, 0x06, 0xB8, 0xFF, 0xDD, 0x19, 0x00, 0x00, 0x00, 0x02, 0xA9, 0xFF, 0xE0, 0x1F,
-0x00, 0x00, 0x00, 0x00, 0x99, 0xFF, 0xE7, 0x29, 0x08, 0x08, 0x08, 0x02, 0x50, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x14,
-0x61, 0x8A, 0x8B, 0x66, 0x10, 0x00, 0x00, 0x40, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x34, 0x00,
-0x05, 0xC6, 0xB1, 0x68, 0x75, 0xEF, 0xFF, 0xC1, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x91, 0xFF,
-0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCC, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x8C, 0xC0, 0xEE,
-0xEC, 0x7E, 0x03, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xEF, 0xAA, 0x23, 0x00, 0x00, 0x00, 0x00,
-0x07, 0x2D, 0xBC, 0xFF, 0xDD, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0x28, 0x36,
-0x19, 0x00, 0x00, 0x02, 0x93, 0xFF, 0xFE, 0x16, 0x8C, 0xFE, 0xDB, 0xC9, 0xE8, 0xFF, 0xFF, 0xA4,
-0x00, 0x56, 0xDB, 0xFF, 0xFF, 0xFF, 0xEB, 0x86, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x21, 0x1A, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x6C, 0x6C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xB7, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00,
-0x19, 0xEF, 0xE6, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x79, 0xFF, 0xFF, 0x1C, 0x00,
-0x00, 0x5A, 0xFF, 0xA3, 0x3E, 0xFF, 0xFF, 0x1C, 0x00, 0x16, 0xEC, 0xE8, 0x12, 0x40, 0xFF, 0xFF,
-0x1C, 0x00, 0xAB, 0xFF, 0x8D, 0x40, 0x70, 0xFF, 0xFF, 0x55, 0x1F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x7C, 0x9B, 0xA0, 0xA0, 0xA0, 0xB8, 0xFF, 0xFF, 0xAA, 0x4D, 0x00, 0x00, 0x00,
-0x00, 0x40, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
-0x4A, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x26, 0x00, 0x00, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C,
-0x00, 0x00, 0xD0, 0xFF, 0xC6, 0xA0, 0xA0, 0xA0, 0x39, 0x00, 0x00, 0xE3, 0xFF, 0x58, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x6B, 0x45, 0x27, 0x01, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC7, 0x1E, 0x00, 0x08, 0xB4, 0xC7, 0xAD, 0xD0, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0x1C,
-0x27, 0x32, 0x00, 0x00, 0x06, 0xA9, 0xFF, 0xED, 0x03, 0x54, 0xFF, 0xEC, 0xD5, 0xEF, 0xFF, 0xFF,
-0x76, 0x00, 0x32, 0xDB, 0xFF, 0xFF, 0xFF, 0xE5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x19,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x60, 0x85, 0x8A, 0x42, 0x00, 0x00, 0x00, 0x60,
-0xEE, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x49, 0xFD, 0xFB, 0xA0, 0x63, 0x59, 0x3D, 0x00, 0x00,
-0xCC, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xE1, 0x0C, 0x52, 0x5A, 0x20, 0x00,
-0x00, 0x4B, 0xFF, 0xCA, 0xDA, 0xFF, 0xFF, 0xF9, 0x5F, 0x00, 0x5F, 0xFF, 0xFF, 0xD7, 0x7A, 0xC6,
-0xFF, 0xF2, 0x10, 0x61, 0xFF, 0xFF, 0x23, 0x00, 0x1F, 0xFF, 0xFF, 0x3E, 0x48, 0xFF, 0xFF, 0x0F,
-0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x0F, 0xF7, 0xFF, 0x71, 0x00, 0x52, 0xFF, 0xFF, 0x2A, 0x00, 0x8A,
-0xFF, 0xFE, 0xD7, 0xF9, 0xFF, 0xB1, 0x00, 0x00, 0x03, 0x8A, 0xF6, 0xFF, 0xFD, 0xA8, 0x13, 0x00,
-0x00, 0x00, 0x00, 0x07, 0x22, 0x0F, 0x00, 0x00, 0x00, 0x3A, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x20, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x5A, 0xA0, 0xA0, 0xA0, 0xA0,
-0xC5, 0xFF, 0xFE, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x22, 0xFD, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xDE, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x0C, 0xF1, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xF6, 0x12, 0x00,
-0x00, 0x00, 0x00, 0x01, 0xDA, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x31,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF,
-0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x75, 0x8B, 0x6D, 0x16, 0x00, 0x00, 0x00, 0x5E,
-0xFC, 0xFF, 0xFF, 0xFF, 0xF5, 0x3C, 0x00, 0x04, 0xF3, 0xFF, 0x9E, 0x3B, 0xBF, 0xFF, 0xCB, 0x00,
-0x08, 0xFE, 0xFF, 0x3C, 0x00, 0x69, 0xFF, 0xD9, 0x00, 0x00, 0xBA, 0xFF, 0xB8, 0x32, 0xD7, 0xFF,
-0x86, 0x00, 0x00, 0x1A, 0xD0, 0xFF, 0xFF, 0xFD, 0x91, 0x04, 0x00, 0x00, 0x29, 0xCE, 0xFF, 0xFF,
-0xFF, 0xA3, 0x0B, 0x00, 0x0D, 0xE6, 0xFF, 0x98, 0x32, 0xD4, 0xFF, 0xB7, 0x00, 0x57, 0xFF, 0xE4,
-0x02, 0x00, 0x22, 0xFF, 0xFF, 0x28, 0x5B, 0xFF, 0xE8, 0x08, 0x00, 0x21, 0xFF, 0xFF, 0x34, 0x1C,
-0xF2, 0xFF, 0xD7, 0xA8, 0xE6, 0xFF, 0xCE, 0x03, 0x00, 0x3F, 0xCE, 0xFF, 0xFF, 0xFB, 0xAA, 0x1B,
-0x00, 0x00, 0x00, 0x00, 0x0B, 0x1F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x7B, 0x88, 0x57,
-0x04, 0x00, 0x00, 0x00, 0x68, 0xFA, 0xFF, 0xFF, 0xFF, 0xCD, 0x10, 0x00, 0x1E, 0xF7, 0xFF, 0xAF,
-0x76, 0xEE, 0xFF, 0x9A, 0x00, 0x5D, 0xFF, 0xF2, 0x07, 0x00, 0x62, 0xFF, 0xF7, 0x06, 0x76, 0xFF,
-0xDB, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x2E, 0x58, 0xFF, 0xFB, 0x25, 0x00, 0x87, 0xFF, 0xFF, 0x3B,
-0x0F, 0xEC, 0xFF, 0xF7, 0xE5, 0xFC, 0xF4, 0xFF, 0x30, 0x00, 0x37, 0xCB, 0xFA, 0xE7, 0x61, 0xEF,
-0xFF, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x36, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-0xCA, 0xFF, 0x71, 0x00, 0x00, 0x93, 0xBF, 0xCF, 0xFB, 0xFF, 0xC0, 0x07, 0x00, 0x00, 0xB4, 0xFF,
-0xFF, 0xEE, 0x8E, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x26, 0x1C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x62,
-0xDD, 0x86, 0xBC, 0xFF, 0xE7, 0x47, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x1A, 0x69, 0x2A, 0xB1, 0xFF, 0xDD, 0x98, 0xFF, 0xC4, 0x02, 0x2E, 0x08, 0x00, 0x62, 0xDD,
-0x86, 0x00, 0xBC, 0xFF, 0xE7, 0x00, 0x47, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x40, 0x36, 0x00, 0x87, 0xFF, 0xBB, 0x00, 0xB4, 0xFF,
-0x6D, 0x00, 0xE6, 0xFB, 0x16, 0x18, 0xE8, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x9A, 0xFB, 0x48, 0x00, 0x00, 0x00, 0x15, 0x8F,
-0xF8, 0xFF, 0xBB, 0x1D, 0x00, 0x10, 0x84, 0xF3, 0xFF, 0xB7, 0x38, 0x00, 0x00, 0x1B, 0xEF, 0xFF,
-0xC5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x13, 0xC2, 0xFF, 0xFA, 0xA4, 0x34, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x37, 0xAD, 0xFD, 0xFF, 0xC4, 0x53, 0x03, 0x00, 0x00, 0x00, 0x00, 0x25, 0x99, 0xF7, 0xFF,
-0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x84, 0x3A, 0x15, 0x88, 0x88, 0x88, 0x88, 0x88,
-0x88, 0x88, 0x26, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x06, 0x28, 0x28, 0x28,
-0x28, 0x28, 0x28, 0x28, 0x0B, 0x14, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x25, 0x28, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x08, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x0E,
-0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFE, 0xAA, 0x28, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x0F, 0xAB, 0xFE, 0xFC, 0xA0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA6, 0xFD,
-0xF9, 0x95, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xB0, 0xFF, 0xF6, 0x34, 0x00, 0x00, 0x00,
-0x27, 0x95, 0xF4, 0xFF, 0xCF, 0x25, 0x00, 0x45, 0xB5, 0xFE, 0xFF, 0xBC, 0x46, 0x00, 0x00, 0x27,
-0xFF, 0xFC, 0xA8, 0x32, 0x00, 0x00, 0x00, 0x00, 0x21, 0x93, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x02, 0x44, 0x82, 0x8D, 0x66, 0x0D, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x1D, 0x7C,
-0xCF, 0x7A, 0x62, 0xE3, 0xFF, 0x8F, 0x04, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0x22, 0xE8, 0xFF, 0x6E, 0x00, 0x00, 0x32, 0xEB, 0xFF, 0xAB, 0x03, 0x00, 0x02, 0xDE, 0xFF, 0x93,
-0x02, 0x00, 0x00, 0x1E, 0xFF, 0xF4, 0x03, 0x00, 0x00, 0x00, 0x07, 0x34, 0x2F, 0x00, 0x00, 0x00,
-0x00, 0x02, 0x59, 0x54, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x39,
-0xFD, 0xFB, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x41, 0xAD, 0xDE, 0xF7, 0xDF, 0xA0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9D, 0xFF, 0xE5,
-0x9A, 0x80, 0x9F, 0xF3, 0xF9, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0x88, 0x06, 0x00, 0x00,
-0x00, 0x19, 0xD2, 0xFA, 0x30, 0x00, 0x00, 0x43, 0xFF, 0x9D, 0x01, 0x79, 0xE1, 0xF8, 0xDF, 0xAD,
-0x3C, 0xFC, 0xB2, 0x00, 0x00, 0xAC, 0xFC, 0x16, 0x85, 0xFF, 0xC4, 0x77, 0xDA, 0xFF, 0x1A, 0xC0,
-0xF9, 0x0C, 0x05, 0xF6, 0xC1, 0x11, 0xF8, 0xDD, 0x06, 0x00, 0xBA, 0xFF, 0x0F, 0x8A, 0xFF, 0x2B,
-0x1E, 0xFF, 0x99, 0x46, 0xFF, 0x91, 0x00, 0x00, 0xC5, 0xFF, 0x05, 0x78, 0xFF, 0x3E, 0x32, 0xFF,
-0x88, 0x4F, 0xFF, 0x7D, 0x00, 0x00, 0xDD, 0xFB, 0x00, 0x84, 0xFF, 0x2D, 0x26, 0xFF, 0x96, 0x30,
-0xFF, 0x9D, 0x00, 0x16, 0xFC, 0xF8, 0x00, 0xB3, 0xF2, 0x04, 0x06, 0xF7, 0xC7, 0x01, 0xD1, 0xF8,
-0x83, 0xC2, 0xFF, 0xFF, 0x93, 0xFC, 0x8F, 0x00, 0x00, 0xB0, 0xFE, 0x2F, 0x22, 0xBE, 0xF5, 0xCF,
-0x35, 0xB3, 0xF5, 0xA9, 0x09, 0x00, 0x00, 0x33, 0xFA, 0xD8, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xF9, 0xF8, 0xAC, 0x83, 0x8B, 0xA7, 0xE4, 0x98, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x98, 0xDB, 0xF7, 0xF3, 0xDB, 0xA2, 0x3B, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF,
-0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21, 0xFB, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF,
-0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0,
-0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D, 0x00, 0x26, 0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E, 0x08, 0x08, 0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF,
-0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0x7E, 0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xBC, 0xFF, 0xD4, 0x88, 0xFF, 0xFF, 0xFF, 0xFB, 0xE9, 0xB9, 0x4F, 0x00, 0x00, 0x88, 0xFF,
-0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0x55, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x04, 0x3A, 0xF0, 0xFF,
-0xB4, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xBC, 0x00, 0x88, 0xFF, 0xE4, 0x00,
-0x05, 0x3B, 0xF2, 0xFF, 0x81, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x0A, 0x00,
-0x88, 0xFF, 0xFD, 0xEC, 0xF0, 0xFF, 0xFF, 0xE3, 0x41, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x00, 0x17,
-0xC7, 0xFF, 0xDF, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x0B, 0x88, 0xFF,
-0xE4, 0x00, 0x02, 0x29, 0xD3, 0xFF, 0xF0, 0x02, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x78, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xC0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A,
-0xBA, 0xEA, 0xF4, 0xD5, 0x8C, 0x1E, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E,
-0x00, 0x3C, 0xFE, 0xFF, 0xAC, 0x21, 0x14, 0x4D, 0x8E, 0x00, 0x00, 0xAB, 0xFF, 0xE9, 0x07, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x02, 0xF8, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xDE,
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xA6, 0x26, 0x0E, 0x31, 0x77, 0x04,
-0x00, 0x01, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x05, 0x72, 0xD1, 0xF6,
-0xF3, 0xD6, 0x92, 0x03, 0x8C, 0xFF, 0xFF, 0xFF, 0xF7, 0xDD, 0x9C, 0x2B, 0x00, 0x00, 0x00, 0x8C,
-0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFA, 0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x0B, 0x3E,
-0xD1, 0xFF, 0xFA, 0x2F, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x18, 0xF6, 0xFF, 0xA3, 0x00,
-0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xE5, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00,
-0x00, 0x00, 0x8A, 0xFF, 0xFD, 0x02, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFB,
-0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xDD, 0x00, 0x8C, 0xFF, 0xE0, 0x00,
-0x00, 0x00, 0x23, 0xFB, 0xFF, 0x98, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x16, 0x50, 0xE0, 0xFF, 0xF5,
-0x24, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4E, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
-0xFF, 0xF3, 0xD2, 0x8D, 0x1F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
-0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0x0B, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0x00,
-0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
-0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
-0x88, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0x2F, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x88, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0x00,
-0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x90, 0xD5, 0xF4, 0xF5,
-0xDB, 0xA0, 0x34, 0x00, 0x00, 0x4E, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x26,
-0xF6, 0xFF, 0xE9, 0x5B, 0x13, 0x11, 0x38, 0x78, 0x00, 0x00, 0x9B, 0xFF, 0xFE, 0x38, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-0xFC, 0xFF, 0x88, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x98, 0x01, 0xFD, 0xFF, 0x82, 0x00, 0x00,
-0xF0, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0xE7, 0xFF, 0xA3, 0x00, 0x00, 0x03, 0x04, 0xC8, 0xFF, 0x98,
-0x00, 0xAD, 0xFF, 0xF3, 0x12, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x98, 0x00, 0x44, 0xFF, 0xFF, 0xC3,
-0x33, 0x0A, 0x1E, 0xD2, 0xFF, 0x98, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x98, 0x00, 0x00, 0x00, 0x50, 0xBA, 0xED, 0xFB, 0xEB, 0xD1, 0x97, 0x3B, 0x98, 0xFF, 0xD4, 0x00,
-0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0,
-0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00,
-0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x04, 0x04, 0x04, 0x04, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00,
-0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0,
-0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00,
-0x00, 0xC8, 0xFF, 0xA0, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A,
-0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF,
-0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28,
-0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00,
-0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xA4,
-0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00,
-0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8,
-0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4,
-0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xC7, 0x00, 0x00,
-0x00, 0xB3, 0xFF, 0xB2, 0x08, 0x17, 0x33, 0xF3, 0xFF, 0x8B, 0x30, 0xFF, 0xFF, 0xFF, 0xF9, 0x20,
-0x28, 0xEA, 0xF9, 0xCC, 0x46, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0x94,
-0x84, 0xFF, 0xE8, 0x00, 0x00, 0x1B, 0xE9, 0xFF, 0xC9, 0x06, 0x84, 0xFF, 0xE8, 0x00, 0x05, 0xC6,
-0xFF, 0xEB, 0x1D, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x95, 0xFF, 0xFD, 0x46, 0x00, 0x00, 0x84, 0xFF,
-0xE8, 0x55, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xF3, 0xED, 0xFF, 0xEE, 0x06, 0x00,
-0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xF8, 0x58,
-0x9F, 0xFF, 0xF7, 0x25, 0x00, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x14, 0xEC, 0xFF, 0xBF, 0x01, 0x00,
-0x84, 0xFF, 0xE8, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0x65, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x00, 0x01,
-0xC3, 0xFF, 0xEF, 0x19, 0x84, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0xFF, 0xAD, 0x90, 0xFF,
-0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
-0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
-0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
-0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
-0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x94, 0xFF,
-0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0xFF, 0x98, 0x94, 0xFF, 0xFF, 0xFF, 0x24,
-0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x98, 0x94, 0xFF, 0xF3, 0xFF, 0x70, 0x00, 0x00, 0x00,
-0x78, 0xFF, 0xF2, 0xFF, 0x98, 0x94, 0xFF, 0xB7, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0xC8, 0xFE, 0xAF,
-0xFF, 0x98, 0x94, 0xFF, 0x8B, 0xEE, 0xF9, 0x0D, 0x00, 0x19, 0xFE, 0xC9, 0x9F, 0xFF, 0x98, 0x94,
-0xFF, 0x92, 0xA7, 0xFF, 0x52, 0x00, 0x67, 0xFF, 0x79, 0xA8, 0xFF, 0x98, 0x94, 0xFF, 0x97, 0x5D,
-0xFF, 0x9E, 0x00, 0xB7, 0xFF, 0x29, 0xAB, 0xFF, 0x98, 0x94, 0xFF, 0x98, 0x15, 0xFD, 0xE8, 0x0F,
-0xF9, 0xDA, 0x00, 0xAC, 0xFF, 0x98, 0x94, 0xFF, 0x98, 0x00, 0xC8, 0xFF, 0x8C, 0xFF, 0x8A, 0x00,
-0xAC, 0xFF, 0x98, 0x94, 0xFF, 0x98, 0x00, 0x7E, 0xFF, 0xFB, 0xFF, 0x3A, 0x00, 0xAC, 0xFF, 0x98,
-0x94, 0xFF, 0x98, 0x00, 0x34, 0xFF, 0xFF, 0xE9, 0x02, 0x00, 0xAC, 0xFF, 0x98, 0x94, 0xFF, 0x98,
-0x00, 0x01, 0xE7, 0xFF, 0x9B, 0x00, 0x00, 0xAC, 0xFF, 0x98, 0x90, 0xFF, 0xFF, 0xC1, 0x00, 0x00,
-0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x90,
-0x90, 0xFF, 0xFE, 0xFF, 0xD8, 0x04, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0xAA, 0xFD, 0xFF,
-0x69, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0x8B, 0x9F, 0xFF, 0xE9, 0x0D, 0x00, 0xA0, 0xFF,
-0x90, 0x90, 0xFF, 0x96, 0x1C, 0xF6, 0xFF, 0x83, 0x00, 0x9F, 0xFF, 0x90, 0x90, 0xFF, 0x9B, 0x00,
-0x87, 0xFF, 0xF5, 0x1B, 0x9B, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x0F, 0xEB, 0xFF, 0x9E, 0x92,
-0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0xB4, 0xFF, 0x90, 0x90, 0xFF, 0x9C,
-0x00, 0x00, 0x05, 0xDC, 0xFF, 0xFF, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x57, 0xFF,
-0xFF, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-0x00, 0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF,
-0xFE, 0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00, 0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC,
-0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE, 0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A,
-0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF,
-0xFF, 0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1, 0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39,
-0x14, 0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x77, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB, 0xB2, 0x44, 0x00, 0x00, 0x90, 0xFF,
-0xFF, 0xFF, 0xF0, 0xCD, 0x6A, 0x04, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9D, 0x00,
-0x90, 0xFF, 0xDC, 0x00, 0x13, 0xAD, 0xFF, 0xFE, 0x18, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x38, 0xFF,
-0xFF, 0x3F, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x3A, 0x90, 0xFF, 0xDC, 0x00, 0x21,
-0xBF, 0xFF, 0xF7, 0x0C, 0x90, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x90, 0xFF, 0xFF,
-0xFF, 0xF5, 0xC9, 0x5F, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0xEA,
-0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE, 0x38, 0x00, 0xB1,
-0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00, 0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF, 0xA8, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE, 0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A,
-0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF3, 0x00, 0xEB,
-0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDA, 0x00, 0xAF, 0xFF, 0xF3, 0x11, 0x00,
-0x00, 0x00, 0x1A, 0xF9, 0xFF, 0x9C, 0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14, 0x3D, 0xD1, 0xFF,
-0xFD, 0x37, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x00,
-0x00, 0x4B, 0xB6, 0xEC, 0xFD, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x15, 0xE8, 0xFF, 0xE4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF,
-0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0x8B, 0x80, 0xFF,
-0xFF, 0xFF, 0xF7, 0xD9, 0x90, 0x14, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xDA,
-0x0A, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x12, 0x7E, 0xFF, 0xFF, 0x65, 0x00, 0x80, 0xFF, 0xEC, 0x00,
-0x00, 0x00, 0xE7, 0xFF, 0x93, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0x01, 0xEB, 0xFF, 0x88, 0x00,
-0x80, 0xFF, 0xEC, 0x00, 0x17, 0x8A, 0xFF, 0xFF, 0x40, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x96, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x80, 0xFF,
-0xEC, 0x00, 0x57, 0xFF, 0xFF, 0x56, 0x00, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0xA1, 0xFF, 0xF2,
-0x26, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0x0D, 0xDC, 0xFF, 0xD1, 0x09, 0x80, 0xFF, 0xEC, 0x00,
-0x00, 0x00, 0x37, 0xFB, 0xFF, 0x9E, 0x00, 0x04, 0x6B, 0xD1, 0xF4, 0xE8, 0xC1, 0x73, 0x0C, 0x00,
-0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x06, 0x07, 0xF8, 0xFF, 0x96, 0x0E, 0x1F, 0x5B, 0x5D,
-0x00, 0x15, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xEB, 0x61, 0x04,
-0x00, 0x00, 0x00, 0x00, 0x3C, 0xF8, 0xFF, 0xFF, 0xDC, 0x51, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xB9,
-0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xD5, 0xFF, 0xFB, 0x19, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0x43, 0x38, 0xA1, 0x49, 0x19, 0x09, 0x72, 0xFF, 0xFF, 0x29,
-0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x16, 0x91, 0xD7, 0xF3, 0xF0, 0xCF, 0x6F,
-0x07, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xB0, 0x02, 0x04, 0x04, 0xAD, 0xFF, 0xC1, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00,
-0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x30,
+0x7A, 0x8E, 0x6C, 0x15, 0x00, 0x00, 0x0B, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x33, 0x00, 0x1B,
+0xE5, 0xF8, 0x97, 0x78, 0xE7, 0xFF, 0xBF, 0x00, 0x00, 0x31, 0x2C, 0x00, 0x00, 0x75, 0xFF, 0xEE,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF2,
+0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCA, 0xFF, 0xC8, 0x06, 0x00, 0x00, 0x00, 0x06, 0xB8,
+0xFF, 0xDD, 0x19, 0x00, 0x00, 0x00, 0x02, 0xA9, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x99,
+0xFF, 0xE7, 0x29, 0x08, 0x08, 0x08, 0x02, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x14, 0x61, 0x8A, 0x8B, 0x66, 0x10,
+0x00, 0x00, 0x40, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x34, 0x00, 0x05, 0xC6, 0xB1, 0x68, 0x75,
+0xEF, 0xFF, 0xC1, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xCC, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x8C, 0xC0, 0xEE, 0xEC, 0x7E, 0x03, 0x00, 0x00,
+0x00, 0xC4, 0xFF, 0xFF, 0xEF, 0xAA, 0x23, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2D, 0xBC, 0xFF, 0xDD,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0x28, 0x36, 0x19, 0x00, 0x00, 0x02, 0x93,
+0xFF, 0xFE, 0x16, 0x8C, 0xFE, 0xDB, 0xC9, 0xE8, 0xFF, 0xFF, 0xA4, 0x00, 0x56, 0xDB, 0xFF, 0xFF,
+0xFF, 0xEB, 0x86, 0x07, 0x00, 0x00, 0x00, 0x0C, 0x21, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1B, 0x6C, 0x6C, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0xFF, 0x1C, 0x00,
+0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xE6, 0xFF, 0xFF,
+0x1C, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x79, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x5A, 0xFF, 0xA3, 0x3E,
+0xFF, 0xFF, 0x1C, 0x00, 0x16, 0xEC, 0xE8, 0x12, 0x40, 0xFF, 0xFF, 0x1C, 0x00, 0xAB, 0xFF, 0x8D,
+0x40, 0x70, 0xFF, 0xFF, 0x55, 0x1F, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x9B,
+0xA0, 0xA0, 0xA0, 0xB8, 0xFF, 0xFF, 0xAA, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x1C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x4A, 0x6C, 0x6C, 0x6C, 0x6C,
+0x6C, 0x26, 0x00, 0x00, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0xD0, 0xFF, 0xC6,
+0xA0, 0xA0, 0xA0, 0x39, 0x00, 0x00, 0xE3, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5,
+0xFF, 0x6B, 0x45, 0x27, 0x01, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x1E, 0x00,
+0x08, 0xB4, 0xC7, 0xAD, 0xD0, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0x1C, 0x27, 0x32, 0x00, 0x00, 0x06,
+0xA9, 0xFF, 0xED, 0x03, 0x54, 0xFF, 0xEC, 0xD5, 0xEF, 0xFF, 0xFF, 0x76, 0x00, 0x32, 0xDB, 0xFF,
+0xFF, 0xFF, 0xE5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0E, 0x60, 0x85, 0x8A, 0x42, 0x00, 0x00, 0x00, 0x60, 0xEE, 0xFF, 0xFF, 0xFF, 0x8C,
+0x00, 0x00, 0x49, 0xFD, 0xFB, 0xA0, 0x63, 0x59, 0x3D, 0x00, 0x00, 0xCC, 0xFF, 0x5E, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1C, 0xFF, 0xE1, 0x0C, 0x52, 0x5A, 0x20, 0x00, 0x00, 0x4B, 0xFF, 0xCA, 0xDA,
+0xFF, 0xFF, 0xF9, 0x5F, 0x00, 0x5F, 0xFF, 0xFF, 0xD7, 0x7A, 0xC6, 0xFF, 0xF2, 0x10, 0x61, 0xFF,
+0xFF, 0x23, 0x00, 0x1F, 0xFF, 0xFF, 0x3E, 0x48, 0xFF, 0xFF, 0x0F, 0x00, 0x0A, 0xFF, 0xFF, 0x50,
+0x0F, 0xF7, 0xFF, 0x71, 0x00, 0x52, 0xFF, 0xFF, 0x2A, 0x00, 0x8A, 0xFF, 0xFE, 0xD7, 0xF9, 0xFF,
+0xB1, 0x00, 0x00, 0x03, 0x8A, 0xF6, 0xFF, 0xFD, 0xA8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22,
+0x0F, 0x00, 0x00, 0x00, 0x3A, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x20, 0x90, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x5A, 0xA0, 0xA0, 0xA0, 0xA0, 0xC5, 0xFF, 0xFE, 0x26, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFD, 0xFF, 0x4D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xDE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0xFF,
+0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xF6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDA,
+0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xBA, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x24, 0x75, 0x8B, 0x6D, 0x16, 0x00, 0x00, 0x00, 0x5E, 0xFC, 0xFF, 0xFF, 0xFF, 0xF5,
+0x3C, 0x00, 0x04, 0xF3, 0xFF, 0x9E, 0x3B, 0xBF, 0xFF, 0xCB, 0x00, 0x08, 0xFE, 0xFF, 0x3C, 0x00,
+0x69, 0xFF, 0xD9, 0x00, 0x00, 0xBA, 0xFF, 0xB8, 0x32, 0xD7, 0xFF, 0x86, 0x00, 0x00, 0x1A, 0xD0,
+0xFF, 0xFF, 0xFD, 0x91, 0x04, 0x00, 0x00, 0x29, 0xCE, 0xFF, 0xFF, 0xFF, 0xA3, 0x0B, 0x00, 0x0D,
+0xE6, 0xFF, 0x98, 0x32, 0xD4, 0xFF, 0xB7, 0x00, 0x57, 0xFF, 0xE4, 0x02, 0x00, 0x22, 0xFF, 0xFF,
+0x28, 0x5B, 0xFF, 0xE8, 0x08, 0x00, 0x21, 0xFF, 0xFF, 0x34, 0x1C, 0xF2, 0xFF, 0xD7, 0xA8, 0xE6,
+0xFF, 0xCE, 0x03, 0x00, 0x3F, 0xCE, 0xFF, 0xFF, 0xFB, 0xAA, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x0B,
+0x1F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x7B, 0x88, 0x57, 0x04, 0x00, 0x00, 0x00, 0x68,
+0xFA, 0xFF, 0xFF, 0xFF, 0xCD, 0x10, 0x00, 0x1E, 0xF7, 0xFF, 0xAF, 0x76, 0xEE, 0xFF, 0x9A, 0x00,
+0x5D, 0xFF, 0xF2, 0x07, 0x00, 0x62, 0xFF, 0xF7, 0x06, 0x76, 0xFF, 0xDB, 0x00, 0x00, 0x31, 0xFF,
+0xFF, 0x2E, 0x58, 0xFF, 0xFB, 0x25, 0x00, 0x87, 0xFF, 0xFF, 0x3B, 0x0F, 0xEC, 0xFF, 0xF7, 0xE5,
+0xFC, 0xF4, 0xFF, 0x30, 0x00, 0x37, 0xCB, 0xFA, 0xE7, 0x61, 0xEF, 0xFF, 0x12, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x36, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xCA, 0xFF, 0x71, 0x00, 0x00,
+0x93, 0xBF, 0xCF, 0xFB, 0xFF, 0xC0, 0x07, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xEE, 0x8E, 0x0D, 0x00,
+0x00, 0x00, 0x12, 0x26, 0x1C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x62, 0xDD, 0x86, 0xBC, 0xFF, 0xE7,
+0x47, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x69, 0x2A, 0xB1,
+0xFF, 0xDD, 0x98, 0xFF, 0xC4, 0x02, 0x2E, 0x08, 0x15, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+0x26, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x06, 0x28, 0x28, 0x28, 0x28, 0x28,
+0x28, 0x28, 0x0B, 0x14, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x25, 0x28, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x08, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x0E, 0x02, 0x44,
+0x82, 0x8D, 0x66, 0x0D, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x1D, 0x7C, 0xCF, 0x7A, 0x62,
+0xE3, 0xFF, 0x8F, 0x04, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x22, 0xE8, 0xFF,
+0x6E, 0x00, 0x00, 0x32, 0xEB, 0xFF, 0xAB, 0x03, 0x00, 0x02, 0xDE, 0xFF, 0x93, 0x02, 0x00, 0x00,
+0x1E, 0xFF, 0xF4, 0x03, 0x00, 0x00, 0x00, 0x07, 0x34, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x59,
+0x54, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x39, 0xFD, 0xFB, 0x2C,
+0x00, 0x00, 0x00, 0x00, 0x1E, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF,
+0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21,
+0xFB, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00,
+0x00, 0x00, 0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D,
+0x00, 0x26, 0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C,
+0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E,
+0x08, 0x08, 0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8,
+0xFF, 0x7E, 0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4, 0x88, 0xFF, 0xFF,
+0xFF, 0xFB, 0xE9, 0xB9, 0x4F, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0x55,
+0x00, 0x88, 0xFF, 0xE4, 0x00, 0x04, 0x3A, 0xF0, 0xFF, 0xB4, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x00,
+0x00, 0xBF, 0xFF, 0xBC, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x05, 0x3B, 0xF2, 0xFF, 0x81, 0x00, 0x88,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x0A, 0x00, 0x88, 0xFF, 0xFD, 0xEC, 0xF0, 0xFF, 0xFF,
+0xE3, 0x41, 0x00, 0x88, 0xFF, 0xE4, 0x00, 0x00, 0x17, 0xC7, 0xFF, 0xDF, 0x00, 0x88, 0xFF, 0xE4,
+0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x0B, 0x88, 0xFF, 0xE4, 0x00, 0x02, 0x29, 0xD3, 0xFF, 0xF0,
+0x02, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEA, 0xC0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xBA, 0xEA, 0xF4, 0xD5, 0x8C, 0x1E, 0x00,
+0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x3C, 0xFE, 0xFF, 0xAC, 0x21, 0x14,
+0x4D, 0x8E, 0x00, 0x00, 0xAB, 0xFF, 0xE9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x11, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFF, 0x8B, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xDE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x62, 0xFF, 0xFF, 0xA6, 0x26, 0x0E, 0x31, 0x77, 0x04, 0x00, 0x01, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x08, 0x00, 0x00, 0x05, 0x72, 0xD1, 0xF6, 0xF3, 0xD6, 0x92, 0x03, 0x8C, 0xFF, 0xFF,
+0xFF, 0xF7, 0xDD, 0x9C, 0x2B, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFA,
+0x5E, 0x00, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x0B, 0x3E, 0xD1, 0xFF, 0xFA, 0x2F, 0x00, 0x8C, 0xFF,
+0xE0, 0x00, 0x00, 0x00, 0x18, 0xF6, 0xFF, 0xA3, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+0xAB, 0xFF, 0xE5, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFD, 0x02, 0x8C,
+0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFB, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0xB2, 0xFF, 0xDD, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x23, 0xFB, 0xFF, 0x98, 0x00,
+0x8C, 0xFF, 0xE0, 0x00, 0x16, 0x50, 0xE0, 0xFF, 0xF5, 0x24, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF4, 0x4E, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0xD2, 0x8D, 0x1F, 0x00, 0x00,
+0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC,
+0x0B, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4,
+0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x0C, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x88, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC,
+0x2F, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4,
+0x00, 0x88, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xE0, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x20, 0x90, 0xD5, 0xF4, 0xF5, 0xDB, 0xA0, 0x34, 0x00, 0x00, 0x4E, 0xF4,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x26, 0xF6, 0xFF, 0xE9, 0x5B, 0x13, 0x11, 0x38,
+0x78, 0x00, 0x00, 0x9B, 0xFF, 0xFE, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF,
+0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xFF, 0x88, 0x00, 0x00, 0xF0, 0xFF,
+0xFF, 0xFF, 0x98, 0x01, 0xFD, 0xFF, 0x82, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0xE7,
+0xFF, 0xA3, 0x00, 0x00, 0x03, 0x04, 0xC8, 0xFF, 0x98, 0x00, 0xAD, 0xFF, 0xF3, 0x12, 0x00, 0x00,
+0x00, 0xC8, 0xFF, 0x98, 0x00, 0x44, 0xFF, 0xFF, 0xC3, 0x33, 0x0A, 0x1E, 0xD2, 0xFF, 0x98, 0x00,
+0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x50, 0xBA, 0xED,
+0xFB, 0xEB, 0xD1, 0x97, 0x3B, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98,
+0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4,
+0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xA0, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x04, 0x04,
+0x04, 0x04, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98,
+0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+0xC8, 0xFF, 0xA0, 0x98, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xA0, 0x8C, 0xFF, 0xFF,
+0xFF, 0xFF, 0xA8, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x00,
+0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF,
+0xFF, 0x44, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x8C,
+0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x84, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0x94, 0x84,
+0xFF, 0xE8, 0x00, 0x00, 0x1B, 0xE9, 0xFF, 0xC9, 0x06, 0x84, 0xFF, 0xE8, 0x00, 0x05, 0xC6, 0xFF,
+0xEB, 0x1D, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x95, 0xFF, 0xFD, 0x46, 0x00, 0x00, 0x84, 0xFF, 0xE8,
+0x55, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xF3, 0xED, 0xFF, 0xEE, 0x06, 0x00, 0x00,
+0x00, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xF8, 0x58, 0x9F,
+0xFF, 0xF7, 0x25, 0x00, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x14, 0xEC, 0xFF, 0xBF, 0x01, 0x00, 0x84,
+0xFF, 0xE8, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0x65, 0x00, 0x84, 0xFF, 0xE8, 0x00, 0x00, 0x01, 0xC3,
+0xFF, 0xEF, 0x19, 0x84, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x2C, 0xFB, 0xFF, 0xAD, 0x90, 0xFF, 0xDC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x94, 0xFF, 0xFF,
+0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0xFF, 0x98, 0x94, 0xFF, 0xFF, 0xFF, 0x24, 0x00,
+0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x98, 0x94, 0xFF, 0xF3, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x78,
+0xFF, 0xF2, 0xFF, 0x98, 0x94, 0xFF, 0xB7, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0xC8, 0xFE, 0xAF, 0xFF,
+0x98, 0x94, 0xFF, 0x8B, 0xEE, 0xF9, 0x0D, 0x00, 0x19, 0xFE, 0xC9, 0x9F, 0xFF, 0x98, 0x94, 0xFF,
+0x92, 0xA7, 0xFF, 0x52, 0x00, 0x67, 0xFF, 0x79, 0xA8, 0xFF, 0x98, 0x94, 0xFF, 0x97, 0x5D, 0xFF,
+0x9E, 0x00, 0xB7, 0xFF, 0x29, 0xAB, 0xFF, 0x98, 0x94, 0xFF, 0x98, 0x15, 0xFD, 0xE8, 0x0F, 0xF9,
+0xDA, 0x00, 0xAC, 0xFF, 0x98, 0x94, 0xFF, 0x98, 0x00, 0xC8, 0xFF, 0x8C, 0xFF, 0x8A, 0x00, 0xAC,
+0xFF, 0x98, 0x94, 0xFF, 0x98, 0x00, 0x7E, 0xFF, 0xFB, 0xFF, 0x3A, 0x00, 0xAC, 0xFF, 0x98, 0x94,
+0xFF, 0x98, 0x00, 0x34, 0xFF, 0xFF, 0xE9, 0x02, 0x00, 0xAC, 0xFF, 0x98, 0x94, 0xFF, 0x98, 0x00,
+0x01, 0xE7, 0xFF, 0x9B, 0x00, 0x00, 0xAC, 0xFF, 0x98, 0x90, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90,
+0xFF, 0xFE, 0xFF, 0xD8, 0x04, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0xAA, 0xFD, 0xFF, 0x69,
+0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0x8B, 0x9F, 0xFF, 0xE9, 0x0D, 0x00, 0xA0, 0xFF, 0x90,
+0x90, 0xFF, 0x96, 0x1C, 0xF6, 0xFF, 0x83, 0x00, 0x9F, 0xFF, 0x90, 0x90, 0xFF, 0x9B, 0x00, 0x87,
+0xFF, 0xF5, 0x1B, 0x9B, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x0F, 0xEB, 0xFF, 0x9E, 0x92, 0xFF,
+0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0xB4, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00,
+0x00, 0x05, 0xDC, 0xFF, 0xFF, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF,
+0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE,
+0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00, 0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF,
+0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE, 0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF,
+0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF, 0xFF,
+0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1, 0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14,
+0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77,
+0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB, 0xB2, 0x44, 0x00, 0x00, 0x90, 0xFF, 0xFF,
+0xFF, 0xF0, 0xCD, 0x6A, 0x04, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9D, 0x00, 0x90,
+0xFF, 0xDC, 0x00, 0x13, 0xAD, 0xFF, 0xFE, 0x18, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x38, 0xFF, 0xFF,
+0x3F, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x3A, 0x90, 0xFF, 0xDC, 0x00, 0x21, 0xBF,
+0xFF, 0xF7, 0x0C, 0x90, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+0xF5, 0xC9, 0x5F, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xF7, 0xD9, 0x90,
+0x14, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xDA, 0x0A, 0x00, 0x80, 0xFF, 0xEC,
+0x00, 0x12, 0x7E, 0xFF, 0xFF, 0x65, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0x93,
+0x00, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0x01, 0xEB, 0xFF, 0x88, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x17,
+0x8A, 0xFF, 0xFF, 0x40, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x80,
+0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x57, 0xFF, 0xFF,
+0x56, 0x00, 0x00, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0xA1, 0xFF, 0xF2, 0x26, 0x00, 0x80, 0xFF, 0xEC,
+0x00, 0x00, 0x0D, 0xDC, 0xFF, 0xD1, 0x09, 0x80, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x37, 0xFB, 0xFF,
+0x9E, 0x00, 0x04, 0x6B, 0xD1, 0xF4, 0xE8, 0xC1, 0x73, 0x0C, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xE9, 0x06, 0x07, 0xF8, 0xFF, 0x96, 0x0E, 0x1F, 0x5B, 0x5D, 0x00, 0x15, 0xFF, 0xFF, 0x57,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xEB, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3C,
+0xF8, 0xFF, 0xFF, 0xDC, 0x51, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xB9, 0xFF, 0xFF, 0xFF, 0x7D, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3A, 0xD5, 0xFF, 0xFB, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF,
+0xFF, 0x43, 0x38, 0xA1, 0x49, 0x19, 0x09, 0x72, 0xFF, 0xFF, 0x29, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xB0, 0x00, 0x16, 0x91, 0xD7, 0xF3, 0xF0, 0xCF, 0x6F, 0x07, 0x00, 0xB0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x02,
+0x04, 0x04, 0xAD, 0xFF, 0xC1, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
-0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xA8, 0xFF,
-0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8,
-0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xFF, 0xA8, 0xA6, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xA6, 0x93, 0xFF,
-0xEB, 0x04, 0x00, 0x00, 0x04, 0xEA, 0xFF, 0x8E, 0x4E, 0xFF, 0xFF, 0x8F, 0x1C, 0x1B, 0x8F, 0xFF,
-0xFF, 0x46, 0x01, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x05, 0x77, 0xD3,
-0xF8, 0xF3, 0xCC, 0x6C, 0x02, 0x00, 0xD8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0xD7,
-0x89, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x88, 0x3A, 0xFF, 0xFE, 0x16, 0x00, 0x00,
-0x17, 0xFE, 0xFF, 0x38, 0x02, 0xE8, 0xFF, 0x5E, 0x00, 0x00, 0x61, 0xFF, 0xE7, 0x01, 0x00, 0x9B,
-0xFF, 0xA8, 0x00, 0x00, 0xAC, 0xFF, 0x99, 0x00, 0x00, 0x4C, 0xFF, 0xEE, 0x03, 0x05, 0xF0, 0xFF,
-0x49, 0x00, 0x00, 0x08, 0xF4, 0xFF, 0x3C, 0x41, 0xFF, 0xF2, 0x07, 0x00, 0x00, 0x00, 0xAD, 0xFF,
-0x81, 0x86, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xBC, 0xC1, 0xFF, 0x5A, 0x00, 0x00,
-0x00, 0x00, 0x12, 0xFC, 0xF1, 0xF3, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0xE2, 0xFF,
-0x6B, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xE1, 0xA6, 0xFF, 0xA3,
-0x00, 0x00, 0x04, 0xF3, 0xFF, 0xF3, 0x04, 0x00, 0x00, 0xA2, 0xFF, 0xA5, 0x6A, 0xFF, 0xDA, 0x00,
-0x00, 0x35, 0xFF, 0xFF, 0xFF, 0x36, 0x00, 0x00, 0xD9, 0xFF, 0x69, 0x2D, 0xFF, 0xFF, 0x13, 0x00,
-0x73, 0xFF, 0xD3, 0xFF, 0x74, 0x00, 0x11, 0xFE, 0xFF, 0x2D, 0x01, 0xEF, 0xFF, 0x49, 0x00, 0xB0,
-0xFF, 0x78, 0xFF, 0xB2, 0x00, 0x47, 0xFF, 0xEF, 0x02, 0x00, 0xB5, 0xFF, 0x81, 0x01, 0xEC, 0xFC,
-0x18, 0xFD, 0xEE, 0x01, 0x7E, 0xFF, 0xB5, 0x00, 0x00, 0x78, 0xFF, 0xB8, 0x2A, 0xFF, 0xCC, 0x00,
-0xCF, 0xFF, 0x2D, 0xB5, 0xFF, 0x79, 0x00, 0x00, 0x3C, 0xFF, 0xE8, 0x63, 0xFF, 0x8F, 0x00, 0x92,
-0xFF, 0x60, 0xEA, 0xFF, 0x3D, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0xA7, 0xFF, 0x53, 0x00, 0x55, 0xFF,
-0xA4, 0xFF, 0xF9, 0x08, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xEF, 0xFF, 0x17, 0x00, 0x18, 0xFF, 0xEE,
-0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0xFF,
-0x89, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0x4D,
-0x00, 0x00, 0x70, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0x6A, 0x03, 0xCB, 0xFF,
-0xD3, 0x03, 0x00, 0x06, 0xDA, 0xFF, 0xC7, 0x02, 0x00, 0x31, 0xFC, 0xFF, 0x6C, 0x00, 0x76, 0xFF,
-0xFA, 0x2C, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xEE, 0x2C, 0xF2, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00,
-0x0B, 0xE0, 0xFF, 0xF1, 0xFF, 0xDA, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF,
-0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x2D, 0xFB, 0xFF, 0xD4, 0xFF, 0xEA, 0x15, 0x00, 0x00, 0x00, 0x02, 0xC8, 0xFF, 0xC7, 0x11,
-0xE9, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFC, 0x31, 0x00, 0x5E, 0xFF, 0xFF, 0x55, 0x00,
-0x1B, 0xF1, 0xFF, 0x93, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xEA, 0x15, 0xAF, 0xFF, 0xE9, 0x0F, 0x00,
-0x00, 0x00, 0x2D, 0xFB, 0xFF, 0xAA, 0xBE, 0xFF, 0xDA, 0x02, 0x00, 0x00, 0x02, 0xD7, 0xFF, 0xBD,
-0x3B, 0xFF, 0xFF, 0x58, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0x39, 0x00, 0xB8, 0xFF, 0xD2, 0x01, 0x01,
-0xD0, 0xFF, 0xB4, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0x4E, 0x4E, 0xFF, 0xFE, 0x31, 0x00, 0x00, 0x00,
-0xB2, 0xFF, 0xC9, 0xC9, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xFF, 0xFD, 0x29,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF,
-0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x7C, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x68,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xD9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xFF,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xDB, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF,
-0xEB, 0x13, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFA, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC6,
-0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xF7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x1A,
-0xF1, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA0, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x1A, 0x50, 0x50, 0x50, 0x24, 0x54,
-0xFF, 0xFF, 0xFF, 0x74, 0x54, 0xFF, 0xCC, 0x54, 0x26, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF,
-0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4,
-0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00,
-0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xB4, 0x00, 0x00,
-0x54, 0xFF, 0xB4, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0x74, 0x37, 0xA8, 0xA8, 0xA8, 0x4C, 0x21,
-0x54, 0x36, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x02, 0xED, 0xFF,
-0x1C, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xA8, 0x00,
-0x00, 0x00, 0x00, 0x1E, 0xFF, 0xEC, 0x02, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x34, 0x00, 0x00,
-0x00, 0x00, 0x92, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-0x0B, 0xF9, 0xFA, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x7A,
-0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEB, 0xFF,
-0x1E, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xAA, 0x00,
-0x00, 0x00, 0x00, 0x19, 0xA8, 0x96, 0x11, 0x50, 0x50, 0x50, 0x2D, 0x38, 0xFF, 0xFF, 0xFF, 0x90,
-0x12, 0x54, 0xA4, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00,
-0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00,
-0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78,
-0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF, 0x90, 0x00, 0x00, 0x78, 0xFF,
-0x90, 0x38, 0xFF, 0xFF, 0xFF, 0x90, 0x24, 0xA8, 0xA8, 0xA8, 0x5E, 0x00, 0x00, 0x00, 0x29, 0x79,
-0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
-0xFD, 0xFE, 0xE6, 0x09, 0x00, 0x00, 0x00, 0x00, 0x99, 0xFD, 0x74, 0xFF, 0x74, 0x00, 0x00, 0x00,
-0x16, 0xF7, 0xB2, 0x01, 0xCF, 0xEC, 0x0D, 0x00, 0x00, 0x85, 0xFF, 0x42, 0x00, 0x51, 0xFF, 0x7F,
-0x00, 0x0C, 0xEE, 0xD3, 0x00, 0x00, 0x01, 0xCF, 0xF1, 0x12, 0x66, 0xF0, 0x61, 0x00, 0x00, 0x00,
-0x4F, 0xF0, 0x7D, 0x04, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x57, 0x04, 0x88, 0x88, 0x88, 0x88,
-0x88, 0x88, 0x52, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00,
-0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x24, 0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26,
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xAC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00,
+0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4,
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
+0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00,
+0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA6,
+0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xA6, 0x93, 0xFF, 0xEB, 0x04, 0x00, 0x00, 0x04,
+0xEA, 0xFF, 0x8E, 0x4E, 0xFF, 0xFF, 0x8F, 0x1C, 0x1B, 0x8F, 0xFF, 0xFF, 0x46, 0x01, 0xB4, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x05, 0x77, 0xD3, 0xF8, 0xF3, 0xCC, 0x6C, 0x02,
+0x00, 0xD8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0xD7, 0x89, 0xFF, 0xCA, 0x00, 0x00,
+0x00, 0x00, 0xCC, 0xFF, 0x88, 0x3A, 0xFF, 0xFE, 0x16, 0x00, 0x00, 0x17, 0xFE, 0xFF, 0x38, 0x02,
+0xE8, 0xFF, 0x5E, 0x00, 0x00, 0x61, 0xFF, 0xE7, 0x01, 0x00, 0x9B, 0xFF, 0xA8, 0x00, 0x00, 0xAC,
+0xFF, 0x99, 0x00, 0x00, 0x4C, 0xFF, 0xEE, 0x03, 0x05, 0xF0, 0xFF, 0x49, 0x00, 0x00, 0x08, 0xF4,
+0xFF, 0x3C, 0x41, 0xFF, 0xF2, 0x07, 0x00, 0x00, 0x00, 0xAD, 0xFF, 0x81, 0x86, 0xFF, 0xAA, 0x00,
+0x00, 0x00, 0x00, 0x5E, 0xFF, 0xBC, 0xC1, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFC, 0xF1,
+0xF3, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x70, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0xBB,
+0xFF, 0xBA, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xE1, 0xA6, 0xFF, 0xA3, 0x00, 0x00, 0x04, 0xF3, 0xFF,
+0xF3, 0x04, 0x00, 0x00, 0xA2, 0xFF, 0xA5, 0x6A, 0xFF, 0xDA, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF,
+0x36, 0x00, 0x00, 0xD9, 0xFF, 0x69, 0x2D, 0xFF, 0xFF, 0x13, 0x00, 0x73, 0xFF, 0xD3, 0xFF, 0x74,
+0x00, 0x11, 0xFE, 0xFF, 0x2D, 0x01, 0xEF, 0xFF, 0x49, 0x00, 0xB0, 0xFF, 0x78, 0xFF, 0xB2, 0x00,
+0x47, 0xFF, 0xEF, 0x02, 0x00, 0xB5, 0xFF, 0x81, 0x01, 0xEC, 0xFC, 0x18, 0xFD, 0xEE, 0x01, 0x7E,
+0xFF, 0xB5, 0x00, 0x00, 0x78, 0xFF, 0xB8, 0x2A, 0xFF, 0xCC, 0x00, 0xCF, 0xFF, 0x2D, 0xB5, 0xFF,
+0x79, 0x00, 0x00, 0x3C, 0xFF, 0xE8, 0x63, 0xFF, 0x8F, 0x00, 0x92, 0xFF, 0x60, 0xEA, 0xFF, 0x3D,
+0x00, 0x00, 0x07, 0xF8, 0xFF, 0xA7, 0xFF, 0x53, 0x00, 0x55, 0xFF, 0xA4, 0xFF, 0xF9, 0x08, 0x00,
+0x00, 0x00, 0xC3, 0xFF, 0xEF, 0xFF, 0x17, 0x00, 0x18, 0xFF, 0xEE, 0xFF, 0xC5, 0x00, 0x00, 0x00,
+0x00, 0x87, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0xDB, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00,
+0x4A, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0xBE, 0xFF, 0xDA,
+0x02, 0x00, 0x00, 0x02, 0xD7, 0xFF, 0xBD, 0x3B, 0xFF, 0xFF, 0x58, 0x00, 0x00, 0x56, 0xFF, 0xFF,
+0x39, 0x00, 0xB8, 0xFF, 0xD2, 0x01, 0x01, 0xD0, 0xFF, 0xB4, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0x4E,
+0x4E, 0xFF, 0xFE, 0x31, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xC9, 0xC9, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+0x00, 0x2F, 0xFE, 0xFF, 0xFF, 0xFD, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xA1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF,
+0xFF, 0x34, 0x00, 0x00, 0x00, 0x04, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x57, 0x04, 0x88, 0x88,
+0x88, 0x88, 0x88, 0x88, 0x52, 0x00, 0x24, 0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26,
 0xFC, 0xF6, 0xD1, 0xDC, 0xFF, 0xFD, 0x3F, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xC6, 0xFF, 0x93,
 0x00, 0x16, 0x8C, 0xD0, 0xEE, 0xF9, 0xFF, 0xFF, 0xAF, 0x06, 0xD0, 0xFF, 0xED, 0x8F, 0x6C, 0xCF,
 0xFF, 0xB0, 0x36, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0xBC, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0x3E, 0x00,
@@ -904,717 +589,9 @@ const uint8_t  NotoSansBold16[] PROGMEM = {
 0xE0, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFE, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00,
 0x00, 0xBE, 0xFF, 0xED, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x97, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x72, 0xF4, 0xFF, 0xFF, 0x9D, 0x00, 0x00,
-0x00, 0x00, 0x66, 0xF6, 0xE2, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x60, 0x42, 0xD4, 0xD4, 0xD4, 0xE8, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x0B, 0xD8,
-0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xE5, 0x13, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFD,
-0x42, 0x00, 0x00, 0x00, 0x1E, 0xEF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xCA, 0x05,
-0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE5, 0xD4, 0xD4, 0xD4, 0x6D, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x49, 0x02, 0x00, 0x00, 0x07, 0xC5, 0xFF, 0xFF,
-0x08, 0x00, 0x00, 0x4D, 0xFF, 0xFB, 0x8D, 0x03, 0x00, 0x00, 0x63, 0xFF, 0xB7, 0x00, 0x00, 0x00,
-0x00, 0x64, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x73,
-0xFF, 0xA7, 0x00, 0x00, 0x1C, 0x65, 0xE6, 0xFF, 0x6B, 0x00, 0x00, 0x64, 0xFF, 0xFA, 0x78, 0x01,
-0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xF6, 0x42, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xA2, 0x00, 0x00,
-0x00, 0x00, 0x65, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00,
-0x64, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xE7, 0x34, 0x00, 0x00, 0x00, 0x1D, 0xF4,
-0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x2D, 0x87, 0xA2, 0x05, 0x2A, 0x50, 0x0D, 0x88, 0xFF, 0x2C,
-0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88,
-0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF,
-0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x88, 0xFF, 0x2C, 0x59, 0xA8, 0x1C, 0x11, 0x46, 0x21,
-0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x1A, 0xA5, 0xFF, 0xFF, 0x19,
-0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0x34, 0x00, 0x00,
-0x00, 0x00, 0xDC, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x00,
-0xA3, 0xFF, 0xD4, 0x5C, 0x0E, 0x00, 0x00, 0x0B, 0x9B, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x63, 0xFD,
-0xF8, 0xB0, 0x1F, 0x00, 0x00, 0xCF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0x34, 0x00,
-0x00, 0x00, 0x00, 0xDC, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x34, 0x00, 0x00, 0x06,
-0x4A, 0xFB, 0xFF, 0x26, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xDB, 0x05, 0x00, 0x00, 0x24, 0xA0, 0x7C,
-0x1C, 0x00, 0x00, 0x00, 0x00, 0x23, 0x6D, 0x6B, 0x22, 0x00, 0x00, 0x0B, 0x1B, 0x1B, 0xF5, 0xFF,
-0xFF, 0xFE, 0xBF, 0x98, 0xE2, 0x48, 0x28, 0xA9, 0x43, 0x5E, 0xBD, 0xFE, 0xFF, 0xD0, 0x1C, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x00, 0x00, 0x00, 0xA1, 0xF7, 0x9E, 0xF3, 0xFF, 0xEF, 0x52,
-0x9F, 0x52, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x8A, 0xA6, 0xFF, 0x98, 0xB4, 0xFF, 0xA6, 0xC2, 0xFF,
-0xB4, 0xD0, 0xFF, 0xC2, 0xDE, 0xFF, 0xD0, 0xEC, 0xFF, 0xDE, 0xF9, 0xFF, 0xEC, 0x00, 0x00, 0x00,
-0xAC, 0xB8, 0x00, 0x00, 0x00, 0x22, 0xA3, 0xF5, 0xFE, 0xE2, 0x92, 0x1A, 0xE4, 0xFF, 0xFF, 0xF4,
-0xFF, 0xA7, 0x89, 0xFF, 0xF9, 0x39, 0x00, 0x22, 0x25, 0xC7, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00,
-0xE2, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF,
-0xB6, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x18, 0x47, 0x17, 0xE5, 0xFF, 0xFF,
-0xF9, 0xFF, 0xBC, 0x00, 0x24, 0xA6, 0xF5, 0xFE, 0xDC, 0x6F, 0x00, 0x00, 0x00, 0xAC, 0xB8, 0x00,
-0x00, 0x00, 0x00, 0x04, 0x7D, 0xDC, 0xF7, 0xE0, 0xA3, 0x21, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xF9,
-0xFF, 0xF7, 0x11, 0x00, 0x00, 0xD9, 0xFF, 0xA3, 0x01, 0x13, 0x41, 0x00, 0x00, 0x00, 0xF8, 0xFF,
-0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x42, 0xB8, 0xFE, 0xFF, 0xD3, 0xB8, 0xB8, 0x25, 0x00,
-0x00, 0x00, 0xFC, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x48, 0x00, 0x00,
-0x00, 0x00, 0x05, 0x92, 0xFF, 0xBF, 0x0C, 0x08, 0x08, 0x08, 0x05, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xB0, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x27, 0x2E,
-0x00, 0x00, 0x00, 0x2A, 0x2D, 0x00, 0x03, 0xD9, 0xEC, 0xC9, 0xF7, 0xC9, 0xE9, 0xE0, 0x07, 0x00,
-0x54, 0xFF, 0xEB, 0xA8, 0xEA, 0xFF, 0x57, 0x00, 0x00, 0x7B, 0xFF, 0x37, 0x00, 0x30, 0xFF, 0x80,
-0x00, 0x00, 0x7C, 0xFF, 0x36, 0x00, 0x30, 0xFF, 0x81, 0x00, 0x00, 0x53, 0xFF, 0xEC, 0xAB, 0xEB,
-0xFF, 0x56, 0x00, 0x03, 0xD7, 0xEC, 0xCE, 0xF8, 0xCD, 0xEC, 0xDD, 0x04, 0x00, 0x26, 0x2F, 0x00,
-0x00, 0x00, 0x2E, 0x2C, 0x00, 0xB7, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xAD, 0x3B, 0xFF,
-0xFB, 0x1A, 0x00, 0x1F, 0xFD, 0xFF, 0x31, 0x00, 0xC0, 0xFF, 0x80, 0x00, 0x87, 0xFF, 0xB3, 0x00,
-0x00, 0x45, 0xFF, 0xE5, 0x0B, 0xEA, 0xFF, 0x37, 0x00, 0x00, 0x00, 0xC9, 0xFF, 0xAE, 0xFF, 0xBA,
-0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x88, 0x00, 0x00, 0x36, 0x64, 0xC5, 0xFF, 0xC5, 0x64, 0x35, 0x00, 0x00, 0x00, 0x00,
-0xA0, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00,
-0x36, 0x64, 0xC5, 0xFF, 0xC5, 0x64, 0x35, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xA0, 0x00, 0x00,
-0x00, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54,
-0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF, 0x54, 0x60, 0xFF,
-0x54, 0x60, 0xFF, 0x54, 0x00, 0x1B, 0xA5, 0xE9, 0xF5, 0xD4, 0x88, 0x02, 0x00, 0xC7, 0xFE, 0x9D,
-0x8F, 0xC8, 0xB8, 0x00, 0x01, 0xFC, 0xF0, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0xB0, 0xFF, 0xCC,
-0x4A, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0xD1, 0x2F, 0x00, 0x00, 0xE2, 0xE3, 0x1D,
-0x77, 0xFC, 0xE7, 0x06, 0x02, 0xFB, 0xD7, 0x05, 0x00, 0xB1, 0xFF, 0x16, 0x00, 0xB2, 0xFF, 0xC8,
-0x51, 0xE4, 0xC0, 0x00, 0x00, 0x0C, 0x9B, 0xFB, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x21,
-0xA2, 0xFF, 0xF8, 0x07, 0x08, 0x0A, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0x10, 0x28, 0xF2, 0xA9, 0x82,
-0x9D, 0xFE, 0xB8, 0x00, 0x10, 0x9E, 0xE1, 0xF8, 0xE2, 0x94, 0x11, 0x00, 0x00, 0x0C, 0x00, 0x00,
-0x09, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00,
-0x00, 0x1F, 0x92, 0xD8, 0xDC, 0xD8, 0x92, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xD6, 0x5B,
-0x06, 0x00, 0x05, 0x5C, 0xD7, 0x49, 0x00, 0x00, 0x00, 0x25, 0xD6, 0x1A, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x19, 0xD4, 0x26, 0x00, 0x00, 0xA9, 0x49, 0x00, 0x2E, 0xBD, 0xF2, 0xE7, 0x68, 0x00, 0x41,
-0xAB, 0x00, 0x0B, 0xD8, 0x01, 0x0C, 0xE4, 0x8E, 0x16, 0x2A, 0x27, 0x00, 0x00, 0xD2, 0x0D, 0x2C,
-0xAF, 0x00, 0x42, 0xF8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x2F, 0x2D, 0xAF, 0x00, 0x44,
-0xF7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x2F, 0x0C, 0xD7, 0x00, 0x0F, 0xEC, 0x83, 0x18,
-0x25, 0x27, 0x00, 0x00, 0xD0, 0x0E, 0x00, 0xAE, 0x47, 0x00, 0x39, 0xC6, 0xF4, 0xE6, 0x4D, 0x00,
-0x3D, 0xAE, 0x00, 0x00, 0x28, 0xD7, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xD1, 0x28, 0x00,
-0x00, 0x00, 0x4A, 0xD6, 0x57, 0x04, 0x00, 0x03, 0x54, 0xD4, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x21, 0x94, 0xD6, 0xD7, 0xD5, 0x95, 0x21, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xEA, 0xF0, 0x8F, 0x00,
-0x01, 0x4B, 0x08, 0x5D, 0xFF, 0x37, 0x12, 0xA2, 0xE2, 0xF3, 0xFF, 0x5A, 0x87, 0xFE, 0x32, 0x3D,
-0xFF, 0x5C, 0x92, 0xFE, 0x4C, 0xB3, 0xFF, 0x5C, 0x29, 0xD7, 0xEF, 0x93, 0xD7, 0x5C, 0x00, 0x00,
-0x0C, 0xC3, 0x82, 0x0A, 0x0C, 0xC3, 0x83, 0x0B, 0x00, 0x03, 0xB4, 0xFF, 0xBD, 0x07, 0xB3, 0xFF,
-0xC0, 0x05, 0x00, 0x92, 0xFF, 0xDB, 0x12, 0x8F, 0xFF, 0xDD, 0x13, 0x00, 0x35, 0xFF, 0xFF, 0x4D,
-0x31, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xDA, 0x11, 0x92, 0xFF, 0xDD, 0x13, 0x00,
-0x00, 0x03, 0xB6, 0xFF, 0xBC, 0x07, 0xB4, 0xFF, 0xC0, 0x05, 0x00, 0x00, 0x0D, 0xC4, 0x83, 0x0A,
-0x0C, 0xC4, 0x84, 0x0B, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0x3C, 0xB8, 0xB8,
-0xB8, 0xB8, 0xB8, 0xD3, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x58, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
-0x58, 0x88, 0xFF, 0xFF, 0xFF, 0x88, 0x81, 0xF4, 0xF4, 0xF4, 0x81, 0x00, 0x00, 0x00, 0x1F, 0x92,
-0xD8, 0xDC, 0xD8, 0x92, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xD6, 0x5B, 0x06, 0x00, 0x05,
-0x5C, 0xD7, 0x49, 0x00, 0x00, 0x00, 0x25, 0xD6, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xD4,
-0x26, 0x00, 0x00, 0xA9, 0x49, 0x00, 0xA4, 0xFF, 0xFA, 0xD8, 0x4A, 0x00, 0x41, 0xAB, 0x00, 0x0B,
-0xD8, 0x01, 0x00, 0xA4, 0x95, 0x0A, 0x95, 0xCC, 0x00, 0x00, 0xD2, 0x0D, 0x2C, 0xAF, 0x00, 0x00,
-0xA4, 0x94, 0x07, 0x9D, 0x9A, 0x00, 0x00, 0xA8, 0x2F, 0x2D, 0xAF, 0x00, 0x00, 0xA4, 0xFE, 0xFD,
-0xD6, 0x02, 0x00, 0x00, 0xA7, 0x2F, 0x0C, 0xD7, 0x00, 0x00, 0xA4, 0x94, 0x20, 0xED, 0x6A, 0x00,
-0x00, 0xD0, 0x0E, 0x00, 0xAE, 0x47, 0x00, 0xA4, 0x94, 0x00, 0x47, 0xF3, 0x28, 0x3D, 0xAE, 0x00,
-0x00, 0x28, 0xD7, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xD1, 0x28, 0x00, 0x00, 0x00, 0x4A,
-0xD6, 0x57, 0x04, 0x00, 0x03, 0x54, 0xD4, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x94, 0xD6,
-0xD7, 0xD5, 0x95, 0x21, 0x00, 0x00, 0x00, 0x20, 0xBC, 0xBC, 0xBC, 0xBC, 0x05, 0x2C, 0xFF, 0xFF,
-0xFF, 0xFF, 0x08, 0x09, 0x38, 0x38, 0x38, 0x38, 0x01, 0x00, 0x2D, 0xCD, 0xF7, 0xC8, 0x31, 0x00,
-0x0F, 0xED, 0xD8, 0x86, 0xDF, 0xE7, 0x08, 0x39, 0xFF, 0x4C, 0x00, 0x55, 0xFF, 0x2E, 0x0E, 0xEE,
-0xD8, 0x85, 0xDB, 0xE9, 0x09, 0x00, 0x3A, 0xCB, 0xF7, 0xCB, 0x35, 0x00, 0x00, 0x00, 0x00, 0x02,
-0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x58, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x5C, 0x00, 0x00, 0x00,
-0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x3C, 0xB8, 0xB8, 0xD0, 0xFF, 0xD1, 0xB8,
-0xB8, 0x39, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF,
-0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xB8, 0x42, 0x00, 0x00, 0x00, 0x3C, 0xB8, 0xB8,
-0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0x39, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x24,
-0xAE, 0xF3, 0xEC, 0x81, 0x00, 0x44, 0xEE, 0x98, 0xE7, 0xFF, 0x2C, 0x00, 0x0B, 0x00, 0xBB, 0xFF,
-0x28, 0x00, 0x00, 0x62, 0xFF, 0xA6, 0x00, 0x00, 0x60, 0xFD, 0xB3, 0x07, 0x00, 0x58, 0xFE, 0xF6,
-0x94, 0x90, 0x41, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x29, 0xB2, 0xEC, 0xE9, 0x72, 0x00, 0x22,
-0xBE, 0x69, 0xCE, 0xFF, 0x16, 0x00, 0x20, 0x48, 0xC8, 0xD8, 0x07, 0x00, 0x80, 0xFF, 0xF9, 0x6C,
-0x00, 0x00, 0x00, 0x0B, 0x8C, 0xFF, 0x41, 0x80, 0x8E, 0x5D, 0xB8, 0xFF, 0x41, 0x51, 0xD6, 0xF8,
-0xE4, 0x81, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x27,
-0xF7, 0xCA, 0x17, 0x00, 0x00, 0xB4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x9C, 0xB4, 0xFF,
-0xB0, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x9C, 0xB4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x9C,
-0xB4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0x9C, 0xB4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xD0,
-0xFF, 0x9C, 0xB4, 0xFF, 0xB9, 0x00, 0x00, 0x03, 0xED, 0xFF, 0x9C, 0xB4, 0xFF, 0xF0, 0x1D, 0x02,
-0x72, 0xFF, 0xFF, 0x9C, 0xB4, 0xFF, 0xFF, 0xFD, 0xF5, 0xFF, 0xE7, 0xFF, 0x9C, 0xB4, 0xFF, 0xCB,
-0xD2, 0xF5, 0x9C, 0x53, 0xFF, 0x9C, 0xB4, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x93, 0xE1, 0xFE, 0xFF,
-0xFF, 0xFF, 0xC4, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xC8, 0xC4, 0x05, 0xF8, 0xFF, 0xFF,
-0xFF, 0xFF, 0x54, 0x80, 0xC4, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x80, 0xC4, 0x1B, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x80, 0xC4, 0x03, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x80, 0xC4,
-0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x80, 0xC4, 0x00, 0x11, 0xA5, 0xEB, 0xEF, 0xFD, 0x54,
-0x80, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x54, 0x80, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xF0, 0x54, 0x80, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x54, 0x80, 0xC4, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xF0, 0x54, 0x80, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x54, 0x80, 0xC4, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xF0, 0x54, 0x80, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x54, 0x80,
-0xC4, 0x54, 0x9F, 0x52, 0xF3, 0xFF, 0xF2, 0xA2, 0xF7, 0x9F, 0x00, 0x7E, 0xFF, 0x17, 0x00, 0x00,
-0xAE, 0xFF, 0xA9, 0x02, 0x0E, 0x19, 0xD9, 0xFF, 0x15, 0x43, 0xF6, 0xEE, 0x8E, 0x00, 0x00, 0x02,
-0x8A, 0xFF, 0x88, 0x0B, 0xB1, 0xF8, 0xFF, 0x88, 0x09, 0xB6, 0x74, 0xFF, 0x88, 0x00, 0x00, 0x53,
-0xFF, 0x88, 0x00, 0x00, 0x54, 0xFF, 0x88, 0x00, 0x00, 0x54, 0xFF, 0x88, 0x00, 0x00, 0x54, 0xFF,
-0x88, 0x00, 0x7A, 0xE6, 0xE8, 0x7B, 0x00, 0x40, 0xFF, 0x8D, 0x87, 0xFF, 0x48, 0x7F, 0xFF, 0x0F,
-0x07, 0xFF, 0x8D, 0x7E, 0xFF, 0x10, 0x08, 0xFF, 0x8D, 0x3A, 0xFF, 0x8E, 0x89, 0xFF, 0x4C, 0x00,
-0x71, 0xE7, 0xE9, 0x81, 0x00, 0x0D, 0x87, 0xBF, 0x09, 0x0C, 0x85, 0xC1, 0x0A, 0x00, 0x00, 0x07,
-0xC7, 0xFF, 0xAC, 0x08, 0xC4, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x17, 0xE1, 0xFF, 0x86, 0x15, 0xDF,
-0xFF, 0x8A, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0x2A, 0x55, 0xFF, 0xFF, 0x2D, 0x00, 0x17, 0xE1,
-0xFF, 0x89, 0x15, 0xDF, 0xFF, 0x8D, 0x00, 0x07, 0xC6, 0xFF, 0xAD, 0x08, 0xC3, 0xFF, 0xB1, 0x02,
-0x00, 0x0E, 0x88, 0xC0, 0x0A, 0x0C, 0x86, 0xC2, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x8A, 0xFF, 0x88,
-0x00, 0x00, 0x00, 0x19, 0xF6, 0xCB, 0x00, 0x00, 0x0B, 0xB1, 0xF8, 0xFF, 0x88, 0x00, 0x00, 0x00,
-0x96, 0xFF, 0x46, 0x00, 0x00, 0x09, 0xB6, 0x74, 0xFF, 0x88, 0x00, 0x00, 0x21, 0xFA, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0x88, 0x00, 0x00, 0xA2, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x54, 0xFF, 0x88, 0x00, 0x2A, 0xFD, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF,
-0x88, 0x00, 0xAE, 0xFE, 0x30, 0x48, 0xFE, 0xE8, 0x00, 0x00, 0x00, 0x54, 0xFF, 0x88, 0x34, 0xFF,
-0xA8, 0x15, 0xE6, 0xFB, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFC, 0x27, 0xB3, 0xA3,
-0xF0, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x9C, 0x6B, 0xDD, 0x0F, 0xF4, 0xE8, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC5, 0xF8, 0x1D, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-0x4C, 0xFF, 0x90, 0x00, 0x48, 0x50, 0x50, 0xF7, 0xEF, 0x46, 0x00, 0x00, 0x01, 0xCF, 0xF4, 0x16,
-0x00, 0x00, 0x00, 0x00, 0xF4, 0xE8, 0x00, 0x00, 0x02, 0x8A, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x19,
-0xF6, 0xCB, 0x00, 0x00, 0x00, 0x0B, 0xB1, 0xF8, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x96, 0xFF, 0x46,
-0x00, 0x00, 0x00, 0x09, 0xB6, 0x74, 0xFF, 0x88, 0x00, 0x00, 0x21, 0xFA, 0xC0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x53, 0xFF, 0x88, 0x00, 0x00, 0xA2, 0xFF, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x54, 0xFF, 0x88, 0x00, 0x2A, 0xFD, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-0xFF, 0x88, 0x00, 0xAE, 0xFE, 0x54, 0xAE, 0xF3, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x54, 0xFF, 0x88,
-0x34, 0xFF, 0xA8, 0x44, 0xEE, 0x98, 0xE7, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFC,
-0x26, 0x00, 0x0B, 0x00, 0xBB, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x9C, 0x00, 0x00,
-0x00, 0x62, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xF8, 0x1D, 0x00, 0x00, 0x60, 0xFD,
-0xB3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x90, 0x00, 0x00, 0x58, 0xFE, 0xF6, 0x94, 0x90,
-0x41, 0x00, 0x00, 0x01, 0xCF, 0xF4, 0x16, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x29,
-0xB2, 0xEC, 0xE9, 0x72, 0x00, 0x00, 0x00, 0x19, 0xF6, 0xCB, 0x00, 0x00, 0x22, 0xBE, 0x69, 0xCE,
-0xFF, 0x16, 0x00, 0x00, 0x96, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x20, 0x48, 0xC8, 0xD8, 0x07, 0x00,
-0x21, 0xFA, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xF9, 0x6C, 0x00, 0x00, 0xA2, 0xFF, 0x3A,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x8C, 0xFF, 0x41, 0x2A, 0xFD, 0xB4, 0x00, 0x00, 0x00, 0x00,
-0x80, 0x8E, 0x5D, 0xB8, 0xFF, 0x41, 0xAE, 0xFE, 0x30, 0x48, 0xFE, 0xE8, 0x00, 0x51, 0xD6, 0xF8,
-0xE4, 0x81, 0x34, 0xFF, 0xA8, 0x15, 0xE6, 0xFB, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA,
-0xFC, 0x27, 0xB3, 0xA3, 0xF0, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x9C, 0x6B, 0xDD,
-0x0F, 0xF4, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xF8, 0x1D, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
-0xE0, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x90, 0x00, 0x48, 0x50, 0x50, 0xF7, 0xEF, 0x46, 0x00, 0x00,
-0x01, 0xCF, 0xF4, 0x16, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xF5,
-0xBA, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x33, 0x9E,
-0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF,
-0xB9, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC4, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x26, 0xD7, 0xFF, 0xCF,
-0x11, 0x00, 0x00, 0x15, 0xE6, 0xFF, 0xA7, 0x0A, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xE3, 0x02, 0x00,
-0x00, 0x00, 0x00, 0x73, 0xFF, 0xE4, 0x14, 0x01, 0x21, 0x73, 0x3F, 0x23, 0xF6, 0xFF, 0xFC, 0xF7,
-0xFF, 0xFF, 0xC8, 0x00, 0x32, 0xAF, 0xE6, 0xFA, 0xE1, 0xA0, 0x3C, 0x00, 0x00, 0x1E, 0xE4, 0xFF,
-0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x22, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21, 0xFB, 0xFF,
-0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D, 0x00, 0x26,
-0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00,
-0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E, 0x08, 0x08,
-0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0x7E,
-0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x22, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21, 0xFB, 0xFF,
-0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D, 0x00, 0x26,
-0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00,
-0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E, 0x08, 0x08,
-0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0x7E,
-0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x01, 0xC2,
-0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB, 0xD5, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x22, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21, 0xFB, 0xFF,
-0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D, 0x00, 0x26,
-0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00,
-0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E, 0x08, 0x08,
-0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0x7E,
-0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x58, 0xE9,
-0xB6, 0x17, 0x08, 0xF6, 0x3D, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0xBF, 0xEA, 0xE8, 0xBE, 0xF0, 0x0C,
-0x00, 0x00, 0x00, 0x3E, 0xF6, 0x08, 0x19, 0xBA, 0xE8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x22, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21, 0xFB, 0xFF,
-0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D, 0x00, 0x26,
-0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00,
-0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E, 0x08, 0x08,
-0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0x7E,
-0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x22, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD3, 0xFF, 0xA9, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFC, 0x21, 0xFB, 0xFF,
-0x24, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xC3, 0x00, 0xBF, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x2D, 0x00, 0x26,
-0xFF, 0xFF, 0x26, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00,
-0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x2A, 0xFF, 0xFF, 0x4E, 0x08, 0x08,
-0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0x7E,
-0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x06, 0xB0,
-0xF3, 0xAA, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xE5, 0x36, 0xEC, 0x57, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x62, 0xDE, 0x1D, 0xE6, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFE, 0xFF, 0x76, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xA9, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
-0xFF, 0xFC, 0x21, 0xFB, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xC3, 0x00, 0xBF, 0xFF,
-0x78, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0x78, 0x00, 0x72, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x27,
-0xFF, 0xFF, 0x2D, 0x00, 0x26, 0xFF, 0xFF, 0x25, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x7B, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x29,
-0xFF, 0xFF, 0x4E, 0x08, 0x08, 0x08, 0x4F, 0xFF, 0xFF, 0x28, 0x80, 0xFF, 0xF8, 0x0A, 0x00, 0x00,
-0x00, 0x0A, 0xF8, 0xFF, 0x7E, 0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xD4,
-0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
-0x00, 0x00, 0x00, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFC, 0x0F, 0x00, 0x00,
-0x00, 0x0F, 0xF4, 0xFF, 0x41, 0xA9, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x70, 0xFF, 0xD3, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD9,
-0xFF, 0x6E, 0x00, 0xA4, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xF8,
-0x12, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xA6, 0x00,
-0x00, 0xA4, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC4, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEB, 0xFF, 0x68, 0x08, 0x08, 0x08, 0xA6, 0xFF,
-0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x0D, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xCA, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x4A, 0xBA, 0xEA, 0xF4, 0xD5, 0x8C, 0x1E, 0x00, 0x00,
-0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x3C, 0xFE, 0xFF, 0xAC, 0x21, 0x14, 0x4D,
-0x8E, 0x00, 0x00, 0xAB, 0xFF, 0xE9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x93,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x11, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFF, 0x8B, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xDE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
-0xFF, 0xFF, 0xA6, 0x26, 0x0E, 0x31, 0x77, 0x04, 0x00, 0x01, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x08, 0x00, 0x00, 0x05, 0x72, 0xD1, 0xF6, 0xF3, 0xD6, 0x92, 0x03, 0x00, 0x00, 0x00, 0x00,
-0x7E, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xA9, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x0E, 0x19, 0xD9, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xF6, 0xEE,
-0x8E, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xDE,
-0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFC,
-0xFC, 0xFC, 0xFC, 0x0B, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC4, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x6A,
-0xFF, 0xDC, 0x20, 0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFC,
-0xFC, 0xFC, 0xFC, 0x0B, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC4, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB,
-0xD5, 0xFF, 0x74, 0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFC,
-0xFC, 0xFC, 0xFC, 0x0B, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC4, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47,
-0x5C, 0xFC, 0x88, 0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFC,
-0xFC, 0xFC, 0xFC, 0x0B, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xC4, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xC0, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x90, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x0C, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00,
-0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
-0xFF, 0xA8, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x28,
-0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00,
-0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF,
-0x44, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x8C, 0xFF,
-0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x6A, 0xFF, 0xDC,
-0x20, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x00, 0x00, 0x29,
-0xFF, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF,
-0x44, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00,
-0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00,
-0x29, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x00, 0x8C, 0xFF, 0xFF,
-0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB,
-0xD5, 0xFF, 0x74, 0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x47, 0xDF, 0xFF,
-0xFF, 0xE8, 0x5A, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
-0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
-0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF,
-0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF,
-0xFF, 0x45, 0x00, 0x00, 0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
-0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88,
-0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF,
-0xFF, 0xA8, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x28,
-0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00,
-0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x28, 0xFF, 0xFF,
-0x44, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0x45, 0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xE8, 0x5A, 0x8C, 0xFF,
-0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF7, 0xDD, 0x9C, 0x2B, 0x00, 0x00, 0x00,
-0x00, 0x8C, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFA, 0x5E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xE0,
-0x00, 0x04, 0x37, 0xC9, 0xFF, 0xFA, 0x2F, 0x00, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x19,
-0xF7, 0xFF, 0xA3, 0x00, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xE5, 0x00,
-0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x8A, 0xFF, 0xFD, 0x02, 0x99, 0xFE, 0xFF, 0xFF,
-0xFC, 0xB9, 0x00, 0x00, 0x8E, 0xFF, 0xFB, 0x00, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-0xB2, 0xFF, 0xDD, 0x00, 0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x24, 0xFB, 0xFF, 0x98, 0x00,
-0x00, 0x8C, 0xFF, 0xE0, 0x00, 0x17, 0x51, 0xE0, 0xFF, 0xF5, 0x24, 0x00, 0x00, 0x8C, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4E, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xF3, 0xD2, 0x8D,
-0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xE9, 0xB6, 0x17, 0x08, 0xF6, 0x3D, 0x00, 0x00,
-0x00, 0x0C, 0xF1, 0xBF, 0xEA, 0xE8, 0xBE, 0xF0, 0x0C, 0x00, 0x00, 0x00, 0x3E, 0xF6, 0x08, 0x19,
-0xBA, 0xE8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x90, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0xFF, 0xFF, 0x4F,
-0x00, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0xFE, 0xFF, 0xD8, 0x04, 0x00, 0x00, 0xA0, 0xFF,
-0x90, 0x90, 0xFF, 0xAA, 0xFD, 0xFF, 0x69, 0x00, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0x8B, 0x9F,
-0xFF, 0xE9, 0x0D, 0x00, 0xA0, 0xFF, 0x90, 0x90, 0xFF, 0x96, 0x1C, 0xF6, 0xFF, 0x83, 0x00, 0x9F,
-0xFF, 0x90, 0x90, 0xFF, 0x9B, 0x00, 0x87, 0xFF, 0xF5, 0x1B, 0x9B, 0xFF, 0x90, 0x90, 0xFF, 0x9C,
-0x00, 0x0F, 0xEB, 0xFF, 0x9E, 0x92, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x6F, 0xFF, 0xFD,
-0xB4, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x05, 0xDC, 0xFF, 0xFF, 0xFF, 0x90, 0x90, 0xFF,
-0x9C, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xFF, 0x90, 0x90, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00,
-0xC9, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00,
-0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE, 0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00,
-0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE,
-0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF, 0xFF, 0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1,
-0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14, 0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB,
-0xB2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00,
-0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE, 0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00,
-0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE,
-0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF, 0xFF, 0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1,
-0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14, 0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB,
-0xB2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB, 0xD5, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46,
-0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00,
-0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE, 0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00,
-0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE,
-0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF, 0xFF, 0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1,
-0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14, 0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB,
-0xB2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xE9, 0xB6, 0x17, 0x08, 0xF6, 0x3D, 0x00,
-0x00, 0x00, 0x00, 0x0C, 0xF1, 0xBF, 0xEA, 0xE8, 0xBE, 0xF0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3E,
-0xF6, 0x08, 0x19, 0xBA, 0xE8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00,
-0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE, 0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00,
-0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE,
-0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF, 0xFF, 0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1,
-0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14, 0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB,
-0xB2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB5, 0xEA, 0xFB, 0xEA, 0xB3, 0x45, 0x00, 0x00,
-0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xC7, 0x36, 0x10, 0x3A, 0xCE, 0xFF, 0xFE, 0x38, 0x00, 0xB1, 0xFF, 0xF3, 0x10, 0x00, 0x00, 0x00,
-0x19, 0xF9, 0xFF, 0xA3, 0x00, 0xEC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xDE,
-0x04, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x89,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xDE, 0x00, 0xAF, 0xFF, 0xF3, 0x11, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0xFF, 0xA1,
-0x00, 0x44, 0xFF, 0xFF, 0xC9, 0x39, 0x14, 0x3D, 0xD1, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x86, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xB6, 0xEC, 0xFB, 0xEB,
-0xB2, 0x44, 0x00, 0x00, 0x24, 0x64, 0x00, 0x00, 0x00, 0x54, 0x38, 0x00, 0xBC, 0xFF, 0x70, 0x00,
-0x59, 0xFC, 0xDA, 0x04, 0x1A, 0xDB, 0xFF, 0xA7, 0xFD, 0xE7, 0x28, 0x00, 0x00, 0x1B, 0xE4, 0xFF,
-0xF0, 0x28, 0x00, 0x00, 0x00, 0x57, 0xFC, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x53, 0xFB, 0xE7, 0x44,
-0xDB, 0xFF, 0x6A, 0x00, 0x9F, 0xE6, 0x27, 0x00, 0x1B, 0xDA, 0xBD, 0x02, 0x03, 0x1D, 0x00, 0x00,
-0x00, 0x18, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x00,
-0x00, 0x00, 0x00, 0x49, 0xB4, 0xEA, 0xFA, 0xE7, 0xB0, 0xC1, 0xE5, 0x08, 0x00, 0x00, 0x85, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0xC7, 0x36, 0x0D, 0x51,
-0xFF, 0xFF, 0xFE, 0x39, 0x00, 0xB0, 0xFF, 0xF3, 0x10, 0x00, 0x01, 0xBC, 0xF8, 0xF5, 0xFF, 0xA3,
-0x00, 0xEB, 0xFF, 0xA8, 0x00, 0x00, 0x68, 0xFF, 0x7C, 0xB4, 0xFF, 0xDE, 0x04, 0xFF, 0xFF, 0x89,
-0x00, 0x20, 0xF3, 0xD1, 0x05, 0x95, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0x85, 0x01, 0xBD, 0xFC, 0x35,
-0x00, 0x9A, 0xFF, 0xF7, 0x00, 0xEB, 0xFF, 0xA6, 0x6A, 0xFF, 0x8C, 0x00, 0x00, 0xB7, 0xFF, 0xDE,
-0x00, 0xAF, 0xFF, 0xF0, 0xF3, 0xDC, 0x0A, 0x00, 0x17, 0xF8, 0xFF, 0xA1, 0x00, 0x43, 0xFF, 0xFF,
-0xFF, 0x75, 0x10, 0x38, 0xCC, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x77, 0x00, 0x00, 0x09, 0xEB, 0xD0, 0xB5, 0xEA, 0xFB, 0xEA, 0xB2, 0x43, 0x00, 0x00,
-0x00, 0x00, 0x2E, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE4, 0xFF,
-0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF,
-0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8,
-0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA6, 0xFF, 0xCA, 0x00, 0x00, 0x00,
-0x00, 0xC7, 0xFF, 0xA6, 0x93, 0xFF, 0xEB, 0x04, 0x00, 0x00, 0x04, 0xEA, 0xFF, 0x8E, 0x4E, 0xFF,
-0xFF, 0x8F, 0x1C, 0x1B, 0x8F, 0xFF, 0xFF, 0x46, 0x01, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA9, 0x00, 0x00, 0x05, 0x77, 0xD3, 0xF8, 0xF3, 0xCC, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF,
-0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8,
-0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA6, 0xFF, 0xCA, 0x00, 0x00, 0x00,
-0x00, 0xC7, 0xFF, 0xA6, 0x93, 0xFF, 0xEB, 0x04, 0x00, 0x00, 0x04, 0xEA, 0xFF, 0x8E, 0x4E, 0xFF,
-0xFF, 0x8F, 0x1C, 0x1B, 0x8F, 0xFF, 0xFF, 0x46, 0x01, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA9, 0x00, 0x00, 0x05, 0x77, 0xD3, 0xF8, 0xF3, 0xCC, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x01, 0xC2,
-0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB, 0xD5, 0xFF, 0x74, 0x00, 0x00,
-0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF,
-0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8,
-0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA6, 0xFF, 0xCA, 0x00, 0x00, 0x00,
-0x00, 0xC7, 0xFF, 0xA6, 0x93, 0xFF, 0xEB, 0x04, 0x00, 0x00, 0x04, 0xEA, 0xFF, 0x8E, 0x4E, 0xFF,
-0xFF, 0x8F, 0x1C, 0x1B, 0x8F, 0xFF, 0xFF, 0x46, 0x01, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA9, 0x00, 0x00, 0x05, 0x77, 0xD3, 0xF8, 0xF3, 0xCC, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00, 0x00,
-0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF,
-0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8,
-0xA8, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA8, 0xA6, 0xFF, 0xCA, 0x00, 0x00, 0x00,
-0x00, 0xC7, 0xFF, 0xA6, 0x93, 0xFF, 0xEB, 0x04, 0x00, 0x00, 0x04, 0xEA, 0xFF, 0x8E, 0x4E, 0xFF,
-0xFF, 0x8F, 0x1C, 0x1B, 0x8F, 0xFF, 0xFF, 0x46, 0x01, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA9, 0x00, 0x00, 0x05, 0x77, 0xD3, 0xF8, 0xF3, 0xCC, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xDA, 0x02, 0x00, 0x00, 0x02, 0xD7, 0xFF, 0xBD, 0x3B, 0xFF,
-0xFF, 0x58, 0x00, 0x00, 0x56, 0xFF, 0xFF, 0x39, 0x00, 0xB8, 0xFF, 0xD2, 0x01, 0x01, 0xD0, 0xFF,
-0xB4, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0x4E, 0x4E, 0xFF, 0xFE, 0x31, 0x00, 0x00, 0x00, 0xB2, 0xFF,
-0xC9, 0xC9, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xFF, 0xFD, 0x29, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF,
-0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
-0xFF, 0xFF, 0xFA, 0xDA, 0x7B, 0x04, 0x00, 0x90, 0xFF, 0xFE, 0xF8, 0xFF, 0xFF, 0xFF, 0x98, 0x00,
-0x90, 0xFF, 0xDC, 0x00, 0x14, 0xAF, 0xFF, 0xFD, 0x15, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x38, 0xFF,
-0xFF, 0x3F, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0x3C, 0x90, 0xFF, 0xDC, 0x00, 0x17,
-0xB6, 0xFF, 0xF9, 0x0F, 0x90, 0xFF, 0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0x85, 0x00, 0x90, 0xFF, 0xFF,
-0xFF, 0xF8, 0xD1, 0x6A, 0x01, 0x00, 0x90, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xA7, 0xDF, 0xF7, 0xDE, 0x9D, 0x24,
-0x00, 0x00, 0x30, 0xF6, 0xFF, 0xFA, 0xE6, 0xFE, 0xFF, 0xF0, 0x1F, 0x00, 0xA4, 0xFF, 0xE3, 0x1A,
-0x00, 0x43, 0xFF, 0xFF, 0x78, 0x00, 0xC8, 0xFF, 0x9E, 0x00, 0x00, 0x04, 0xF7, 0xFF, 0x71, 0x00,
-0xCC, 0xFF, 0x98, 0x00, 0x00, 0x66, 0xFF, 0xF6, 0x1F, 0x00, 0xCC, 0xFF, 0x98, 0x00, 0x5C, 0xFB,
-0xF5, 0x49, 0x00, 0x00, 0xCC, 0xFF, 0x98, 0x00, 0xF0, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0xCC, 0xFF,
-0x98, 0x00, 0xDA, 0xFF, 0xF6, 0x6E, 0x01, 0x00, 0xCC, 0xFF, 0x98, 0x00, 0x29, 0xD4, 0xFF, 0xFF,
-0xB2, 0x02, 0xCC, 0xFF, 0x98, 0x00, 0x00, 0x06, 0x82, 0xFF, 0xFF, 0x57, 0xCC, 0xFF, 0x98, 0x19,
-0x0F, 0x00, 0x04, 0xF6, 0xFF, 0x7A, 0xCC, 0xFF, 0x98, 0x50, 0xF4, 0xC6, 0xD9, 0xFF, 0xFE, 0x3E,
-0xCC, 0xFF, 0x98, 0x2D, 0xCD, 0xF5, 0xF2, 0xCE, 0x5C, 0x00, 0x00, 0x1E, 0xE4, 0xFF, 0xBB, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26, 0xFC, 0xF6, 0xD1, 0xDC, 0xFF, 0xFD, 0x3F,
-0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xC6, 0xFF, 0x93, 0x00, 0x16, 0x8C, 0xD0, 0xEE, 0xF9, 0xFF,
-0xFF, 0xAF, 0x06, 0xD0, 0xFF, 0xED, 0x8F, 0x6C, 0xCF, 0xFF, 0xB0, 0x36, 0xFF, 0xFF, 0x4A, 0x00,
-0x00, 0xBC, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0x3E, 0x00, 0x2B, 0xF6, 0xFF, 0xB0, 0x0E, 0xEE, 0xFF,
-0xF0, 0xCA, 0xF8, 0xF4, 0xFF, 0xB0, 0x00, 0x42, 0xD1, 0xF9, 0xE5, 0x89, 0x3D, 0xFF, 0xB0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20,
-0x00, 0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x24, 0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26, 0xFC, 0xF6,
-0xD1, 0xDC, 0xFF, 0xFD, 0x3F, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xC6, 0xFF, 0x93, 0x00, 0x16,
-0x8C, 0xD0, 0xEE, 0xF9, 0xFF, 0xFF, 0xAF, 0x06, 0xD0, 0xFF, 0xED, 0x8F, 0x6C, 0xCF, 0xFF, 0xB0,
-0x36, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0xBC, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0x3E, 0x00, 0x2B, 0xF6,
-0xFF, 0xB0, 0x0E, 0xEE, 0xFF, 0xF0, 0xCA, 0xF8, 0xF4, 0xFF, 0xB0, 0x00, 0x42, 0xD1, 0xF9, 0xE5,
-0x89, 0x3D, 0xFF, 0xB0, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x79,
-0xFF, 0xCB, 0xD5, 0xFF, 0x74, 0x00, 0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D,
-0x00, 0x00, 0x26, 0xFC, 0xF6, 0xD1, 0xDC, 0xFF, 0xFD, 0x3F, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00,
-0xC6, 0xFF, 0x93, 0x00, 0x16, 0x8C, 0xD0, 0xEE, 0xF9, 0xFF, 0xFF, 0xAF, 0x06, 0xD0, 0xFF, 0xED,
-0x8F, 0x6C, 0xCF, 0xFF, 0xB0, 0x36, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0xBC, 0xFF, 0xB0, 0x3E, 0xFF,
-0xFF, 0x3E, 0x00, 0x2B, 0xF6, 0xFF, 0xB0, 0x0E, 0xEE, 0xFF, 0xF0, 0xCA, 0xF8, 0xF4, 0xFF, 0xB0,
-0x00, 0x42, 0xD1, 0xF9, 0xE5, 0x89, 0x3D, 0xFF, 0xB0, 0x00, 0x00, 0x58, 0xE9, 0xB6, 0x17, 0x08,
-0xF6, 0x3D, 0x00, 0x0C, 0xF1, 0xBF, 0xEA, 0xE8, 0xBE, 0xF0, 0x0C, 0x00, 0x3E, 0xF6, 0x08, 0x19,
-0xBA, 0xE8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x93,
-0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26, 0xFC, 0xF6, 0xD1, 0xDC, 0xFF, 0xFD, 0x3F, 0x00,
-0x00, 0x3C, 0x0A, 0x00, 0x00, 0xC6, 0xFF, 0x93, 0x00, 0x16, 0x8C, 0xD0, 0xEE, 0xF9, 0xFF, 0xFF,
-0xAF, 0x06, 0xD0, 0xFF, 0xED, 0x8F, 0x6C, 0xCF, 0xFF, 0xB0, 0x36, 0xFF, 0xFF, 0x4A, 0x00, 0x00,
-0xBC, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0x3E, 0x00, 0x2B, 0xF6, 0xFF, 0xB0, 0x0E, 0xEE, 0xFF, 0xF0,
-0xCA, 0xF8, 0xF4, 0xFF, 0xB0, 0x00, 0x42, 0xD1, 0xF9, 0xE5, 0x89, 0x3D, 0xFF, 0xB0, 0x00, 0x00,
-0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00,
-0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x24, 0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26, 0xFC, 0xF6, 0xD1,
-0xDC, 0xFF, 0xFD, 0x3F, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xC6, 0xFF, 0x93, 0x00, 0x16, 0x8C,
-0xD0, 0xEE, 0xF9, 0xFF, 0xFF, 0xAF, 0x06, 0xD0, 0xFF, 0xED, 0x8F, 0x6C, 0xCF, 0xFF, 0xB0, 0x36,
-0xFF, 0xFF, 0x4A, 0x00, 0x00, 0xBC, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0x3E, 0x00, 0x2B, 0xF6, 0xFF,
-0xB0, 0x0E, 0xEE, 0xFF, 0xF0, 0xCA, 0xF8, 0xF4, 0xFF, 0xB0, 0x00, 0x42, 0xD1, 0xF9, 0xE5, 0x89,
-0x3D, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xB0, 0xF4, 0xAB, 0x05, 0x00, 0x00, 0x00, 0x00, 0x51,
-0xEC, 0x38, 0xEE, 0x57, 0x00, 0x00, 0x00, 0x00, 0x52, 0xE8, 0x34, 0xEE, 0x57, 0x00, 0x00, 0x00,
-0x00, 0x06, 0xB2, 0xF5, 0xB0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x24, 0x93, 0xD7, 0xF3, 0xEE, 0xC4, 0x4D, 0x00, 0x00, 0x26, 0xFC, 0xF6, 0xD1, 0xDC, 0xFF,
-0xFD, 0x3F, 0x00, 0x00, 0x3C, 0x0A, 0x00, 0x00, 0xC6, 0xFF, 0x93, 0x00, 0x16, 0x8C, 0xD0, 0xEE,
-0xF9, 0xFF, 0xFF, 0xAF, 0x06, 0xD0, 0xFF, 0xED, 0x8F, 0x6C, 0xCF, 0xFF, 0xB0, 0x36, 0xFF, 0xFF,
-0x4A, 0x00, 0x00, 0xBC, 0xFF, 0xB0, 0x3E, 0xFF, 0xFF, 0x3E, 0x00, 0x2B, 0xF6, 0xFF, 0xB0, 0x0E,
-0xEE, 0xFF, 0xF0, 0xCA, 0xF8, 0xF4, 0xFF, 0xB0, 0x00, 0x42, 0xD1, 0xF9, 0xE5, 0x89, 0x3D, 0xFF,
-0xB0, 0x00, 0x24, 0x96, 0xD8, 0xF5, 0xF1, 0xB0, 0x2E, 0x8B, 0xE3, 0xF6, 0xD9, 0x75, 0x02, 0x00,
-0x00, 0x27, 0xFD, 0xF1, 0xCF, 0xF2, 0xFF, 0xFF, 0xFF, 0xEA, 0xC2, 0xF6, 0xFF, 0x8A, 0x00, 0x00,
-0x00, 0x36, 0x05, 0x00, 0x0E, 0xF9, 0xFF, 0xE3, 0x0E, 0x00, 0x42, 0xFF, 0xF9, 0x0D, 0x00, 0x00,
-0x31, 0x6F, 0x8F, 0x9B, 0xF9, 0xFF, 0xE1, 0xA0, 0xA0, 0xA3, 0xFF, 0xFF, 0x34, 0x00, 0x9A, 0xFF,
-0xFF, 0xE3, 0xC9, 0xFC, 0xFF, 0xFB, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x3A, 0x2B, 0xFF, 0xFF, 0x6E,
-0x00, 0x00, 0xF5, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0x37, 0x00,
-0x49, 0xFF, 0xFF, 0xEC, 0x24, 0x00, 0x00, 0x11, 0x40, 0x00, 0x11, 0xF0, 0xFF, 0xEC, 0xCB, 0xFC,
-0xE2, 0xC5, 0xFF, 0xF9, 0xD3, 0xDE, 0xFB, 0xBC, 0x00, 0x00, 0x42, 0xCF, 0xF8, 0xEA, 0xA4, 0x1C,
-0x0B, 0x87, 0xDE, 0xFB, 0xF4, 0xC9, 0x5E, 0x00, 0x00, 0x00, 0x60, 0xCF, 0xF7, 0xEE, 0xC2, 0x3A,
-0x00, 0x72, 0xFF, 0xFF, 0xFA, 0xFC, 0xFF, 0x2F, 0x07, 0xF0, 0xFF, 0xB6, 0x09, 0x08, 0x47, 0x00,
-0x35, 0xFF, 0xFF, 0x43, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00,
-0x3B, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0xFF, 0xB5, 0x0B, 0x07, 0x4E, 0x27,
-0x00, 0x90, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0x40, 0x00, 0x03, 0x7D, 0xDD, 0xFB, 0xF2, 0xAE, 0x19,
-0x00, 0x00, 0x00, 0x7E, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xA9, 0x02, 0x00,
-0x00, 0x00, 0x0E, 0x19, 0xD9, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x43, 0xF6, 0xEE, 0x8E, 0x00, 0x00,
-0x00, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xD5, 0xF9, 0xE9, 0x9D, 0x12, 0x00, 0x00, 0x73, 0xFF,
-0xFC, 0xC1, 0xE8, 0xFF, 0xBD, 0x00, 0x08, 0xF0, 0xFF, 0x6D, 0x00, 0x14, 0xF2, 0xFF, 0x3A, 0x38,
-0xFF, 0xFF, 0xB2, 0xA0, 0xA0, 0xEE, 0xFF, 0x65, 0x4B, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
-0x70, 0x3B, 0xFF, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF1, 0xFF, 0xA5, 0x03, 0x00,
-0x03, 0x46, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xE8, 0xD2, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x57, 0xC8,
-0xF6, 0xFA, 0xDC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00,
-0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xD5, 0xF9, 0xE9, 0x9D,
-0x12, 0x00, 0x00, 0x73, 0xFF, 0xFC, 0xC1, 0xE8, 0xFF, 0xBD, 0x00, 0x08, 0xF0, 0xFF, 0x6D, 0x00,
-0x14, 0xF2, 0xFF, 0x3A, 0x38, 0xFF, 0xFF, 0xB2, 0xA0, 0xA0, 0xEE, 0xFF, 0x65, 0x4B, 0xFF, 0xFF,
-0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x70, 0x3B, 0xFF, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-0xF1, 0xFF, 0xA5, 0x03, 0x00, 0x03, 0x46, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xE8, 0xD2, 0xF0, 0xF8,
-0x00, 0x00, 0x00, 0x57, 0xC8, 0xF6, 0xFA, 0xDC, 0x88, 0x00, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xFF,
-0xBA, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB, 0xD5, 0xFF, 0x74, 0x00, 0x00, 0x46, 0xFD, 0xB3,
-0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x65, 0xD5, 0xF9, 0xE9, 0x9D, 0x12, 0x00, 0x00, 0x73, 0xFF, 0xFC, 0xC1, 0xE8, 0xFF, 0xBD, 0x00,
-0x08, 0xF0, 0xFF, 0x6D, 0x00, 0x14, 0xF2, 0xFF, 0x3A, 0x38, 0xFF, 0xFF, 0xB2, 0xA0, 0xA0, 0xEE,
-0xFF, 0x65, 0x4B, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x70, 0x3B, 0xFF, 0xFF, 0x32, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x09, 0xF1, 0xFF, 0xA5, 0x03, 0x00, 0x03, 0x46, 0x00, 0x00, 0x6E, 0xFF,
-0xFF, 0xE8, 0xD2, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x57, 0xC8, 0xF6, 0xFA, 0xDC, 0x88, 0x00, 0x00,
-0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88,
-0x00, 0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xD5, 0xF9, 0xE9, 0x9D, 0x12, 0x00, 0x00, 0x73, 0xFF, 0xFC,
-0xC1, 0xE8, 0xFF, 0xBD, 0x00, 0x08, 0xF0, 0xFF, 0x6D, 0x00, 0x14, 0xF2, 0xFF, 0x3A, 0x38, 0xFF,
-0xFF, 0xB2, 0xA0, 0xA0, 0xEE, 0xFF, 0x65, 0x4B, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x70,
-0x3B, 0xFF, 0xFF, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF1, 0xFF, 0xA5, 0x03, 0x00, 0x03,
-0x46, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xE8, 0xD2, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x57, 0xC8, 0xF6,
-0xFA, 0xDC, 0x88, 0x00, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00,
-0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF,
-0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF,
-0xAC, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x27, 0xF7,
-0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF,
-0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB, 0xD5, 0xFF, 0x74, 0x00,
-0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x96, 0xFD,
-0x47, 0x5C, 0xFC, 0x88, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC,
-0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8,
-0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00,
-0x00, 0xB8, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x9A, 0x26, 0x78, 0x9F, 0x00, 0x00,
-0x00, 0x00, 0x09, 0xE1, 0xFF, 0xFF, 0xFF, 0xE6, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xFB, 0x26, 0x00, 0x00, 0x00, 0x00, 0x22, 0xF3, 0x99, 0x48, 0xF9, 0xC0, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x4F, 0x00, 0x00, 0x86, 0xFF, 0x63, 0x00, 0x00, 0x03, 0x7B, 0xDE, 0xFC, 0xFF, 0xFF, 0xFF,
-0xCE, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xDB, 0xDD, 0xFF, 0xFF, 0xFE, 0x13, 0x12, 0xFB, 0xFF, 0x8C,
-0x00, 0x00, 0x93, 0xFF, 0xFF, 0x2F, 0x3E, 0xFF, 0xFF, 0x35, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0x3A,
-0x3D, 0xFF, 0xFF, 0x36, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0x21, 0x0D, 0xF7, 0xFF, 0x95, 0x00, 0x00,
-0xA2, 0xFF, 0xDA, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0xDC, 0xDE, 0xFF, 0xFD, 0x4D, 0x00, 0x00, 0x00,
-0x5C, 0xCB, 0xF7, 0xF5, 0xC1, 0x43, 0x00, 0x00, 0x00, 0x00, 0x58, 0xE9, 0xB6, 0x17, 0x08, 0xF6,
-0x3D, 0x00, 0x0C, 0xF1, 0xBF, 0xEA, 0xE8, 0xBE, 0xF0, 0x0C, 0x00, 0x3E, 0xF6, 0x08, 0x19, 0xBA,
-0xE8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x45, 0x83,
-0xE2, 0xF6, 0xD2, 0x54, 0x00, 0xB0, 0xFF, 0xE8, 0xFF, 0xF6, 0xFE, 0xFF, 0xFD, 0x34, 0xB0, 0xFF,
-0xFF, 0x72, 0x02, 0x26, 0xF8, 0xFF, 0x83, 0xB0, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xC9, 0xFF, 0x9E,
-0xB0, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA0, 0xB0, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xA0, 0xB0, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA0, 0xB0, 0xFF, 0xCC, 0x00, 0x00,
-0x00, 0xC0, 0xFF, 0xA0, 0xB0, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xA0, 0x00, 0x1E, 0xE4,
-0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC6, 0xF5, 0xF1, 0xBD, 0x41, 0x00, 0x00, 0x00,
-0x62, 0xFF, 0xFF, 0xFB, 0xFC, 0xFF, 0xFD, 0x4D, 0x00, 0x04, 0xEB, 0xFF, 0xB3, 0x0A, 0x0C, 0xBC,
-0xFF, 0xDD, 0x00, 0x31, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0x24, 0x42, 0xFF, 0xFF,
-0x2D, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0x3A, 0x2C, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x4D, 0xFF, 0xFF,
-0x27, 0x02, 0xE4, 0xFF, 0xB5, 0x0A, 0x0B, 0xB9, 0xFF, 0xE2, 0x01, 0x00, 0x55, 0xFE, 0xFF, 0xFB,
-0xFB, 0xFF, 0xFE, 0x56, 0x00, 0x00, 0x00, 0x46, 0xC1, 0xF3, 0xF5, 0xC3, 0x49, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC,
-0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC6, 0xF5, 0xF1, 0xBD, 0x41, 0x00,
-0x00, 0x00, 0x62, 0xFF, 0xFF, 0xFB, 0xFC, 0xFF, 0xFD, 0x4D, 0x00, 0x04, 0xEB, 0xFF, 0xB3, 0x0A,
-0x0C, 0xBC, 0xFF, 0xDD, 0x00, 0x31, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0x24, 0x42,
-0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0x3A, 0x2C, 0xFF, 0xFF, 0x45, 0x00, 0x00, 0x4D,
-0xFF, 0xFF, 0x27, 0x02, 0xE4, 0xFF, 0xB5, 0x0A, 0x0B, 0xB9, 0xFF, 0xE2, 0x01, 0x00, 0x55, 0xFE,
-0xFF, 0xFB, 0xFB, 0xFF, 0xFE, 0x56, 0x00, 0x00, 0x00, 0x46, 0xC1, 0xF3, 0xF5, 0xC3, 0x49, 0x00,
-0x00, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB,
-0xD5, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC6, 0xF5, 0xF1, 0xBD,
-0x41, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xFB, 0xFC, 0xFF, 0xFD, 0x4D, 0x00, 0x04, 0xEB, 0xFF,
-0xB3, 0x0A, 0x0C, 0xBC, 0xFF, 0xDD, 0x00, 0x31, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x4E, 0xFF, 0xFF,
-0x24, 0x42, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0x3A, 0x2C, 0xFF, 0xFF, 0x45, 0x00,
-0x00, 0x4D, 0xFF, 0xFF, 0x27, 0x02, 0xE4, 0xFF, 0xB5, 0x0A, 0x0B, 0xB9, 0xFF, 0xE2, 0x01, 0x00,
-0x55, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0xFE, 0x56, 0x00, 0x00, 0x00, 0x46, 0xC1, 0xF3, 0xF5, 0xC3,
-0x49, 0x00, 0x00, 0x00, 0x00, 0x58, 0xE9, 0xB6, 0x17, 0x08, 0xF6, 0x3D, 0x00, 0x00, 0x0C, 0xF1,
-0xBF, 0xEA, 0xE8, 0xBE, 0xF0, 0x0C, 0x00, 0x00, 0x3E, 0xF6, 0x08, 0x19, 0xBA, 0xE8, 0x56, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC6, 0xF5,
-0xF1, 0xBD, 0x41, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xFB, 0xFC, 0xFF, 0xFD, 0x4D, 0x00, 0x04,
-0xEB, 0xFF, 0xB3, 0x0A, 0x0C, 0xBC, 0xFF, 0xDD, 0x00, 0x31, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x4E,
-0xFF, 0xFF, 0x24, 0x42, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0x3A, 0x2C, 0xFF, 0xFF,
-0x45, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x27, 0x02, 0xE4, 0xFF, 0xB5, 0x0A, 0x0B, 0xB9, 0xFF, 0xE2,
-0x01, 0x00, 0x55, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0xFE, 0x56, 0x00, 0x00, 0x00, 0x46, 0xC1, 0xF3,
-0xF5, 0xC3, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE,
-0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
-0xC6, 0xF5, 0xF1, 0xBD, 0x41, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xFB, 0xFC, 0xFF, 0xFD, 0x4D,
-0x00, 0x04, 0xEB, 0xFF, 0xB3, 0x0A, 0x0C, 0xBC, 0xFF, 0xDD, 0x00, 0x31, 0xFF, 0xFF, 0x44, 0x00,
-0x00, 0x4E, 0xFF, 0xFF, 0x24, 0x42, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0x3A, 0x2C,
-0xFF, 0xFF, 0x45, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0x27, 0x02, 0xE4, 0xFF, 0xB5, 0x0A, 0x0B, 0xB9,
-0xFF, 0xE2, 0x01, 0x00, 0x55, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0xFE, 0x56, 0x00, 0x00, 0x00, 0x46,
-0xC1, 0xF3, 0xF5, 0xC3, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5C, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x89, 0x00,
-0x00, 0x00, 0x01, 0x08, 0x08, 0x0B, 0x45, 0x0F, 0x08, 0x08, 0x02, 0x28, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x48, 0x1B, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0x31, 0x00, 0x00, 0x00,
-0x22, 0x95, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x2E, 0xB1, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x00, 0x50, 0xC5, 0xF5, 0xF3, 0xBF, 0xED, 0x4D, 0x00, 0x00, 0x62, 0xFF, 0xFF,
-0xFB, 0xFC, 0xFF, 0xFF, 0x5C, 0x00, 0x04, 0xEB, 0xFF, 0xB3, 0x0A, 0x79, 0xFF, 0xFF, 0xDF, 0x01,
-0x31, 0xFF, 0xFF, 0x44, 0x2A, 0xF7, 0xDC, 0xFF, 0xFF, 0x26, 0x43, 0xFF, 0xFF, 0x33, 0xCD, 0xE6,
-0x48, 0xFF, 0xFF, 0x3B, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0x4C, 0x4E, 0xFF, 0xFF, 0x27, 0x03, 0xE6,
-0xFF, 0xFF, 0xA1, 0x0A, 0xBB, 0xFF, 0xE2, 0x01, 0x00, 0x5D, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFE,
-0x56, 0x00, 0x00, 0x60, 0xFD, 0xC7, 0xF5, 0xF5, 0xC4, 0x49, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE4, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x23, 0xDE, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0xF6, 0x25, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00,
-0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00,
-0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF,
-0xA8, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0x94, 0xBB, 0xFF, 0xB1, 0x00, 0x00, 0x04, 0xF0, 0xFF, 0x94,
-0xA1, 0xFF, 0xEC, 0x19, 0x02, 0x74, 0xFF, 0xFF, 0x94, 0x51, 0xFF, 0xFF, 0xFC, 0xF6, 0xFF, 0xE9,
-0xFF, 0x94, 0x00, 0x6D, 0xDA, 0xF8, 0xDD, 0x73, 0x5F, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC0, 0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x00, 0x00, 0x00,
-0x27, 0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF,
-0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00,
-0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0x94, 0xBB, 0xFF, 0xB1, 0x00,
-0x00, 0x04, 0xF0, 0xFF, 0x94, 0xA1, 0xFF, 0xEC, 0x19, 0x02, 0x74, 0xFF, 0xFF, 0x94, 0x51, 0xFF,
-0xFF, 0xFC, 0xF6, 0xFF, 0xE9, 0xFF, 0x94, 0x00, 0x6D, 0xDA, 0xF8, 0xDD, 0x73, 0x5F, 0xFF, 0x94,
-0x00, 0x00, 0x01, 0xC2, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xCB, 0xD5, 0xFF,
-0x74, 0x00, 0x00, 0x46, 0xFD, 0xB3, 0x0F, 0x14, 0xB9, 0xFD, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8,
-0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC,
-0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xD4, 0xFF,
-0x94, 0xBB, 0xFF, 0xB1, 0x00, 0x00, 0x04, 0xF0, 0xFF, 0x94, 0xA1, 0xFF, 0xEC, 0x19, 0x02, 0x74,
-0xFF, 0xFF, 0x94, 0x51, 0xFF, 0xFF, 0xFC, 0xF6, 0xFF, 0xE9, 0xFF, 0x94, 0x00, 0x6D, 0xDA, 0xF8,
-0xDD, 0x73, 0x5F, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00, 0x00, 0x00, 0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC,
-0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00,
-0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0x94, 0xBC, 0xFF, 0xA8,
-0x00, 0x00, 0x00, 0xD4, 0xFF, 0x94, 0xBB, 0xFF, 0xB1, 0x00, 0x00, 0x04, 0xF0, 0xFF, 0x94, 0xA1,
-0xFF, 0xEC, 0x19, 0x02, 0x74, 0xFF, 0xFF, 0x94, 0x51, 0xFF, 0xFF, 0xFC, 0xF6, 0xFF, 0xE9, 0xFF,
-0x94, 0x00, 0x6D, 0xDA, 0xF8, 0xDD, 0x73, 0x5F, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-0xFF, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x27,
-0xF7, 0xCA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
-0xBB, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xD1, 0x6D, 0xFF, 0xFB, 0x11, 0x00, 0x09, 0xF5, 0xFF, 0x76,
-0x12, 0xF8, 0xFF, 0x5D, 0x00, 0x4F, 0xFF, 0xFD, 0x1C, 0x00, 0xA9, 0xFF, 0xAE, 0x00, 0x9E, 0xFF,
-0xBE, 0x00, 0x00, 0x47, 0xFF, 0xF5, 0x0C, 0xEA, 0xFF, 0x62, 0x00, 0x00, 0x02, 0xE2, 0xFF, 0x7D,
-0xFF, 0xF7, 0x0E, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xE0, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x21,
-0xFE, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xED, 0x05, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xBF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0x30, 0x00, 0x00,
-0x00, 0x72, 0xF4, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x66, 0xF6, 0xE2, 0x82, 0x04, 0x00,
-0x00, 0x00, 0x00, 0xC4, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xA0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF,
-0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0x97, 0x8D, 0xED, 0xF2, 0x9E, 0x0A, 0x00,
-0xC4, 0xFF, 0xF0, 0xFE, 0xF5, 0xFF, 0xFF, 0x93, 0x00, 0xC4, 0xFF, 0xF4, 0x26, 0x02, 0x9D, 0xFF,
-0xF6, 0x0E, 0xC4, 0xFF, 0xB3, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0x32, 0xC4, 0xFF, 0xA3, 0x00, 0x00,
-0x21, 0xFF, 0xFF, 0x48, 0xC4, 0xFF, 0xBA, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0x32, 0xC4, 0xFF, 0xF8,
-0x33, 0x04, 0xA3, 0xFF, 0xF6, 0x0E, 0xC4, 0xFF, 0xFD, 0xFF, 0xFB, 0xFF, 0xFF, 0x95, 0x00, 0xC4,
-0xFF, 0xA0, 0xA2, 0xF1, 0xF2, 0x9F, 0x0B, 0x00, 0xC4, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC4, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xA0, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xC4, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFD, 0x47, 0x5C, 0xFC, 0x88, 0x00, 0x00, 0x00,
-0x87, 0xF2, 0x3D, 0x4F, 0xEE, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xCF, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xD1, 0x6D, 0xFF, 0xFB, 0x11, 0x00, 0x09, 0xF5,
-0xFF, 0x76, 0x12, 0xF8, 0xFF, 0x5D, 0x00, 0x4F, 0xFF, 0xFD, 0x1C, 0x00, 0xA9, 0xFF, 0xAE, 0x00,
-0x9E, 0xFF, 0xBE, 0x00, 0x00, 0x47, 0xFF, 0xF5, 0x0C, 0xEA, 0xFF, 0x62, 0x00, 0x00, 0x02, 0xE2,
-0xFF, 0x7D, 0xFF, 0xF7, 0x0E, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xE0, 0xFF, 0xAA, 0x00, 0x00, 0x00,
-0x00, 0x21, 0xFE, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xED, 0x05, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0x30,
-0x00, 0x00, 0x00, 0x72, 0xF4, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x66, 0xF6, 0xE2, 0x82,
-0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x4E, 0x6F, 0x74, 0x6F, 0x20, 0x53, 0x61, 0x6E, 0x73,
-0x20, 0x42, 0x6F, 0x6C, 0x64, 0x00, 0x0D, 0x4E, 0x6F, 0x74, 0x6F, 0x53, 0x61, 0x6E, 0x73, 0x2D,
-0x42, 0x6F, 0x6C, 0x64, 0x01
+0x00, 0x00, 0x66, 0xF6, 0xE2, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xE6, 0xE8, 0x7B,
+0x00, 0x40, 0xFF, 0x8D, 0x87, 0xFF, 0x48, 0x7F, 0xFF, 0x0F, 0x07, 0xFF, 0x8D, 0x7E, 0xFF, 0x10,
+0x08, 0xFF, 0x8D, 0x3A, 0xFF, 0x8E, 0x89, 0xFF, 0x4C, 0x00, 0x71, 0xE7, 0xE9, 0x81, 0x00, 0x00,
+0x0E, 0x4E, 0x6F, 0x74, 0x6F, 0x20, 0x53, 0x61, 0x6E, 0x73, 0x20, 0x42, 0x6F, 0x6C, 0x64, 0x00,
+0x0D, 0x4E, 0x6F, 0x74, 0x6F, 0x53, 0x61, 0x6E, 0x73, 0x2D, 0x42, 0x6F, 0x6C, 0x64, 0x01
 };
\ No newline at end of file
@@ -1,3 +1,4 @@
+// Generated by tools/font_subset.py from fonts/NotoSans_Regular24pt7b.h, do not edit.
 /* The font vlw file can be converted to a byte array using:
 
    https://tomeko.net/online_tools/file_to_hex.php?lang=en
@@ -18,7 +19,7 @@
 
 
 const uint8_t  NotoSansBold24[] PROGMEM = {
-0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xE8,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
@@ -30,90 +31,69 @@ const uint8_t  NotoSansBold24[] PROGMEM = {
 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xE8,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05,
 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x15,
-0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x18,
+0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x18,
 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07,
 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x13,
+0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x13,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x13,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0C,
 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x13,
-0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13,
-0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0C,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x11,
@@ -124,593 +104,454 @@ const uint8_t  NotoSansBold24[] PROGMEM = {
 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10,
 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57,
 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x11,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0F,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x18,
-0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06,
-0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5E, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFE,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67,
-0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x11,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0B,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x13,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
+0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12,
+0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x12,
+0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05,
 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07,
-0x00, 0x00, 0x00, 0x12, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x12,
-0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x16,
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x13,
+0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x0D,
 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D,
 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x10,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0D,
-0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A,
+0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x10,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x0D,
+0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E,
 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C,
-0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B,
-0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x18,
-0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x09,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0E,
-0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0E,
+0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x1C, 0x24, 0x24, 0x24, 0x09, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0xB2, 0xFF, 0xFF, 0xFF, 0x31,
 0xA4, 0xFF, 0xFF, 0xFF, 0x24, 0x97, 0xFF, 0xFF, 0xFF, 0x17, 0x89, 0xFF, 0xFF, 0xFF, 0x0A, 0x7B,
 0xFF, 0xFF, 0xFC, 0x00, 0x6E, 0xFF, 0xFF, 0xEF, 0x00, 0x60, 0xFF, 0xFF, 0xE2, 0x00, 0x53, 0xFF,
 0xFF, 0xD4, 0x00, 0x45, 0xFF, 0xFF, 0xC7, 0x00, 0x37, 0xFF, 0xFF, 0xBA, 0x00, 0x0E, 0x50, 0x50,
 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x88, 0xA0, 0x48, 0x00, 0xA5, 0xFF, 0xFF, 0xFA,
 0x1B, 0xC7, 0xFF, 0xFF, 0xFF, 0x39, 0x71, 0xFF, 0xFF, 0xD9, 0x09, 0x00, 0x2C, 0x44, 0x0A, 0x00,
-0x30, 0x84, 0x84, 0x72, 0x00, 0x37, 0x84, 0x84, 0x6A, 0x50, 0xFF, 0xFF, 0xCF, 0x00, 0x5C, 0xFF,
-0xFF, 0xBF, 0x3C, 0xFF, 0xFF, 0xBB, 0x00, 0x48, 0xFF, 0xFF, 0xAB, 0x28, 0xFF, 0xFF, 0xA7, 0x00,
-0x34, 0xFF, 0xFF, 0x97, 0x14, 0xFF, 0xFF, 0x93, 0x00, 0x20, 0xFF, 0xFF, 0x83, 0x02, 0xFD, 0xFF,
-0x7F, 0x00, 0x0C, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xAC, 0x4A, 0x00, 0x00, 0xA8, 0xAC, 0x3F, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0D, 0x2C, 0x2C, 0x0A, 0x00, 0x12, 0x2C, 0x2C, 0x04, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0x23, 0x00, 0x89, 0xFF, 0xF7, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xF1, 0x01, 0x00, 0xBB, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xC3, 0x00, 0x00, 0xEB, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00,
-0x1A, 0x70, 0x70, 0x70, 0xF8, 0xFF, 0xC8, 0x70, 0x7A, 0xFF, 0xFF, 0xB2, 0x70, 0x70, 0x07, 0x00,
-0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
-0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
-0x00, 0x04, 0x04, 0x8B, 0xFF, 0xFA, 0x0B, 0x04, 0xB3, 0xFF, 0xD7, 0x04, 0x04, 0x04, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xBD, 0xFF, 0xCC, 0x00, 0x00, 0xE6, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x05,
-0x44, 0x44, 0x44, 0xEF, 0xFF, 0xB8, 0x44, 0x53, 0xFF, 0xFF, 0x9B, 0x44, 0x44, 0x12, 0x00, 0x14,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x14,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x02,
-0x24, 0x24, 0x98, 0xFF, 0xFC, 0x2A, 0x24, 0xBF, 0xFF, 0xE0, 0x24, 0x24, 0x24, 0x09, 0x00, 0x00,
-0x00, 0x00, 0xB2, 0xFF, 0xD7, 0x00, 0x00, 0xE4, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xE0, 0xFF, 0xA7, 0x00, 0x15, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x0E, 0xFF, 0xFF, 0x77, 0x00, 0x47, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x9C, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD0, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xA2, 0xD9, 0xFD, 0xFF, 0xE9, 0xC9,
-0x9F, 0x50, 0x09, 0x08, 0xAC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x89,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0x24, 0xE1, 0xFF, 0xFF, 0xD2, 0x20,
-0xD0, 0xC8, 0x09, 0x32, 0x7A, 0x93, 0x00, 0xE1, 0xFF, 0xFF, 0xBB, 0x01, 0xD0, 0xC8, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xA8, 0xFF, 0xFF, 0xFF, 0xCD, 0xE9, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
-0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x8D, 0x27, 0x00, 0x00, 0x00, 0x00, 0x29, 0xC5, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0xAD, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x45, 0xAD, 0xFB, 0xFF, 0xFF, 0xFF,
-0xFF, 0xEB, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xB8, 0x02,
-0x00, 0x00, 0x00, 0x00, 0xD0, 0xC8, 0x07, 0xBF, 0xFF, 0xFF, 0xF1, 0xD2, 0x89, 0x3B, 0x06, 0x00,
-0xD0, 0xC8, 0x0E, 0xC7, 0xFF, 0xFF, 0xE3, 0xEC, 0xFF, 0xFF, 0xF8, 0xD4, 0xF4, 0xF7, 0xF7, 0xFF,
-0xFF, 0xFF, 0x89, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x08, 0x21,
-0x6E, 0xB4, 0xD4, 0xEE, 0xFF, 0xFC, 0xDA, 0xA4, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD0, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xC8, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x03, 0x21, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xF0, 0xFF, 0xFF, 0xEE, 0x77, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x2B, 0xEC, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x6D, 0x00, 0x00, 0x00, 0x01, 0xC5, 0xFF, 0xDE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE,
-0xFF, 0xFF, 0x77, 0x6F, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0x48, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xDE, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0F, 0x00, 0x18, 0xF0,
-0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0xD3, 0x00, 0x00, 0xC4, 0xFF,
-0xFF, 0x0F, 0x00, 0xAA, 0xFF, 0xEE, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xFF,
-0xF9, 0x22, 0x1B, 0xF3, 0xFF, 0xEC, 0x00, 0x4B, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0xFB, 0xFF, 0xFF, 0xA4, 0x0B, 0xE0, 0xFF, 0xC2, 0x01,
-0x15, 0x5C, 0x72, 0x5D, 0x15, 0x00, 0x00, 0x00, 0x0A, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x18,
-0x8D, 0xFF, 0xF9, 0x29, 0x51, 0xEE, 0xFF, 0xFF, 0xFF, 0xEF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x42,
-0x76, 0x77, 0x4A, 0x03, 0x31, 0xFC, 0xFF, 0x81, 0x14, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
-0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCB, 0xFF, 0xD9, 0x07, 0x53, 0xFF, 0xFF,
-0xA8, 0x0A, 0x94, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF,
-0x40, 0x00, 0x73, 0xFF, 0xFF, 0x59, 0x00, 0x3D, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x1D, 0xF3, 0xFF, 0x9E, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0x60, 0x00, 0x45, 0xFF, 0xFF, 0x89,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xEA, 0x13, 0x00, 0x00, 0x41, 0xFF, 0xFF, 0xC8,
-0x41, 0xB7, 0xFF, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0x5C, 0x00, 0x00,
-0x00, 0x01, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE5,
-0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xB9, 0xFF, 0xFF, 0xFF, 0xD4, 0x37, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x33,
-0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5E, 0xBF, 0xEE, 0xF9, 0xDD, 0xAC, 0x36, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD,
-0xFA, 0xFF, 0xFF, 0xF6, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xE5,
-0x0F, 0x00, 0x44, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF,
-0xFF, 0xCF, 0x00, 0x00, 0x37, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x42, 0xFF, 0xFF, 0xFF, 0x42, 0x2E, 0xDA, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xF1, 0xFC, 0xFF, 0xFF, 0xDC, 0x1A, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x18, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3B, 0x00, 0x00,
-0x00, 0x9B, 0xFF, 0xFF, 0xFF, 0x23, 0x00, 0x35, 0xF6, 0xFF, 0xFF, 0xEB, 0xC6, 0xFF, 0xFF, 0xF5,
-0x46, 0x00, 0x08, 0xEF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFB, 0x30, 0x0A, 0xBD,
-0xFF, 0xFF, 0xF9, 0x52, 0x70, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xC2, 0x00,
-0x00, 0x09, 0xBC, 0xFF, 0xFF, 0xFC, 0xF1, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF,
-0xDA, 0x01, 0x00, 0x00, 0x09, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x25, 0x00, 0x00, 0x00, 0xDF,
-0xFF, 0xFF, 0xFF, 0x9F, 0x23, 0x07, 0x22, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x02, 0x00, 0x00,
-0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x99,
-0x00, 0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xA1, 0xDB, 0xF6, 0xF7, 0xE1, 0xC8, 0x8C, 0x3B,
-0x3A, 0xE0, 0xFF, 0xFF, 0xFF, 0x85, 0x2F, 0x80, 0x80, 0x6F, 0x50, 0xFF, 0xFF, 0xCF, 0x3C, 0xFF,
-0xFF, 0xBB, 0x28, 0xFF, 0xFF, 0xA7, 0x14, 0xFF, 0xFF, 0x93, 0x02, 0xFD, 0xFF, 0x7F, 0x00, 0xA4,
-0xB0, 0x4B, 0x00, 0x00, 0x00, 0x2C, 0xF1, 0xF4, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x44,
-0x00, 0x00, 0x57, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x23,
-0xFF, 0xFF, 0xF1, 0x08, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xFF,
-0x63, 0x00, 0x00, 0x01, 0xF1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x26, 0xFF, 0xFF, 0xF7, 0x04, 0x00,
-0x00, 0x43, 0xFF, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x63,
-0xFF, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xFF,
-0xCB, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xF3, 0x02,
-0x00, 0x00, 0x04, 0xF6, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0x5E, 0x00, 0x00,
-0x00, 0x8A, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xED, 0x05, 0x00, 0x00, 0x00,
-0xCD, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x01, 0xC7,
-0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x30, 0xF5, 0xF8, 0xBB, 0x78, 0xF4, 0xF4, 0x75, 0x00, 0x00,
-0x00, 0x0D, 0xEA, 0xFF, 0xF9, 0x24, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00,
-0x10, 0xF8, 0xFF, 0xFA, 0x15, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x54,
-0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFC, 0x0B, 0x00, 0x00, 0x00, 0xE5, 0xFF,
-0xFF, 0x3C, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0x86,
-0x00, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xFF, 0xA8, 0x00, 0x00,
-0x00, 0x76, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x97,
-0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF,
-0x34, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xF9, 0x06, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0xC3, 0x00, 0x00,
-0x00, 0xB2, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x12, 0xFA, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x73, 0xFF,
-0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xEC, 0xFF, 0xF8, 0x20, 0x00, 0x00, 0x7D, 0xF8, 0xF8, 0x76, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE0, 0xE0, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xE4, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA4, 0x5D, 0x16, 0x00, 0xC7, 0xFF,
-0x8A, 0x00, 0x22, 0x6A, 0x95, 0x00, 0x27, 0xFF, 0xFF, 0xFE, 0xCB, 0xE1, 0xFF, 0xCE, 0xDB, 0xFF,
-0xFF, 0xF8, 0x02, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D,
-0x11, 0x39, 0x4D, 0x60, 0xCB, 0xFF, 0xFF, 0xFF, 0xA9, 0x5D, 0x4B, 0x39, 0x08, 0x00, 0x00, 0x00,
-0x3B, 0xFB, 0xFF, 0xF4, 0xFF, 0xE8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xE2, 0xFF, 0xEF,
-0x4D, 0xFF, 0xFF, 0xBD, 0x02, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x8A, 0x00, 0xC1, 0xFF,
-0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x35, 0xB5, 0xFB, 0x1D, 0x00, 0x42, 0xFE, 0xA6, 0x22, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x28, 0x5C, 0x5C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
-0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x24, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x05, 0x08,
-0x08, 0x08, 0x74, 0xFF, 0xFF, 0x2A, 0x08, 0x08, 0x08, 0x03, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x6C, 0x63, 0x88, 0x88, 0x88, 0xBC, 0xFF, 0xFF, 0x98, 0x88, 0x88, 0x88, 0x39, 0x00, 0x00,
-0x00, 0x00, 0x70, 0xFF, 0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
-0xFF, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x24, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCC, 0xCC, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-0x60, 0x60, 0x60, 0x1D, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0x36, 0x00, 0x61, 0xFF, 0xFF, 0xEB, 0x02,
-0x00, 0x90, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0x3F, 0x00, 0x03, 0xF4, 0xFF, 0xDC,
-0x01, 0x00, 0x26, 0xDC, 0xDC, 0x6A, 0x00, 0x00, 0x75, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x52, 0xC0,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x3F, 0x54, 0x54,
-0x54, 0x54, 0x54, 0x2C, 0x06, 0x78, 0xA2, 0x63, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0x46, 0x93, 0xFF,
-0xFF, 0xFF, 0x69, 0x43, 0xFB, 0xFF, 0xF1, 0x21, 0x00, 0x1F, 0x47, 0x14, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xB8, 0xFC, 0xFC, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF7,
-0xFF, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3,
-0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xF4, 0x06, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5,
-0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE9, 0xFF, 0xFF, 0x28, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x56, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0xFF, 0xFD, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A,
-0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x84, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-0xFF, 0xFF, 0xF2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0xB1, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-0xEC, 0xFF, 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xDF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC1, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xF8, 0xF5, 0x10, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x4A, 0x60, 0x4E, 0x14, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x03, 0x7F, 0xF6, 0xFF, 0xFF, 0xFF, 0xF9, 0x8E, 0x06, 0x00, 0x00, 0x00,
-0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0xFF,
-0xFF, 0xE5, 0x93, 0xD2, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFA, 0x24, 0x00,
-0x0B, 0xE1, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x84, 0xFF,
-0xFF, 0xFB, 0x0F, 0x0C, 0xFF, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x3C,
-0x2C, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0xFF, 0x61, 0x3A, 0xFF, 0xFF,
-0xFF, 0x5C, 0x00, 0x00, 0x00, 0x22, 0xFF, 0xFF, 0xFF, 0x70, 0x41, 0xFF, 0xFF, 0xFF, 0x59, 0x00,
-0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0x78, 0x38, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x23,
-0xFF, 0xFF, 0xFF, 0x70, 0x27, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF,
-0x61, 0x05, 0xFB, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xCC,
-0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFC, 0x11, 0x00, 0x7D, 0xFF, 0xFF, 0xFE,
-0x35, 0x00, 0x18, 0xEC, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x14, 0xF3, 0xFF, 0xFF, 0xF5, 0xBA, 0xEB,
-0xFF, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x57, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xD3, 0xFF, 0xFF, 0xFF, 0xE9, 0x7A, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x1C, 0x35, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x11, 0x24, 0x24, 0x14, 0x00, 0x00, 0x00, 0x00, 0x47, 0xEE, 0xFF, 0xFF, 0x94, 0x00, 0x00,
-0x00, 0x77, 0xFD, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x0B, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94,
-0x23, 0xD3, 0xFF, 0xFF, 0xF6, 0xFD, 0xFF, 0xFF, 0x94, 0xA8, 0xFF, 0xFF, 0xF2, 0x43, 0xFB, 0xFF,
-0xFF, 0x94, 0x10, 0xDA, 0xD9, 0x29, 0x04, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x23, 0x0F, 0x00, 0x0B,
-0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0x21, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7C, 0xF0, 0xFF, 0xFF, 0xEE, 0x77, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x2B, 0xEC, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x01, 0xC5, 0xFF, 0xDE, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCE, 0xFF, 0xFF, 0x77, 0x6F, 0xFE, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0x48, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xDE, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x0F, 0x00, 0x18,
+0xF0, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0xD3, 0x00, 0x00, 0xC4,
+0xFF, 0xFF, 0x0F, 0x00, 0xAA, 0xFF, 0xEE, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9,
+0xFF, 0xF9, 0x22, 0x1B, 0xF3, 0xFF, 0xEC, 0x00, 0x4B, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0xFB, 0xFF, 0xFF, 0xA4, 0x0B, 0xE0, 0xFF, 0xC2,
+0x01, 0x15, 0x5C, 0x72, 0x5D, 0x15, 0x00, 0x00, 0x00, 0x0A, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2,
+0x18, 0x8D, 0xFF, 0xF9, 0x29, 0x51, 0xEE, 0xFF, 0xFF, 0xFF, 0xEF, 0x56, 0x00, 0x00, 0x00, 0x00,
+0x42, 0x76, 0x77, 0x4A, 0x03, 0x31, 0xFC, 0xFF, 0x81, 0x14, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCB, 0xFF, 0xD9, 0x07, 0x53, 0xFF,
+0xFF, 0xA8, 0x0A, 0x94, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+0xFF, 0x40, 0x00, 0x73, 0xFF, 0xFF, 0x59, 0x00, 0x3D, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1D, 0xF3, 0xFF, 0x9E, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0x60, 0x00, 0x45, 0xFF, 0xFF,
+0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xEA, 0x13, 0x00, 0x00, 0x41, 0xFF, 0xFF,
+0xC8, 0x41, 0xB7, 0xFF, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0x5C, 0x00,
+0x00, 0x00, 0x01, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0E,
+0xE5, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xB9, 0xFF, 0xFF, 0xFF, 0xD4, 0x37, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
+0x33, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5E, 0xBF, 0xEE, 0xF9, 0xDD, 0xAC, 0x36,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xEF,
+0xCD, 0xFA, 0xFF, 0xFF, 0xF6, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF,
+0xE5, 0x0F, 0x00, 0x44, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82,
+0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x37, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x42, 0xFF, 0xFF, 0xFF, 0x42, 0x2E, 0xDA, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0xF1, 0xFC, 0xFF, 0xFF, 0xDC, 0x1A, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x18, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3B, 0x00,
+0x00, 0x00, 0x9B, 0xFF, 0xFF, 0xFF, 0x23, 0x00, 0x35, 0xF6, 0xFF, 0xFF, 0xEB, 0xC6, 0xFF, 0xFF,
+0xF5, 0x46, 0x00, 0x08, 0xEF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFB, 0x30, 0x0A,
+0xBD, 0xFF, 0xFF, 0xF9, 0x52, 0x70, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xC2,
+0x00, 0x00, 0x09, 0xBC, 0xFF, 0xFF, 0xFC, 0xF1, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+0xFF, 0xDA, 0x01, 0x00, 0x00, 0x09, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x25, 0x00, 0x00, 0x00,
+0xDF, 0xFF, 0xFF, 0xFF, 0x9F, 0x23, 0x07, 0x22, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x02, 0x00,
+0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x99, 0x00, 0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xA1, 0xDB, 0xF6, 0xF7, 0xE1, 0xC8, 0x8C,
+0x3B, 0x3A, 0xE0, 0xFF, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x2C, 0xF1, 0xF4, 0xC0, 0x00, 0x00,
+0x00, 0xC0, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0xC4, 0xFF,
+0xFF, 0x54, 0x00, 0x00, 0x23, 0xFF, 0xFF, 0xF1, 0x08, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x63, 0x00, 0x00, 0x01, 0xF1, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x26,
+0xFF, 0xFF, 0xF7, 0x04, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF,
+0xCE, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xBA, 0x00,
+0x00, 0x00, 0x56, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0x00,
+0x2E, 0xFF, 0xFF, 0xF3, 0x02, 0x00, 0x00, 0x04, 0xF6, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x00, 0xC6,
+0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+0xED, 0x05, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xB3,
+0x00, 0x00, 0x00, 0x01, 0xC7, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x30, 0xF5, 0xF8, 0xBB, 0x78,
+0xF4, 0xF4, 0x75, 0x00, 0x00, 0x00, 0x0D, 0xEA, 0xFF, 0xF9, 0x24, 0x00, 0x00, 0x00, 0x70, 0xFF,
+0xFF, 0xA7, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFA, 0x15, 0x00, 0x00, 0x00, 0xAE, 0xFF, 0xFF,
+0x71, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFC, 0x0B,
+0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0x6E, 0x00, 0x00,
+0x00, 0x97, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x73,
+0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x76, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x87, 0xFF, 0xFF,
+0x94, 0x00, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0x67, 0x00,
+0x00, 0x00, 0xE8, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xF9, 0x06, 0x00, 0x00, 0x59,
+0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x12, 0xFA, 0xFF, 0xF8,
+0x10, 0x00, 0x00, 0x73, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xEC, 0xFF, 0xF8, 0x20, 0x00, 0x00,
+0x7D, 0xF8, 0xF8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x60, 0x60, 0x60, 0x1D, 0x00, 0x38, 0xFF,
+0xFF, 0xFF, 0x36, 0x00, 0x61, 0xFF, 0xFF, 0xEB, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0x9B, 0x00, 0x00,
+0xC4, 0xFF, 0xFF, 0x3F, 0x00, 0x03, 0xF4, 0xFF, 0xDC, 0x01, 0x00, 0x26, 0xDC, 0xDC, 0x6A, 0x00,
+0x00, 0x75, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x52, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xC0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x3F, 0x54, 0x54, 0x54, 0x54, 0x54, 0x2C, 0x06, 0x78, 0xA2,
+0x63, 0x00, 0x72, 0xFF, 0xFF, 0xFF, 0x46, 0x93, 0xFF, 0xFF, 0xFF, 0x69, 0x43, 0xFB, 0xFF, 0xF1,
+0x21, 0x00, 0x1F, 0x47, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFC, 0xFC,
+0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF7, 0xFF, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x47, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF,
+0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x19, 0xFF, 0xFF, 0xF4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xE9, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xFF,
+0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xBE, 0xFF, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0xFF,
+0xFD, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xFF,
+0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xF2, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF,
+0xFF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEC, 0xFF, 0xFF, 0x25, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF,
+0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xF2, 0xF8, 0xF5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0E, 0x4A, 0x60, 0x4E, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7F, 0xF6,
+0xFF, 0xFF, 0xFF, 0xF9, 0x8E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0xFF, 0xFF, 0xE5, 0x93, 0xD2, 0xFF, 0xFF, 0xFF,
+0x4D, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFA, 0x24, 0x00, 0x0B, 0xE1, 0xFF, 0xFF, 0xBE, 0x00, 0x00,
+0xDF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFB, 0x0F, 0x0C, 0xFF, 0xFF, 0xFF,
+0x82, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x3C, 0x2C, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00,
+0x00, 0x31, 0xFF, 0xFF, 0xFF, 0x61, 0x3A, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x22, 0xFF,
+0xFF, 0xFF, 0x70, 0x41, 0xFF, 0xFF, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0x78,
+0x38, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x23, 0xFF, 0xFF, 0xFF, 0x70, 0x27, 0xFF, 0xFF,
+0xFF, 0x6D, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x61, 0x05, 0xFB, 0xFF, 0xFF, 0x8B, 0x00,
+0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xCC, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x8D,
+0xFF, 0xFF, 0xFC, 0x11, 0x00, 0x7D, 0xFF, 0xFF, 0xFE, 0x35, 0x00, 0x18, 0xEC, 0xFF, 0xFF, 0xC4,
+0x00, 0x00, 0x14, 0xF3, 0xFF, 0xFF, 0xF5, 0xBA, 0xEB, 0xFF, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00,
+0x57, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xD3,
+0xFF, 0xFF, 0xFF, 0xE9, 0x7A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x35, 0x25,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x24, 0x14, 0x00, 0x00,
+0x00, 0x00, 0x47, 0xEE, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x77, 0xFD, 0xFF, 0xFF, 0xFF, 0x94,
+0x00, 0x0B, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x23, 0xD3, 0xFF, 0xFF, 0xF6, 0xFD, 0xFF,
+0xFF, 0x94, 0xA8, 0xFF, 0xFF, 0xF2, 0x43, 0xFB, 0xFF, 0xFF, 0x94, 0x10, 0xDA, 0xD9, 0x29, 0x04,
+0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x23, 0x0F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00,
 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00,
 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF,
 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00,
 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00,
-0x00, 0x00, 0x13, 0x3F, 0x58, 0x4F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xB1, 0xFB,
-0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x27, 0x00, 0x00, 0x00, 0x6A, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xEA, 0x1D, 0x00, 0x01, 0xB3, 0xFF, 0xFF, 0xFF, 0xCE, 0xAD, 0xE3, 0xFF, 0xFF, 0xFF,
-0x9A, 0x00, 0x00, 0x0D, 0xD2, 0xD9, 0x3B, 0x00, 0x00, 0x0B, 0xDF, 0xFF, 0xFF, 0xE2, 0x00, 0x00,
-0x00, 0x1C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x2C, 0xFD, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFF,
-0xF6, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0x69, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x5A, 0xFE, 0xFF, 0xFF, 0xB0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFB, 0xFF,
-0xFF, 0xB6, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF6, 0xFF, 0xFF, 0xB8, 0x07, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xFF, 0xFF, 0xC4, 0x13, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
-0x05, 0x04, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x08, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x08, 0x3A, 0x52, 0x5A, 0x45,
-0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xAB, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB2, 0x22,
-0x00, 0x00, 0x18, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x1E, 0x00, 0x00,
-0x69, 0xFF, 0xFD, 0xC1, 0x96, 0xA0, 0xEC, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x78, 0x26,
-0x00, 0x00, 0x00, 0x1C, 0xF4, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xD0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF5, 0xFF,
-0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x11, 0x1F, 0x53, 0xD0, 0xFF, 0xFF, 0xAC, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x6A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x9B, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x7D, 0x88,
-0xAD, 0xF1, 0xFF, 0xFF, 0xF9, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xCC,
-0xFF, 0xFF, 0xF2, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF,
-0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0x3F, 0x3B, 0x69,
-0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE5, 0xFF, 0xFF, 0xFD, 0x14, 0x54, 0xFF, 0xFC, 0xD1, 0xAE,
-0xA8, 0xC3, 0xFB, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xCB, 0x11, 0x00, 0x1E, 0x92, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD4, 0x71, 0x05,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x26, 0x37, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x24, 0x24, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x22, 0xF5, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xF3, 0xD2, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x63, 0xFF, 0xFF, 0x88, 0xCD, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0xFF, 0xE5,
-0x0F, 0xDA, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x4D, 0x00, 0xDF, 0xFF,
-0xFF, 0xA8, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00,
-0x00, 0x17, 0xED, 0xFF, 0xE8, 0x13, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0xAC, 0xFF,
-0xFF, 0xA4, 0x5C, 0x5C, 0x5C, 0xEB, 0xFF, 0xFF, 0xC7, 0x5C, 0x42, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x6E, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0xEE, 0xFF, 0xFF, 0xCF,
-0x74, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
-0x24, 0x24, 0x24, 0x01, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
-0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x33, 0xFF, 0xFF,
-0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x0B, 0x00, 0x46, 0xFF, 0xFF, 0xFF, 0x17, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0xFE, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x6D, 0xFF, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF,
-0xF6, 0xD0, 0xEE, 0xE9, 0xC1, 0x66, 0x03, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xBD, 0x08, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88,
-0x00, 0x00, 0x33, 0x33, 0x0A, 0x05, 0x23, 0x8C, 0xFF, 0xFF, 0xFF, 0xEE, 0x03, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x7B, 0xFF, 0xFF, 0xFF, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0xFF, 0xFF,
-0x19, 0x94, 0x35, 0x01, 0x00, 0x00, 0x00, 0x46, 0xF8, 0xFF, 0xFF, 0xD8, 0x00, 0xFC, 0xFF, 0xF0,
-0xC6, 0xBB, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x96, 0x00, 0x00, 0x84, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC4, 0x51, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x14, 0x31, 0x39, 0x2C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x07, 0x34, 0x4A, 0x50, 0x43, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAB,
-0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x4B, 0xFE, 0xFF, 0xFF, 0xF4, 0xB4, 0x8F, 0x84, 0x98, 0x38,
-0x00, 0x00, 0x01, 0xD8, 0xFF, 0xFF, 0xAA, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
-0xFF, 0xFF, 0xCC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0x5F,
-0x00, 0x02, 0x1A, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x31, 0x87, 0xF1, 0xFF,
-0xFF, 0xD3, 0x52, 0x00, 0x00, 0x01, 0xFC, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x5F, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBB, 0xC5, 0xFF, 0xFF, 0xFF, 0xED, 0x09, 0x18,
-0xFF, 0xFF, 0xFF, 0xF4, 0x30, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xFF, 0x49, 0x10, 0xFF, 0xFF, 0xFF,
-0x98, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x71, 0x01, 0xF9, 0xFF, 0xFF, 0x8A, 0x00, 0x00,
-0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x7A, 0x00, 0xC9, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x28, 0xFF,
-0xFF, 0xFF, 0x65, 0x00, 0x79, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x2D,
-0x00, 0x12, 0xEA, 0xFF, 0xFF, 0xFB, 0xB8, 0xD1, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x46,
-0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x27, 0x00, 0x00, 0x00, 0x00, 0x30, 0xBA, 0xFD,
-0xFF, 0xFF, 0xFA, 0xAE, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x32, 0x30, 0x0D,
-0x00, 0x00, 0x00, 0x00, 0x0A, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-0x0C, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x5C, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x56, 0xF0, 0xF0, 0xF0, 0xF0,
-0xF0, 0xF0, 0xF0, 0xF7, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xBA, 0xFF, 0xFF, 0xE0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF,
-0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xF7, 0x14, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF5, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x76, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1,
-0xFF, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0x5E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xEB, 0x07, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xA1, 0xFF, 0xFF, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xF8, 0xFF,
-0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x44, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE7, 0xFF, 0xFF, 0xD8, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x0F, 0x42, 0x57, 0x4B, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xA0, 0xF9,
-0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x2E, 0x00, 0x00, 0x00, 0x08, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF2, 0x26, 0x00, 0x00, 0x66, 0xFF, 0xFF, 0xFF, 0xAA, 0x57, 0x8A, 0xFE, 0xFF, 0xFF,
-0xA2, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0xE4, 0x02, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
-0x83, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x3B, 0xFF, 0xFF,
-0xFF, 0x5E, 0x00, 0x30, 0xF6, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFE, 0xB7,
-0xF5, 0xFF, 0xFF, 0xBF, 0x06, 0x00, 0x00, 0x00, 0x05, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x8A,
-0x08, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x93, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0x9C, 0x0F, 0x00, 0x00,
-0x00, 0x12, 0xCE, 0xFF, 0xFF, 0xF9, 0xB1, 0xFC, 0xFF, 0xFF, 0xD5, 0x1C, 0x00, 0x00, 0x98, 0xFF,
-0xFF, 0xEC, 0x31, 0x00, 0x3A, 0xEB, 0xFF, 0xFF, 0xBC, 0x00, 0x02, 0xF7, 0xFF, 0xFF, 0x6C, 0x00,
-0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0x39, 0x1E, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x06,
-0xFE, 0xFF, 0xFF, 0x5D, 0x11, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0xFF,
-0x45, 0x00, 0xC7, 0xFF, 0xFF, 0xFE, 0xA5, 0x75, 0x91, 0xF3, 0xFF, 0xFF, 0xE7, 0x07, 0x00, 0x32,
-0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x45, 0x00, 0x00, 0x00, 0x25, 0xA9, 0xF7,
-0xFF, 0xFF, 0xFF, 0xF9, 0xAF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x29, 0x38, 0x2C,
-0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x41, 0x4D, 0x33, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x15, 0xA6, 0xFC, 0xFF, 0xFF, 0xFF, 0xE9, 0x6C, 0x00, 0x00, 0x00, 0x00,
-0x10, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xFF,
-0xFF, 0xD2, 0x9E, 0xE4, 0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x04, 0xF3, 0xFF, 0xFF, 0xC3, 0x04, 0x00,
-0x1A, 0xE5, 0xFF, 0xFF, 0xBD, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x7D, 0xFF,
-0xFF, 0xFC, 0x0D, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0x3C,
-0x34, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x50, 0x0C, 0xFC, 0xFF,
-0xFF, 0xC7, 0x0A, 0x00, 0x1D, 0xDB, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xE9,
-0xC9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x23, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
-0xD3, 0xFF, 0xFF, 0x37, 0x00, 0x00, 0x21, 0xA6, 0xF0, 0xFF, 0xEB, 0x94, 0x0E, 0xF1, 0xFF, 0xFD,
-0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x0F, 0x91, 0xFF, 0xFF, 0xF8, 0x16, 0x00, 0x00, 0x0A, 0xBB, 0x9E, 0xA2, 0xBE, 0xF6, 0xFF,
-0xFF, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x00,
-0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xAD, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x27, 0x39, 0x36, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x49, 0x3D,
-0x01, 0x02, 0xD2, 0xFF, 0xFF, 0x96, 0x20, 0xFF, 0xFF, 0xFF, 0xE2, 0x09, 0xF0, 0xFF, 0xFF, 0xB9,
-0x00, 0x33, 0x95, 0x89, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
-0x9D, 0x90, 0x1D, 0x0A, 0xF3, 0xFF, 0xFF, 0xBE, 0x1F, 0xFF, 0xFF, 0xFF, 0xE1, 0x02, 0xC8, 0xFF,
-0xFF, 0x8A, 0x00, 0x06, 0x41, 0x35, 0x00, 0x00, 0x09, 0x49, 0x3D, 0x01, 0x02, 0xD2, 0xFF, 0xFF,
-0x96, 0x20, 0xFF, 0xFF, 0xFF, 0xE2, 0x09, 0xF0, 0xFF, 0xFF, 0xB9, 0x00, 0x33, 0x95, 0x89, 0x18,
+0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3F, 0x58, 0x4F, 0x1F,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xB1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x27, 0x00,
+0x00, 0x00, 0x6A, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x1D, 0x00, 0x01, 0xB3,
+0xFF, 0xFF, 0xFF, 0xCE, 0xAD, 0xE3, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x0D, 0xD2, 0xD9, 0x3B,
+0x00, 0x00, 0x0B, 0xDF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0x00, 0x00, 0x00, 0x00,
+0xAB, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF,
+0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFD, 0xFF, 0xFF, 0x8E, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFF, 0xF6, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF,
+0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFE, 0xFF, 0xFF, 0xB0, 0x04,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFB, 0xFF, 0xFF, 0xB6, 0x06, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x3C, 0xF6, 0xFF, 0xFF, 0xB8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
+0xFF, 0xFF, 0xC4, 0x13, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x05, 0x04, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x74, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x74, 0x00, 0x00, 0x00, 0x08, 0x3A, 0x52, 0x5A, 0x45, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+0xAB, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB2, 0x22, 0x00, 0x00, 0x18, 0xF5, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x1E, 0x00, 0x00, 0x69, 0xFF, 0xFD, 0xC1, 0x96, 0xA0, 0xEC,
+0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x78, 0x26, 0x00, 0x00, 0x00, 0x1C, 0xF4, 0xFF, 0xFF,
+0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF5, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x0B,
+0x11, 0x1F, 0x53, 0xD0, 0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xD2, 0x6A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x9B,
+0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x7D, 0x88, 0xAD, 0xF1, 0xFF, 0xFF, 0xF9, 0x5D, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xCC, 0xFF, 0xFF, 0xF2, 0x0D, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0x3F, 0x3B, 0x69, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE5,
+0xFF, 0xFF, 0xFD, 0x14, 0x54, 0xFF, 0xFC, 0xD1, 0xAE, 0xA8, 0xC3, 0xFB, 0xFF, 0xFF, 0xFF, 0xA7,
+0x00, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x11, 0x00, 0x1E, 0x92,
+0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD4, 0x71, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x26,
+0x37, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+0x24, 0x24, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xF5, 0xFF, 0xFF, 0xA8,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1E, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xF3,
+0xD2, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0x88, 0xCD, 0xFF, 0xFF,
+0xA8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0xFF, 0xE5, 0x0F, 0xDA, 0xFF, 0xFF, 0xA8, 0x00, 0x00,
+0x00, 0x00, 0xB3, 0xFF, 0xFF, 0x4D, 0x00, 0xDF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x5C, 0xFF,
+0xFF, 0xA4, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x17, 0xED, 0xFF, 0xE8, 0x13, 0x00,
+0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xA4, 0x5C, 0x5C, 0x5C, 0xEB, 0xFF,
+0xFF, 0xC7, 0x5C, 0x42, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xB8, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x6E, 0x74,
+0x74, 0x74, 0x74, 0x74, 0x74, 0xEE, 0xFF, 0xFF, 0xCF, 0x74, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xA8,
+0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x01, 0x00, 0x0C, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x33, 0xFF, 0xFF, 0xFF, 0xF2, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+0x0B, 0x00, 0x46, 0xFF, 0xFF, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF,
+0xFF, 0xFE, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xEC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xF6, 0xD0, 0xEE, 0xE9, 0xC1, 0x66, 0x03,
+0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x08, 0x00, 0x7E, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x33, 0x33, 0x0A, 0x05, 0x23,
+0x8C, 0xFF, 0xFF, 0xFF, 0xEE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF,
+0xFF, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0x31, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0xFF, 0xFF, 0x19, 0x94, 0x35, 0x01, 0x00, 0x00, 0x00,
+0x46, 0xF8, 0xFF, 0xFF, 0xD8, 0x00, 0xFC, 0xFF, 0xF0, 0xC6, 0xBB, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF,
+0x62, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x84, 0xDE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC4, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x31, 0x39, 0x2C,
+0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x34, 0x4A, 0x50,
+0x43, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAB, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x68, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x4B,
+0xFE, 0xFF, 0xFF, 0xF4, 0xB4, 0x8F, 0x84, 0x98, 0x38, 0x00, 0x00, 0x01, 0xD8, 0xFF, 0xFF, 0xAA,
+0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xCC, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0xFF, 0x5F, 0x00, 0x02, 0x1A, 0x11, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x31, 0x87, 0xF1, 0xFF, 0xFF, 0xD3, 0x52, 0x00, 0x00, 0x01, 0xFC,
+0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF8, 0xBB, 0xC5, 0xFF, 0xFF, 0xFF, 0xED, 0x09, 0x18, 0xFF, 0xFF, 0xFF, 0xF4, 0x30, 0x00, 0x00,
+0x83, 0xFF, 0xFF, 0xFF, 0x49, 0x10, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
+0xFF, 0x71, 0x01, 0xF9, 0xFF, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x7A, 0x00,
+0xC9, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0x65, 0x00, 0x79, 0xFF, 0xFF,
+0xFF, 0x4F, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x12, 0xEA, 0xFF, 0xFF, 0xFB, 0xB8,
+0xD1, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x46, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEC, 0x27, 0x00, 0x00, 0x00, 0x00, 0x30, 0xBA, 0xFD, 0xFF, 0xFF, 0xFA, 0xAE, 0x22, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x32, 0x30, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x1C, 0x1C,
+0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0C, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x74, 0x56, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF7, 0xFF, 0xFF, 0xFF,
+0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFF, 0xFF, 0xE0, 0x02, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x98, 0xFF, 0xFF, 0xF7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF5,
+0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0xFF, 0xFF, 0x35,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xFF, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xC3, 0xFF, 0xFF, 0xEB, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xFF,
+0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFC, 0x1E, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xF8, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+0xE7, 0xFF, 0xFF, 0xD8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF,
+0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x42, 0x57, 0x4B, 0x1D,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xA0, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x2E, 0x00,
+0x00, 0x00, 0x08, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x26, 0x00, 0x00, 0x66,
+0xFF, 0xFF, 0xFF, 0xAA, 0x57, 0x8A, 0xFE, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x97, 0xFF, 0xFF, 0xE4,
+0x02, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00,
+0xA3, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x30, 0xF6, 0xFF, 0xFF,
+0x71, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFE, 0xB7, 0xF5, 0xFF, 0xFF, 0xBF, 0x06, 0x00, 0x00,
+0x00, 0x05, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x8A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x93,
+0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0x9C, 0x0F, 0x00, 0x00, 0x00, 0x12, 0xCE, 0xFF, 0xFF, 0xF9, 0xB1,
+0xFC, 0xFF, 0xFF, 0xD5, 0x1C, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xEC, 0x31, 0x00, 0x3A, 0xEB, 0xFF,
+0xFF, 0xBC, 0x00, 0x02, 0xF7, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0x39,
+0x1E, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xFF, 0xFF, 0x5D, 0x11, 0xFF, 0xFF,
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0xFF, 0x45, 0x00, 0xC7, 0xFF, 0xFF, 0xFE, 0xA5,
+0x75, 0x91, 0xF3, 0xFF, 0xFF, 0xE7, 0x07, 0x00, 0x32, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF8, 0x45, 0x00, 0x00, 0x00, 0x25, 0xA9, 0xF7, 0xFF, 0xFF, 0xFF, 0xF9, 0xAF, 0x2C, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x29, 0x38, 0x2C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x41, 0x4D, 0x33, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xA6, 0xFC,
+0xFF, 0xFF, 0xFF, 0xE9, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xFF, 0xD2, 0x9E, 0xE4, 0xFF, 0xFF, 0xFF,
+0x46, 0x00, 0x04, 0xF3, 0xFF, 0xFF, 0xC3, 0x04, 0x00, 0x1A, 0xE5, 0xFF, 0xFF, 0xBD, 0x00, 0x2D,
+0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFC, 0x0D, 0x3F, 0xFF, 0xFF, 0xFF,
+0x47, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0x3C, 0x34, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x50, 0x0C, 0xFC, 0xFF, 0xFF, 0xC7, 0x0A, 0x00, 0x1D, 0xDB, 0xFF,
+0xFF, 0xFF, 0x56, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xE9, 0xC9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x48,
+0x00, 0x23, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xD3, 0xFF, 0xFF, 0x37, 0x00, 0x00, 0x21,
+0xA6, 0xF0, 0xFF, 0xEB, 0x94, 0x0E, 0xF1, 0xFF, 0xFD, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+0x00, 0x00, 0x28, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+0xFF, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x91, 0xFF, 0xFF, 0xF8, 0x16,
+0x00, 0x00, 0x0A, 0xBB, 0x9E, 0xA2, 0xBE, 0xF6, 0xFF, 0xFF, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x0C,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x87, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF,
+0xFF, 0xF4, 0xAD, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x39, 0x36, 0x25, 0x03, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x49, 0x3D, 0x01, 0x02, 0xD2, 0xFF, 0xFF, 0x96, 0x20,
+0xFF, 0xFF, 0xFF, 0xE2, 0x09, 0xF0, 0xFF, 0xFF, 0xB9, 0x00, 0x33, 0x95, 0x89, 0x18, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x60, 0x60, 0x49, 0x00, 0xC2,
-0xFF, 0xFF, 0xAC, 0x00, 0xEB, 0xFF, 0xFF, 0x62, 0x19, 0xFF, 0xFF, 0xFB, 0x13, 0x4C, 0xFF, 0xFF,
-0xB3, 0x00, 0x80, 0xFF, 0xFF, 0x51, 0x00, 0x9B, 0xDC, 0xCC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x4B, 0xCF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC5, 0xFF, 0xFF, 0x6C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xBB, 0xFF, 0xFF, 0xFF, 0xEC, 0x43, 0x00, 0x00, 0x00, 0x2D,
-0xB0, 0xFF, 0xFF, 0xFF, 0xEA, 0x77, 0x0C, 0x00, 0x00, 0x24, 0xA5, 0xFD, 0xFF, 0xFF, 0xE8, 0x74,
-0x0A, 0x00, 0x00, 0x00, 0x7E, 0xFB, 0xFF, 0xFF, 0xE6, 0x71, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xBC, 0xFF, 0xFF, 0xFE, 0x88, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xC2, 0xFF, 0xFF,
-0xFF, 0xF8, 0xA0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xAE, 0xFD, 0xFF, 0xFF, 0xFF,
-0xC1, 0x52, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x9A, 0xF8, 0xFF, 0xFF, 0xFF, 0xDF, 0x3E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x86, 0xEF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x0C, 0x72, 0xE2, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x05, 0x19, 0x37, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x20,
-0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xBC, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x2F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
-0x40, 0x40, 0x40, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x8F, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x52, 0xBC, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x95, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
-0xCC, 0xCC, 0xCC, 0x56, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xBA, 0xA7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xFB, 0x9C,
-0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFC, 0xFF, 0xFF, 0xF8, 0x91, 0x17, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x9F, 0xFB, 0xFF, 0xFF, 0xF4, 0x86, 0x11, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x21, 0x9C, 0xFA, 0xFF, 0xFF, 0xF0, 0x7C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x1F, 0x98, 0xF9, 0xFF, 0xFF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xBB,
-0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x03, 0x54, 0xC3, 0xFF, 0xFF, 0xFF, 0xF9, 0x9D, 0x1E,
-0x00, 0x10, 0x74, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0x89, 0x19, 0x00, 0x00, 0x78, 0xF4, 0xFF, 0xFF,
-0xFF, 0xE4, 0x75, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xFF, 0xD5, 0x61, 0x06, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xBB, 0xC3, 0x4D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-0x48, 0x5A, 0x4A, 0x17, 0x00, 0x00, 0x00, 0x08, 0x6A, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xAD,
-0x16, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x05, 0x02, 0xD9, 0xFF,
-0xE3, 0x9C, 0x89, 0xCD, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x4B, 0x53, 0x03, 0x00, 0x00, 0x09, 0xEC,
-0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x7A, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xF8,
-0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0xFF, 0xFF, 0xBD, 0x0D, 0x00, 0x00,
-0x00, 0x00, 0x37, 0xFD, 0xFF, 0xFF, 0x9D, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF,
-0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x38, 0x50, 0x50, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x9A, 0x95, 0x26, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0xE8, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
-0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0xFF, 0x9E, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3E, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x3D, 0x91, 0xC9, 0xED, 0xFB, 0xF5, 0xDA, 0xA8, 0x59, 0x07, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xDF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0xFF, 0xFF, 0xD1, 0x7A, 0x57, 0x3C,
-0x48, 0x68, 0xB8, 0xFC, 0xFF, 0xFE, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xE0, 0x3E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xDA, 0xFF, 0xFC, 0x48, 0x00, 0x00, 0x2E, 0xFA,
-0xFF, 0xCE, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xFF, 0xE0,
-0x05, 0x00, 0xB9, 0xFF, 0xF4, 0x26, 0x00, 0x02, 0x5F, 0xBD, 0xED, 0xFC, 0xF4, 0xDC, 0xB8, 0x68,
-0x00, 0x70, 0xFF, 0xFF, 0x4D, 0x25, 0xFF, 0xFF, 0x91, 0x00, 0x0B, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xB6, 0x00, 0x12, 0xFF, 0xFF, 0x8D, 0x72, 0xFF, 0xFF, 0x33, 0x00, 0x9F, 0xFF,
-0xFF, 0xC5, 0x51, 0x2C, 0x2E, 0xFC, 0xFF, 0xA8, 0x00, 0x00, 0xEC, 0xFF, 0xAD, 0xA4, 0xFF, 0xFA,
-0x01, 0x12, 0xFC, 0xFF, 0xD4, 0x07, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0xE0, 0xFF,
-0xB0, 0xBE, 0xFF, 0xE1, 0x00, 0x3A, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0x8D,
-0x00, 0x02, 0xF5, 0xFF, 0x98, 0xC1, 0xFF, 0xD6, 0x00, 0x35, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00,
-0x67, 0xFF, 0xFF, 0x84, 0x00, 0x38, 0xFF, 0xFF, 0x5C, 0xAE, 0xFF, 0xEB, 0x00, 0x07, 0xEF, 0xFF,
-0xF2, 0x5C, 0x2D, 0x5A, 0xEB, 0xFF, 0xFF, 0xC8, 0x31, 0xC2, 0xFF, 0xEB, 0x0E, 0x87, 0xFF, 0xFF,
-0x22, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0x57,
-0x00, 0x41, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x46, 0xBB, 0xF1, 0xF8, 0xCE, 0x5D, 0x00, 0x61, 0xDE,
-0xF5, 0xC7, 0x47, 0x00, 0x00, 0x02, 0xD2, 0xFF, 0xF3, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFB, 0xFF, 0xE7, 0x43, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
-0xFC, 0xFF, 0xFF, 0xC6, 0x7B, 0x50, 0x40, 0x46, 0x5D, 0x84, 0xC5, 0xFC, 0x78, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x3C, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4A, 0x96, 0xCE, 0xE9, 0xFA, 0xF8,
-0xE8, 0xC5, 0x90, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF1,
-0xFF, 0xFF, 0xFF, 0xEC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xB6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x17, 0xFB, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF9, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x71, 0xFF, 0xFF, 0xEF, 0x09, 0xEE, 0xFF, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xCE, 0xFF, 0xFF, 0xA5, 0x00, 0xA1, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x26, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xF8, 0x0D, 0x00, 0x09, 0xF4, 0xFF, 0xFF, 0x84, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x02, 0xE3, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xE0, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0xFF,
-0x3F, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x9D, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF1, 0x09, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x00, 0x00, 0xB9, 0xFF, 0xFF, 0xFF, 0x2E, 0x0C, 0x0C, 0x0C, 0x0C,
-0x0C, 0x2E, 0xFF, 0xFF, 0xFF, 0xB7, 0x00, 0x19, 0xFC, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFC, 0x18, 0x74, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x73, 0xD1, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xD1, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-0xF5, 0xE1, 0xBA, 0x76, 0x13, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xEF, 0x3C, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-0x03, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x0E, 0x4B, 0xE9, 0xFF, 0xFF, 0xFF, 0x37, 0xDC, 0xFF,
-0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0xFF, 0x4C, 0xDC, 0xFF, 0xFF, 0xC8, 0x00,
-0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0x31, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x0F, 0x4A,
-0xEB, 0xFF, 0xFF, 0xDA, 0x02, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9,
-0x35, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x60, 0x06, 0x00, 0xDC,
-0xFF, 0xFF, 0xF9, 0xE4, 0xE4, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x0A, 0xDC, 0xFF, 0xFF, 0xC8,
-0x00, 0x00, 0x00, 0x1A, 0xA8, 0xFF, 0xFF, 0xFF, 0x70, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00,
-0x00, 0x15, 0xFF, 0xFF, 0xFF, 0xAC, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF,
-0xFF, 0xFF, 0xBB, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x0A, 0x34, 0xC1, 0xFF, 0xFF, 0xFF, 0x93,
-0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x2D, 0xDC, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x58, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFE, 0xF1, 0xCE, 0x89, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x94, 0xD3, 0xF4, 0xFA,
-0xE7, 0xBA, 0x74, 0x19, 0x00, 0x00, 0x00, 0x02, 0x84, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF4, 0x0B, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC,
-0x00, 0x00, 0x53, 0xFF, 0xFF, 0xFF, 0xF4, 0x74, 0x20, 0x0F, 0x32, 0x85, 0xEA, 0x49, 0x00, 0x00,
-0xD6, 0xFF, 0xFF, 0xFE, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x2E, 0xFF, 0xFF,
-0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0x5A,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x48, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
-0xF2, 0xFF, 0xFF, 0xF7, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF,
-0xFF, 0xFF, 0xE8, 0x63, 0x1B, 0x0F, 0x2B, 0x55, 0x9E, 0x75, 0x00, 0x00, 0x0C, 0xDA, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x19, 0xCA, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x57, 0xAD, 0xE2, 0xF7, 0xF3,
-0xDC, 0xB9, 0x71, 0x1D, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0xDB, 0xA7, 0x61, 0x08,
-0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x51,
-0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71,
-0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x09, 0x35, 0x99, 0xFE, 0xFF, 0xFF, 0xFD, 0x40,
-0x00, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xFF, 0xFF, 0xFF, 0xC8, 0x00,
-0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 0xFF, 0x23, 0xD0,
-0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x60, 0xD0, 0xFF,
-0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0x7A, 0xD0, 0xFF, 0xFF,
-0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x86, 0xD0, 0xFF, 0xFF, 0xD4,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x75, 0xD0, 0xFF, 0xFF, 0xD4, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0x55, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x02, 0xD7, 0xFF, 0xFF, 0xFE, 0x15, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x02, 0x15, 0x4A,
-0xB6, 0xFF, 0xFF, 0xFF, 0xF8, 0x2E, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFB, 0x56, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xD7, 0x39, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xEA, 0xCD, 0x96, 0x49, 0x01,
-0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC,
-0xFC, 0x9D, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF,
-0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x33, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xE0, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xD0, 0xE0, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0xE0, 0xFF, 0xFF, 0xB4,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0xE0, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0xE0, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8,
-0xF8, 0x60, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x9D, 0x90, 0x1D, 0x0A, 0xF3, 0xFF, 0xFF,
+0xBE, 0x1F, 0xFF, 0xFF, 0xFF, 0xE1, 0x02, 0xC8, 0xFF, 0xFF, 0x8A, 0x00, 0x06, 0x41, 0x35, 0x00,
+0x37, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x20, 0xBC, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x6C, 0x2F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x1B,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xC4, 0xC4, 0xC4,
+0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x52, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x6C, 0x95, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x56,
+0x00, 0x00, 0x00, 0x1A, 0x48, 0x5A, 0x4A, 0x17, 0x00, 0x00, 0x00, 0x08, 0x6A, 0xD0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFD, 0xAD, 0x16, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1,
+0x05, 0x02, 0xD9, 0xFF, 0xE3, 0x9C, 0x89, 0xCD, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x4B, 0x53, 0x03,
+0x00, 0x00, 0x09, 0xEC, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+0xFF, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x5B, 0xF8, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0xFF, 0xFF,
+0xBD, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x37, 0xFD, 0xFF, 0xFF, 0x9D, 0x05, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x96, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0x68,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x50, 0x50, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x9A, 0x95,
+0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF,
+0xFF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3E, 0x3A, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF1, 0xFF, 0xFF, 0xFF, 0xEC, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xAE, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFB, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF9,
+0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xFF, 0xEF, 0x09, 0xEE, 0xFF,
+0xFF, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFF, 0xFF, 0xA5, 0x00, 0xA1,
+0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0x56, 0x00,
+0x4F, 0xFF, 0xFF, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xF8, 0x0D,
+0x00, 0x09, 0xF4, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE3, 0xFF, 0xFF, 0xB5,
+0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFF, 0xFF,
+0x64, 0x00, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x09, 0x00, 0x00, 0x5C, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x00, 0x00, 0xB9,
+0xFF, 0xFF, 0xFF, 0x2E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x2E, 0xFF, 0xFF, 0xFF, 0xB7, 0x00, 0x19,
+0xFC, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFC, 0x18,
+0x74, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+0x73, 0xD1, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF,
+0xFF, 0xD1, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF5, 0xE1, 0xBA, 0x76, 0x13, 0x00, 0x00, 0xDC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x3C, 0x00, 0xDC, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x03, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x0E,
+0x4B, 0xE9, 0xFF, 0xFF, 0xFF, 0x37, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF,
+0xFF, 0xFF, 0x4C, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0x31,
+0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x0F, 0x4A, 0xEB, 0xFF, 0xFF, 0xDA, 0x02, 0xDC, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x35, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xEF, 0x60, 0x06, 0x00, 0xDC, 0xFF, 0xFF, 0xF9, 0xE4, 0xE4, 0xF0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xC3, 0x0A, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0xFF, 0xFF, 0xFF,
+0x70, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xFF, 0xFF, 0xAC, 0xDC, 0xFF,
+0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xFF, 0xFF, 0xBB, 0xDC, 0xFF, 0xFF, 0xC8, 0x00,
+0x00, 0x0A, 0x34, 0xC1, 0xFF, 0xFF, 0xFF, 0x93, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFB, 0x2D, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6,
+0x58, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF1, 0xCE, 0x89, 0x1E, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0x94, 0xD3, 0xF4, 0xFA, 0xE7, 0xBA, 0x74, 0x19, 0x00, 0x00, 0x00, 0x02,
+0x84, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xFF, 0xF4, 0x74,
+0x20, 0x0F, 0x32, 0x85, 0xEA, 0x49, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFE, 0x44, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x02, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x86, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A,
+0xFF, 0xFF, 0xFF, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF,
+0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0x4E,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0xFF, 0xFF, 0xF7, 0x29, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xE8, 0x63, 0x1B, 0x0F, 0x2B, 0x55,
+0x9E, 0x75, 0x00, 0x00, 0x0C, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+0x00, 0x00, 0x00, 0x19, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x57, 0xAD, 0xE2, 0xF7, 0xF3, 0xDC, 0xB9, 0x71, 0x1D, 0x00, 0xD0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFE, 0xF0, 0xDB, 0xA7, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x51, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFC,
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
+0x09, 0x35, 0x99, 0xFE, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x66, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xC7, 0xFF, 0xFF, 0xFF, 0x23, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x60, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x4B, 0xFF, 0xFF, 0xFF, 0x7A, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+0xFF, 0xFF, 0xFF, 0x86, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+0xFF, 0xFF, 0x75, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF,
+0xFF, 0x55, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD7, 0xFF, 0xFF, 0xFE,
+0x15, 0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xB3, 0x00,
+0xD0, 0xFF, 0xFF, 0xD4, 0x00, 0x02, 0x15, 0x4A, 0xB6, 0xFF, 0xFF, 0xFF, 0xF8, 0x2E, 0x00, 0xD0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x56, 0x00, 0x00, 0xD0, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x39, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF9, 0xEA, 0xCD, 0x96, 0x49, 0x01, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+0xEC, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x9D, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF,
+0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x33,
+0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF,
+0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xEC, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
+0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xE0, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC,
+0xFC, 0xFC, 0xFC, 0xCC, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x64,
+0xE0, 0xFF, 0xFF, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x60, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x6A, 0xAF, 0xE0,
-0xF3, 0xFB, 0xEA, 0xC3, 0x85, 0x31, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x4B, 0x17, 0x13, 0x31,
-0x69, 0xC9, 0x2F, 0x00, 0x02, 0xD5, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x91, 0xFF, 0xFF, 0xFF, 0x31, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
-0x9F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x93,
-0xFF, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x7C, 0xFF,
-0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x04, 0x08, 0x08, 0x61, 0xFF, 0xFF, 0xFF, 0x30, 0x47, 0xFF, 0xFF,
-0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0x30, 0x0A, 0xEF, 0xFF, 0xFF,
-0xFA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x86, 0xFF, 0xFF, 0xFF,
-0xF0, 0x71, 0x21, 0x0E, 0x26, 0x84, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x08, 0xD0, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x12, 0xBB, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x47, 0xA0, 0xDB, 0xF3,
-0xF9, 0xE7, 0xD4, 0xB4, 0x7F, 0x38, 0x02, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
-0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF,
-0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4,
-0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF,
-0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC2, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xAE, 0xFF, 0xFF,
-0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4,
+0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0x6A, 0xAF, 0xE0, 0xF3, 0xFB, 0xEA, 0xC3, 0x85, 0x31, 0x00, 0x00,
+0x00, 0x00, 0x5F, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00,
+0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x4E, 0xFF,
+0xFF, 0xFF, 0xFF, 0xBC, 0x4B, 0x17, 0x13, 0x31, 0x69, 0xC9, 0x2F, 0x00, 0x02, 0xD5, 0xFF, 0xFF,
+0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF, 0xD0,
+0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x68, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0x31, 0x00, 0x00,
+0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x9F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x9C,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x93, 0xFF, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x9C, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x7C, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x04, 0x08, 0x08,
+0x61, 0xFF, 0xFF, 0xFF, 0x30, 0x47, 0xFF, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+0xFF, 0xFF, 0xFF, 0x30, 0x0A, 0xEF, 0xFF, 0xFF, 0xFA, 0x35, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF,
+0xFF, 0xFF, 0x30, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xF0, 0x71, 0x21, 0x0E, 0x26, 0x84, 0xFF, 0xFF,
+0xFF, 0x30, 0x00, 0x08, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x30, 0x00, 0x00, 0x12, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x00, 0x00, 0x00, 0x00, 0x47, 0xA0, 0xDB, 0xF3, 0xF9, 0xE7, 0xD4, 0xB4, 0x7F, 0x38, 0x02, 0xE4,
 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF,
 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x54, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x0B, 0x71, 0xE1, 0xFF, 0xFF, 0xFF, 0xEB, 0x80, 0x13,
-0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60,
-0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF,
-0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40,
-0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
+0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF,
+0xF4, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE4,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC2, 0x08,
+0x08, 0x08, 0x08, 0x08, 0x08, 0xAE, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
+0xFF, 0xFF, 0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF,
+0xF4, 0xE4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0xE4,
+0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xF4, 0x54, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x0B,
+0x71, 0xE1, 0xFF, 0xFF, 0xFF, 0xEB, 0x80, 0x13, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF,
-0x60, 0x00, 0x00, 0x0B, 0x70, 0xE1, 0xFF, 0xFF, 0xFF, 0xEB, 0x7F, 0x13, 0x54, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
-0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x14, 0xFB, 0xFF, 0xFF, 0xAD, 0x2D, 0x1B,
-0x25, 0xAC, 0xFF, 0xFF, 0xFF, 0x74, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x18, 0xC8, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFC, 0x5A, 0x00, 0xA2, 0xF2, 0xFB, 0xE7, 0xAB, 0x36, 0x00, 0x00, 0xD4, 0xFF,
-0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x8D, 0xD4, 0xFF, 0xFF, 0xD0,
-0x00, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0xFF, 0xFF, 0xBD, 0x03, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-0x00, 0x2A, 0xF2, 0xFF, 0xFF, 0xE0, 0x14, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0xDB,
-0xFF, 0xFF, 0xF6, 0x31, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xB7, 0xFF, 0xFF, 0xFF,
-0x5C, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x48, 0xFE, 0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0xFF, 0xE1, 0xE8, 0xFF, 0xFF, 0xFF, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x39, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xF9, 0x74, 0x3D,
-0xFE, 0xFF, 0xFF, 0xD4, 0x06, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x99, 0xFF,
-0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF,
-0xF8, 0x28, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xFF, 0xC3,
-0x01, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0xFF, 0xFF, 0x67, 0x00,
-0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF5, 0xFF, 0xFF, 0xF0, 0x1A, 0xD4, 0xFF,
-0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xAE, 0xC8, 0xFF, 0xFF, 0xDC,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
+0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60,
+0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x0B, 0x70, 0xE1, 0xFF, 0xFF,
+0xFF, 0xEB, 0x7F, 0x13, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0x54, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+0xFF, 0xFF, 0xFF, 0x8D, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0xFF, 0xFF,
+0xBD, 0x03, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2A, 0xF2, 0xFF, 0xFF, 0xE0, 0x14, 0x00,
+0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0xDB, 0xFF, 0xFF, 0xF6, 0x31, 0x00, 0x00, 0xD4, 0xFF,
+0xFF, 0xD0, 0x00, 0x02, 0xB7, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0,
+0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x48, 0xFE,
+0xFF, 0xFF, 0xBF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xE1, 0xE8, 0xFF, 0xFF, 0xFF,
+0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x39, 0x00, 0x00,
+0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xF9, 0x74, 0x3D, 0xFE, 0xFF, 0xFF, 0xD4, 0x06, 0x00, 0x00, 0x00,
+0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x99, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0xD4, 0xFF,
+0xFF, 0xD0, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xF8, 0x28, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0,
+0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xFF, 0xC3, 0x01, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+0x00, 0x00, 0xB6, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x20, 0xF5, 0xFF, 0xFF, 0xF0, 0x1A, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
+0xFF, 0xFF, 0xFF, 0xAE, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -719,650 +560,502 @@ const uint8_t  NotoSansBold24[] PROGMEM = {
 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28,
-0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xC8, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF,
-0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF,
-0xFF, 0xFF, 0xFF, 0xF2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xBC, 0xD0, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xFF,
-0xF3, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC7, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x68, 0xFE, 0xFF, 0xE9, 0x02, 0x00,
-0x00, 0x00, 0x1D, 0xFE, 0xFF, 0xCE, 0x8C, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x5B, 0xC7, 0xFF,
-0xFF, 0x3D, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF, 0x78, 0x96, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF,
-0x65, 0x76, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x22, 0x9E, 0xFF, 0xFF, 0xBC,
-0xD0, 0xFF, 0xFF, 0x6C, 0x25, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x1E, 0xFE, 0xFF, 0xCB, 0x00, 0xA3,
-0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x6F, 0x00, 0xD5, 0xFF, 0xFF, 0x30, 0x00, 0x74, 0xFF, 0xFF,
-0x74, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x84, 0xFF, 0xFF, 0x81, 0x00,
-0xCA, 0xFF, 0xFF, 0x1F, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x34, 0xFF,
-0xFF, 0xD2, 0x20, 0xFF, 0xFF, 0xC7, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70,
-0x00, 0x00, 0xE2, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0,
-0xFF, 0xFF, 0x70, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0x00, 0x00, 0xA4, 0xFF,
-0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00,
-0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x04, 0xED, 0xFF, 0xFF, 0xFF,
-0x6D, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xA0,
-0xFF, 0xFF, 0xFD, 0x19, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xCC, 0xFF, 0xFF, 0xFF, 0xFD,
-0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
-0xCB, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xED, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xB5, 0xFF,
-0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x55, 0xD5,
-0xFF, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x5E, 0x42,
-0xFF, 0xFF, 0xFF, 0xCB, 0x02, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x69, 0x00,
-0xA9, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x71, 0x00,
-0x1C, 0xF4, 0xFF, 0xFF, 0xED, 0x13, 0x00, 0x8A, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x79, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x84, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x06, 0xDA, 0xFF, 0xFF, 0xFD, 0x36, 0x7C, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xCB, 0x72, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0x21, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x09, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x30,
-0x91, 0xCF, 0xEC, 0xFA, 0xED, 0xD1, 0x94, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA2,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xBE,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x03, 0x00, 0x00, 0x77,
-0xFF, 0xFF, 0xFF, 0xF5, 0x7B, 0x26, 0x0D, 0x23, 0x73, 0xF1, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x06,
-0xE8, 0xFF, 0xFF, 0xFE, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFD, 0xFF, 0xFF, 0xE9, 0x07,
-0x3E, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xFF, 0xFF,
-0x40, 0x74, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
-0xFF, 0x76, 0x8C, 0xFF, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF,
-0xFF, 0xFF, 0x8E, 0x97, 0xFF, 0xFF, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-0xFF, 0xFF, 0xFF, 0x9B, 0x8B, 0xFF, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x3B, 0xFF, 0xFF, 0xFF, 0x8E, 0x72, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x75, 0x3B, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0x3D, 0x05, 0xE4, 0xFF, 0xFF, 0xFE, 0x45, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x3D, 0xFD, 0xFF, 0xFF, 0xE6, 0x06, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xF5, 0x7C, 0x28,
-0x11, 0x26, 0x77, 0xF3, 0xFF, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x02, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x07, 0x9D, 0xFE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-0x90, 0xCF, 0xED, 0xFB, 0xED, 0xD0, 0x91, 0x30, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFE, 0xF2, 0xD4, 0x97, 0x2F, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFC, 0x74, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x43,
-0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x03, 0x21, 0x9F, 0xFF, 0xFF, 0xFF, 0xAF, 0xDC, 0xFF, 0xFF, 0xC8,
-0x00, 0x00, 0x00, 0x03, 0xE4, 0xFF, 0xFF, 0xE2, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00,
-0xC3, 0xFF, 0xFF, 0xED, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x0B, 0xED, 0xFF, 0xFF, 0xD6,
-0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x0B, 0x37, 0xBC, 0xFF, 0xFF, 0xFF, 0x96, 0xDC, 0xFF, 0xFF, 0xFF,
-0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x22, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xEF, 0x48, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xED, 0xC5, 0x7E, 0x17, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC8, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x28, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28,
+0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x07, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1C, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x4A,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0xAB,
+0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xBC, 0xD0,
+0xFF, 0xFF, 0x68, 0xFE, 0xFF, 0xE9, 0x02, 0x00, 0x00, 0x00, 0x1D, 0xFE, 0xFF, 0xCE, 0x8C, 0xFF,
+0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x5B, 0xC7, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x72, 0xFF, 0xFF,
+0x78, 0x96, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x65, 0x76, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00,
+0xC8, 0xFF, 0xFF, 0x22, 0x9E, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x6C, 0x25, 0xFF, 0xFF, 0xDF,
+0x00, 0x00, 0x1E, 0xFE, 0xFF, 0xCB, 0x00, 0xA3, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x6F, 0x00,
+0xD5, 0xFF, 0xFF, 0x30, 0x00, 0x74, 0xFF, 0xFF, 0x74, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF,
+0xFF, 0x70, 0x00, 0x84, 0xFF, 0xFF, 0x81, 0x00, 0xCA, 0xFF, 0xFF, 0x1F, 0x00, 0xA4, 0xFF, 0xFF,
+0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x34, 0xFF, 0xFF, 0xD2, 0x20, 0xFF, 0xFF, 0xC7, 0x00, 0x00,
+0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0x99, 0xFF, 0xFF,
+0x71, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x92, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFE, 0x1C, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC, 0xD0, 0xFF, 0xFF,
+0x70, 0x00, 0x00, 0x04, 0xED, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xBC,
+0xD0, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFD, 0x19, 0x00, 0x00, 0x00, 0xA4,
+0xFF, 0xFF, 0xBC, 0xCC, 0xFF, 0xFF, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x13, 0x00, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0xB5, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x55, 0xD5, 0xFF, 0xFF, 0xFD, 0x36, 0x00, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x5E, 0x42, 0xFF, 0xFF, 0xFF, 0xCB, 0x02, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x69, 0x00, 0xA9, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x8C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x71, 0x00, 0x1C, 0xF4, 0xFF, 0xFF, 0xED, 0x13, 0x00, 0x8A,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x79, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x84,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x06, 0xDA, 0xFF, 0xFF, 0xFD, 0x36, 0x7C,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xCB, 0x72,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xCB,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x21, 0xF7, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xB8, 0xCC, 0xFF, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF,
+0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x30, 0x91, 0xCF, 0xEC, 0xFA, 0xED, 0xD1, 0x94, 0x35,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xA6, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xC1, 0x03, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xF5, 0x7B, 0x26, 0x0D, 0x23,
+0x73, 0xF1, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x06, 0xE8, 0xFF, 0xFF, 0xFE, 0x46, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x3A, 0xFD, 0xFF, 0xFF, 0xE9, 0x07, 0x3E, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xFF, 0xFF, 0x40, 0x74, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x76, 0x8C, 0xFF, 0xFF, 0xFF, 0x41, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x8E, 0x97, 0xFF, 0xFF, 0xFF, 0x37,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0x9B, 0x8B, 0xFF, 0xFF, 0xFF,
+0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x8E, 0x72, 0xFF, 0xFF,
+0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x75, 0x3B, 0xFF,
+0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0x3D, 0x05,
+0xE4, 0xFF, 0xFF, 0xFE, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFD, 0xFF, 0xFF, 0xE6, 0x06,
+0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xF5, 0x7C, 0x28, 0x11, 0x26, 0x77, 0xF3, 0xFF, 0xFF, 0xFF, 0x72,
+0x00, 0x00, 0x02, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8,
+0x02, 0x00, 0x00, 0x00, 0x07, 0x9D, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0xCF, 0xED, 0xFB, 0xED, 0xD0, 0x91, 0x30,
+0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF2, 0xD4, 0x97, 0x2F, 0x00, 0x00,
+0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x74, 0x00, 0xDC, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x03, 0x21, 0x9F,
+0xFF, 0xFF, 0xFF, 0xAF, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x03, 0xE4, 0xFF, 0xFF, 0xE2,
+0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xED, 0xDC, 0xFF, 0xFF, 0xC8,
+0x00, 0x00, 0x00, 0x0B, 0xED, 0xFF, 0xFF, 0xD6, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x0B, 0x37, 0xBC,
+0xFF, 0xFF, 0xFF, 0x96, 0xDC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x22,
+0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x48, 0x00, 0xDC, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFC, 0xED, 0xC5, 0x7E, 0x17, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xC8,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xDC, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0xC8,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x91, 0xCF, 0xEC,
-0xFA, 0xED, 0xD1, 0x94, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA2, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x03, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF,
-0xF5, 0x7B, 0x26, 0x0D, 0x23, 0x73, 0xF1, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x06, 0xE8, 0xFF, 0xFF,
-0xFE, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFD, 0xFF, 0xFF, 0xE9, 0x07, 0x3E, 0xFF, 0xFF,
-0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xFF, 0xFF, 0xFF, 0x40, 0x74, 0xFF,
-0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x76, 0x8C,
-0xFF, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x8E,
-0x97, 0xFF, 0xFF, 0xFF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF,
-0x9C, 0x8B, 0xFF, 0xFF, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF,
-0xFF, 0x92, 0x72, 0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
-0xFF, 0xFF, 0x75, 0x3B, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB,
-0xFF, 0xFF, 0xFF, 0x40, 0x05, 0xE4, 0xFF, 0xFF, 0xFE, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-0xFD, 0xFF, 0xFF, 0xE7, 0x04, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xF5, 0x7C, 0x28, 0x11, 0x26, 0x77,
-0xF3, 0xFF, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x02, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x07, 0x9E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0x9B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x91, 0xD0, 0xED,
-0xFD, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x08, 0xCC, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x1F, 0xEC, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xFD, 0xFF, 0xFF, 0xF9, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xEF, 0x29, 0xD4, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFB, 0xEE, 0xCC, 0x93, 0x32, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x8A, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x09, 0x2A, 0x98, 0xFF,
-0xFF, 0xFF, 0xD1, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF,
-0xFF, 0x06, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x0E,
-0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xD2, 0xFF, 0xFF, 0xED, 0x00, 0x00, 0xD4,
-0xFF, 0xFF, 0xD0, 0x00, 0x0D, 0x31, 0xA7, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0xD4, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x15, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFD, 0xF4, 0xF6, 0xFF,
-0xFF, 0xFD, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xD4, 0xFF, 0xFF,
-0xE3, 0x12, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x31, 0xFA, 0xFF, 0xFF, 0xB1,
-0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x6E, 0x00,
-0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC8, 0xFF, 0xFF, 0xF8, 0x31, 0x00, 0xD4,
-0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x26, 0xF5, 0xFF, 0xFF, 0xD9, 0x0C, 0xD4, 0xFF, 0xFF,
-0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x31, 0x9F, 0xDC,
-0xF7, 0xF8, 0xDF, 0xA9, 0x55, 0x09, 0x00, 0x00, 0x6C, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xDA, 0x00, 0x31, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x8F,
-0xFF, 0xFF, 0xFF, 0x75, 0x15, 0x1C, 0x40, 0x86, 0xE0, 0x1F, 0x00, 0xB1, 0xFF, 0xFF, 0xE6, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFE, 0x39, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xF5, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x84, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xA1, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xE7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFB, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xC9, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFF, 0xFD, 0x07, 0x32, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0x16, 0xE8, 0xD2, 0x78, 0x33, 0x0C, 0x09, 0x3C, 0xE0, 0xFF,
-0xFF, 0xEB, 0x02, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0xE7,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x05, 0x00, 0x25, 0x82, 0xC3, 0xEA, 0xFB,
-0xF8, 0xDF, 0xA8, 0x48, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0x84, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x84, 0x04, 0x08, 0x08, 0x08, 0x08, 0xD5, 0xFF, 0xFF, 0xCD, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF,
-0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF,
-0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C,
+0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xEE, 0xCC, 0x93, 0x32, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x8A, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x09,
+0x2A, 0x98, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0xC8, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+0xFF, 0xFF, 0x0E, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xD2, 0xFF, 0xFF, 0xED,
+0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x0D, 0x31, 0xA7, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00,
+0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x15, 0x00, 0x00, 0xD4, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x1C, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFD,
+0xF4, 0xF6, 0xFF, 0xFF, 0xFD, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x07,
+0xD4, 0xFF, 0xFF, 0xE3, 0x12, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x31, 0xFA,
+0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+0xFF, 0x6E, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC8, 0xFF, 0xFF, 0xF8,
+0x31, 0x00, 0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x26, 0xF5, 0xFF, 0xFF, 0xD9, 0x0C,
+0xD4, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00,
+0x31, 0x9F, 0xDC, 0xF7, 0xF8, 0xDF, 0xA9, 0x55, 0x09, 0x00, 0x00, 0x6C, 0xFC, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x00, 0x31, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x84, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x75, 0x15, 0x1C, 0x40, 0x86, 0xE0, 0x1F, 0x00, 0xB1, 0xFF,
+0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFE, 0x39, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFF, 0xF5, 0x82, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x84, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B,
+0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xB9, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFB, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC6, 0xFF, 0xFF, 0xFF,
+0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 0xFF, 0xFF, 0xFD, 0x07, 0x32, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0x16, 0xE8, 0xD2, 0x78, 0x33, 0x0C, 0x09,
+0x3C, 0xE0, 0xFF, 0xFF, 0xEB, 0x02, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x81, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x05, 0x00, 0x25, 0x82,
+0xC3, 0xEA, 0xFB, 0xF8, 0xDF, 0xA8, 0x48, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x84, 0x04, 0x08, 0x08, 0x08, 0x08, 0xD5, 0xFF, 0xFF, 0xCD, 0x08, 0x08, 0x08,
+0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4,
+0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF,
+0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xD4, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4,
+0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C,
 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF,
 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF,
 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF,
 0x04, 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04,
 0xFC, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC,
-0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF,
-0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF,
-0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFC, 0xFF, 0xFF, 0xA0,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFB, 0xFF, 0xFF, 0xA3, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x03, 0xEE, 0xFF, 0xFF, 0xBE, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xFF, 0xEF, 0x00, 0xC7, 0xFF, 0xFF, 0xF8, 0x1A, 0x00, 0x00,
-0x00, 0x00, 0x1B, 0xF8, 0xFF, 0xFF, 0xCA, 0x00, 0x73, 0xFF, 0xFF, 0xFF, 0xD0, 0x48, 0x15, 0x1D,
-0x50, 0xDB, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x09, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xCD, 0x09, 0x00, 0x00, 0x1F, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xC1, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5C, 0xB1, 0xE4, 0xF8, 0xF3, 0xDC, 0xA7, 0x52,
-0x01, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xEA, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-0xEA, 0xFF, 0xFF, 0xD2, 0x7A, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
-0xFF, 0xFF, 0xFF, 0x79, 0x20, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97,
-0xFF, 0xFF, 0xFE, 0x20, 0x00, 0xC6, 0xFF, 0xFF, 0xE6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE8,
-0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF,
-0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x16, 0xFB, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x94, 0xFF,
-0xFF, 0xFB, 0x15, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x01, 0xE5, 0xFF,
-0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0x00, 0x3C, 0xFF, 0xFF,
-0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x91, 0xFF, 0xFF,
-0xF6, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xDC, 0x00, 0x01, 0xE3, 0xFF, 0xFF,
-0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x2C, 0x34, 0xFF, 0xFF, 0xFF,
-0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFF, 0x74, 0x79, 0xFF, 0xFF, 0xEF,
-0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xB5, 0xB9, 0xFF, 0xFF, 0x9C,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xED, 0xEF, 0xFF, 0xFF, 0x42,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x02,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFF, 0xFF,
-0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xDE, 0x9E, 0xFF, 0xFF, 0xE5, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF,
-0xFF, 0x9D, 0x5D, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF, 0xFF, 0xFF, 0xDA,
-0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xFF, 0xFF, 0x5C, 0x1C, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00,
-0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0x1B,
-0x00, 0xDB, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x5F, 0x00,
-0x00, 0x00, 0x98, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0xA1,
-0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x58,
-0xFF, 0xFF, 0xFE, 0x12, 0x00, 0x00, 0xE2, 0xFF, 0xFE, 0x23, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x10,
-0xFE, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x26, 0xFF, 0xFF, 0xD7,
-0x00, 0xDA, 0xFF, 0xFF, 0x28, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0x17, 0x00, 0x00, 0x00, 0xD6, 0xFF,
-0xFF, 0x89, 0x00, 0x68, 0xFF, 0xFF, 0x99, 0x00, 0x9B, 0xFF, 0xFF, 0x6A, 0x00, 0x86, 0xFF, 0xFF,
-0xD5, 0x00, 0x00, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0xC2, 0x00, 0xA9, 0xFF, 0xFF, 0x57, 0x00, 0x5A,
-0xFF, 0xFF, 0xAC, 0x00, 0xC0, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0xFF, 0xF4,
-0x02, 0xE7, 0xFF, 0xFF, 0x17, 0x00, 0x18, 0xFF, 0xFF, 0xE4, 0x03, 0xF5, 0xFF, 0xFF, 0x53, 0x00,
-0x00, 0x00, 0x00, 0x14, 0xFE, 0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0xD6, 0xFF,
-0xFF, 0x40, 0xFF, 0xFF, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0x9E, 0xFF,
-0xFF, 0x92, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x90, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xEB,
-0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x11,
-0x00, 0x00, 0x00, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD,
-0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0xAC,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x43, 0x00, 0xAC, 0xFF, 0xFF, 0xFF,
-0x47, 0x00, 0x00, 0x00, 0x00, 0x38, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x17, 0xEE, 0xFF, 0xFF,
-0xDA, 0x07, 0x00, 0x00, 0x02, 0xCB, 0xFF, 0xFF, 0xEA, 0x13, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xFF,
-0xFF, 0x7C, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFF,
-0xFF, 0xF6, 0x20, 0x11, 0xEB, 0xFF, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF4,
-0xFF, 0xFF, 0xB1, 0x94, 0xFF, 0xFF, 0xF5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
-0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC6,
-0xFF, 0xFF, 0xE5, 0xFB, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-0xFF, 0xFF, 0x4B, 0x8C, 0xFF, 0xFF, 0xFF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF4, 0xFF,
-0xFF, 0xAC, 0x00, 0x0B, 0xE1, 0xFF, 0xFF, 0xE4, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xFF, 0xFF,
-0xF2, 0x1B, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xFF, 0xFF,
-0x6F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x18, 0xEE, 0xFF, 0xFF, 0xCE,
-0x03, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF4, 0xFF, 0xFF, 0xE8, 0x13, 0xAD, 0xFF, 0xFF, 0xFD, 0x35,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xFF, 0xFF, 0xFF, 0xA9, 0xBB, 0xFF, 0xFF, 0xFE, 0x31,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0xFF, 0xFF, 0xB9, 0x32, 0xFE, 0xFF, 0xFF, 0xB3, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFD, 0x2F, 0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0x35, 0x00,
-0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x21, 0xF9, 0xFF, 0xFF, 0xB7, 0x00, 0x00,
-0x00, 0xB6, 0xFF, 0xFF, 0xF6, 0x1D, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x39,
-0xFF, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF1, 0xFF, 0xFF, 0xBC, 0x00, 0xBC, 0xFF,
-0xFF, 0xEB, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFF, 0xFF,
-0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x05,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0x04, 0xFB, 0xFF,
+0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0x03, 0xEE, 0xFF, 0xFF,
+0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0xFF, 0xEF, 0x00, 0xC7, 0xFF, 0xFF, 0xF8,
+0x1A, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0xFF, 0xFF, 0xCA, 0x00, 0x73, 0xFF, 0xFF, 0xFF, 0xD0,
+0x48, 0x15, 0x1D, 0x50, 0xDB, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x09, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x09, 0x00, 0x00, 0x1F, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5C, 0xB1, 0xE4, 0xF8, 0xF3,
+0xDC, 0xA7, 0x52, 0x01, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xEA, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xEA, 0xFF, 0xFF, 0xD2, 0x7A, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x43, 0xFF, 0xFF, 0xFF, 0x79, 0x20, 0xFF, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x97, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0xC6, 0xFF, 0xFF, 0xE6, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xE8, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00,
+0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x16, 0xFB, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00,
+0x00, 0x94, 0xFF, 0xFF, 0xFB, 0x15, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+0x01, 0xE5, 0xFF, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0x00,
+0x3C, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF6, 0xFF, 0xFF, 0x89, 0x00, 0x00,
+0x91, 0xFF, 0xFF, 0xF6, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xFF, 0xDC, 0x00, 0x01,
+0xE3, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x2C, 0x34,
+0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFF, 0x74, 0x79,
+0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xB5, 0xB9,
+0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xFF, 0xFF, 0xED, 0xEF,
+0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE6, 0xFF, 0xFF, 0xFF,
+0xFF, 0xE5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0xFF, 0xFF,
+0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x56, 0xFF, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xDE, 0x9E, 0xFF,
+0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xE5, 0xFF, 0xFF, 0x9D, 0x5D, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFF,
+0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFF, 0xFF, 0xFF, 0x5C, 0x1C, 0xFF, 0xFF, 0xFF,
+0x5D, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x5C, 0xFF,
+0xFF, 0xFF, 0x1B, 0x00, 0xDB, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xE1, 0xFF,
+0xFF, 0x5F, 0x00, 0x00, 0x00, 0x98, 0xFF, 0xFF, 0xDA, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xD5, 0x00,
+0x00, 0x00, 0xA1, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0x99,
+0x00, 0x00, 0x58, 0xFF, 0xFF, 0xFE, 0x12, 0x00, 0x00, 0xE2, 0xFF, 0xFE, 0x23, 0xFF, 0xFF, 0xE5,
+0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x26,
+0xFF, 0xFF, 0xD7, 0x00, 0xDA, 0xFF, 0xFF, 0x28, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0x17, 0x00, 0x00,
+0x00, 0xD6, 0xFF, 0xFF, 0x89, 0x00, 0x68, 0xFF, 0xFF, 0x99, 0x00, 0x9B, 0xFF, 0xFF, 0x6A, 0x00,
+0x86, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0xC2, 0x00, 0xA9, 0xFF, 0xFF,
+0x57, 0x00, 0x5A, 0xFF, 0xFF, 0xAC, 0x00, 0xC0, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x54,
+0xFF, 0xFF, 0xF4, 0x02, 0xE7, 0xFF, 0xFF, 0x17, 0x00, 0x18, 0xFF, 0xFF, 0xE4, 0x03, 0xF5, 0xFF,
+0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFE, 0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
+0x00, 0xD6, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+0xFF, 0x9E, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x53,
+0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFD, 0x11, 0x00, 0x00, 0x00, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xFF, 0xFF, 0xFF, 0x8C,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xFF,
+0xFF, 0xFE, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFE, 0xFF, 0xFF, 0xB9, 0x32, 0xFE, 0xFF,
+0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFD, 0x2F, 0x00, 0xA6, 0xFF, 0xFF,
+0xFF, 0x35, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x21, 0xF9, 0xFF, 0xFF,
+0xB7, 0x00, 0x00, 0x00, 0xB6, 0xFF, 0xFF, 0xF6, 0x1D, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF,
+0x3A, 0x00, 0x39, 0xFF, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF1, 0xFF, 0xFF, 0xBC,
+0x00, 0xBC, 0xFF, 0xFF, 0xEB, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0x7D,
+0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xDC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD7, 0xFF, 0xFF, 0xFF, 0xC8, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xF3, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xFC, 0xFF, 0xFF, 0xAC, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xDD, 0xFF, 0xFF, 0xE4, 0x12, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFE, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x57, 0xFF, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xEF,
-0xFF, 0xFF, 0xCF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC1, 0xFF, 0xFF, 0xF6,
-0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0xFF, 0x6B, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFA, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x0B, 0xDA, 0xFF, 0xFF, 0xE9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x9D, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x6C, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x2E, 0x7C,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x7C, 0xFF, 0xFF, 0xC8, 0x80, 0x80, 0x18, 0x7C, 0xFF, 0xFF,
-0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00,
-0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF,
-0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90,
-0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C,
-0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
-0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xC8, 0x80,
-0x80, 0x18, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x78, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x2E,
-0x0B, 0xF6, 0xFC, 0xF9, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x54,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x34, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEB, 0xFF,
-0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-0xFF, 0xFF, 0xF3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0x3E, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x49, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0xFF, 0xFD,
-0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF,
-0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0xFF, 0xFF, 0x29, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x5E, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xF5, 0x06,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x8C, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF,
-0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF6, 0xFF, 0xFE, 0x16, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xB4, 0xF8, 0xF8, 0x57, 0xCD, 0xF8, 0xF8, 0xF8, 0xF8, 0xD1, 0xD4, 0xFF,
-0xFF, 0xFF, 0xFF, 0xD8, 0x6A, 0x80, 0x9A, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8,
-0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF,
-0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8,
-0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF,
-0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8,
-0x00, 0x00, 0x34, 0xFF, 0xFF, 0xD8, 0x6A, 0x80, 0x9A, 0xFF, 0xFF, 0xD8, 0xD4, 0xFF, 0xFF, 0xFF,
-0xFF, 0xD8, 0xCD, 0xF8, 0xF8, 0xF8, 0xF8, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3C, 0x18,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB9, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFD, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x17, 0xF8, 0xFF, 0xD1, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x86, 0xFF, 0xFA, 0x1E, 0xD9, 0xFF, 0xCE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xEE,
-0xFF, 0xA6, 0x00, 0x5D, 0xFF, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFF, 0xFF, 0x36,
-0x00, 0x03, 0xD9, 0xFF, 0xD7, 0x03, 0x00, 0x00, 0x00, 0x04, 0xE1, 0xFF, 0xC7, 0x00, 0x00, 0x00,
-0x5D, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x03, 0xD9,
-0xFF, 0xDF, 0x06, 0x00, 0x00, 0xD1, 0xFF, 0xE3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF,
-0x6B, 0x00, 0x3C, 0xE8, 0xE8, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC9, 0xE8, 0xCF, 0x05,
-0x0A, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC7, 0x09, 0xCC, 0xCC, 0xCC, 0xCC,
-0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xBC, 0xB2, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x04, 0x98, 0xFF,
-0xFF, 0xFA, 0x37, 0x00, 0x00, 0x00, 0x6D, 0xFB, 0xFF, 0xE4, 0x18, 0x00, 0x00, 0x00, 0x3E, 0xE5,
-0xFF, 0xC7, 0x00, 0x05, 0x54, 0xA2, 0xD5, 0xF3, 0xFC, 0xEE, 0xC4, 0x73, 0x09, 0x00, 0x00, 0x86,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x13, 0x00, 0x19, 0xF6, 0xFF, 0xEC, 0xC5,
-0xB1, 0xE2, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x58, 0x41, 0x02, 0x00, 0x00, 0x06, 0xD0, 0xFF,
-0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-0x4F, 0x9C, 0xCA, 0xE3, 0xF2, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xB7, 0x52, 0x30, 0x20, 0x97, 0xFF,
-0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD8, 0x02, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF,
-0xFF, 0xD2, 0x02, 0x00, 0x00, 0x38, 0xF5, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xFF, 0xCF, 0xA3,
-0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x88, 0xFF,
-0xFF, 0xFF, 0x00, 0x3B, 0xBA, 0xF2, 0xFA, 0xE6, 0xAC, 0x35, 0x00, 0xC1, 0xFF, 0xFF, 0x24, 0xFF,
-0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-0xFF, 0xFF, 0xFF, 0x63, 0x39, 0xB8, 0xF0, 0xF4, 0xC6, 0x52, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF,
-0x9B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC,
-0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0x24, 0x24, 0xFF, 0xFF, 0xFF, 0xF1, 0x3C, 0x00, 0x07, 0xA2, 0xFF,
-0xFF, 0xFF, 0x88, 0x24, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0xFF, 0xFF, 0xC7,
-0x24, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xE9, 0x24, 0xFF, 0xFF,
-0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xF4, 0x24, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
-0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xE8, 0x24, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x13,
-0xF7, 0xFF, 0xFF, 0xC6, 0x24, 0xFF, 0xFF, 0xFF, 0xF6, 0x50, 0x02, 0x0C, 0xAB, 0xFF, 0xFF, 0xFF,
-0x87, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0x22, 0x24, 0xFF,
-0xFF, 0xFE, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x24, 0xFF, 0xFF, 0xBF, 0x00,
-0x54, 0xC6, 0xF5, 0xF3, 0xC1, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x12, 0x7F, 0xCC, 0xF0, 0xF8, 0xDE,
-0xB8, 0x61, 0x0A, 0x00, 0x31, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x11, 0x0D, 0xE1,
-0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xAD, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xB2, 0x13, 0x00,
-0x13, 0x65, 0x3C, 0x00, 0xB9, 0xFF, 0xFF, 0xF7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2,
-0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xB6, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xC6, 0xFF, 0xFF, 0xF5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0xFF, 0xAE,
-0x11, 0x00, 0x08, 0x4E, 0xAC, 0x00, 0x1E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFE, 0xEA, 0xFB, 0xFF, 0xE0,
-0x00, 0x00, 0x55, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x9C,
-0xDD, 0xF7, 0xFB, 0xE6, 0xAD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 0xFF,
-0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x46, 0xBE, 0xF1, 0xF3, 0xC5, 0x54,
-0x4D, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF,
-0xFF, 0x34, 0x1D, 0xF6, 0xFF, 0xFF, 0xFF, 0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x7F,
-0xFF, 0xFF, 0xFF, 0xB0, 0x10, 0x01, 0x3F, 0xE8, 0xFF, 0xFF, 0xFF, 0x34, 0xBF, 0xFF, 0xFF, 0xF8,
-0x15, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0x34, 0xE1, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x00,
-0x00, 0x36, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF,
-0xFF, 0xFF, 0x34, 0xE2, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0xFF, 0x34,
-0xC2, 0xFF, 0xFF, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xFF, 0x34, 0x83, 0xFF, 0xFF,
-0xFF, 0xA0, 0x06, 0x00, 0x27, 0xDC, 0xFF, 0xFF, 0xFF, 0x34, 0x21, 0xF8, 0xFF, 0xFF, 0xFF, 0xF7,
-0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x74,
-0xFB, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x4D, 0xC4, 0xF4, 0xF3, 0xC0, 0x47, 0x00, 0xB4, 0xFF, 0xFF,
-0x34, 0x00, 0x00, 0x0E, 0x7B, 0xCB, 0xF1, 0xF9, 0xE1, 0xA5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x28,
-0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6E, 0x00, 0x00, 0x08, 0xD9, 0xFF, 0xFF, 0xFC,
-0xAE, 0x99, 0xDC, 0xFF, 0xFF, 0xFD, 0x3B, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x07,
-0xC9, 0xFF, 0xFF, 0xAD, 0x00, 0xB2, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF,
-0xEB, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xEB,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xDF, 0xFF, 0xFF, 0xD8,
-0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x03, 0xB5, 0xFF, 0xFF, 0xEB, 0x07, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0xFF, 0x9A, 0x07, 0x00, 0x00, 0x00, 0x0C,
-0x5C, 0x2D, 0x00, 0x05, 0xD1, 0xFF, 0xFF, 0xFF, 0xE7, 0xB7, 0xB8, 0xD5, 0xF9, 0xFF, 0x48, 0x00,
-0x00, 0x1D, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x06,
-0x62, 0xB9, 0xE9, 0xFB, 0xF9, 0xE4, 0xB3, 0x5B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x9E, 0xE1,
-0xFA, 0xF2, 0xD9, 0x99, 0x02, 0x00, 0x00, 0x10, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00,
-0x00, 0x00, 0x69, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xF8, 0x6D, 0x00, 0x00, 0x00, 0x95, 0xFF, 0xFF,
-0xFF, 0x2E, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x1A, 0x91, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x98, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x68, 0xB0, 0xE2, 0xFF, 0xFF, 0xFC, 0xB0, 0xB0, 0xB0,
-0x08, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xD8, 0xD8,
+0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC7, 0x09, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xBC, 0x00, 0x05, 0x54, 0xA2, 0xD5, 0xF3, 0xFC, 0xEE, 0xC4, 0x73, 0x09, 0x00, 0x00,
+0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x13, 0x00, 0x19, 0xF6, 0xFF, 0xEC,
+0xC5, 0xB1, 0xE2, 0xFF, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x58, 0x41, 0x02, 0x00, 0x00, 0x06, 0xD0,
+0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFC, 0x00,
+0x02, 0x4F, 0x9C, 0xCA, 0xE3, 0xF2, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0xCB, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xB7, 0x52, 0x30, 0x20, 0x97,
+0xFF, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xD8, 0x02, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xEB,
+0xFF, 0xFF, 0xD2, 0x02, 0x00, 0x00, 0x38, 0xF5, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xFF, 0xCF,
+0xA3, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x88,
+0xFF, 0xFF, 0xFF, 0x00, 0x3B, 0xBA, 0xF2, 0xFA, 0xE6, 0xAC, 0x35, 0x00, 0xC1, 0xFF, 0xFF, 0x24,
+0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF,
+0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x24, 0xFF, 0xFF, 0xFF, 0x63, 0x39, 0xB8, 0xF0, 0xF4, 0xC6, 0x52, 0x00, 0x00, 0x24, 0xFF, 0xFF,
+0xFF, 0x9B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEC, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0x24, 0x24, 0xFF, 0xFF, 0xFF, 0xF1, 0x3C, 0x00, 0x07, 0xA2,
+0xFF, 0xFF, 0xFF, 0x88, 0x24, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0xFF, 0xFF,
+0xC7, 0x24, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xE9, 0x24, 0xFF,
+0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xF4, 0x24, 0xFF, 0xFF, 0xFF, 0x60,
+0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xE8, 0x24, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00,
+0x13, 0xF7, 0xFF, 0xFF, 0xC6, 0x24, 0xFF, 0xFF, 0xFF, 0xF6, 0x50, 0x02, 0x0C, 0xAB, 0xFF, 0xFF,
+0xFF, 0x87, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFB, 0xFF, 0xFF, 0xFF, 0xF8, 0x22, 0x24,
+0xFF, 0xFF, 0xFE, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x24, 0xFF, 0xFF, 0xBF,
+0x00, 0x54, 0xC6, 0xF5, 0xF3, 0xC1, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x12, 0x7F, 0xCC, 0xF0, 0xF8,
+0xDE, 0xB8, 0x61, 0x0A, 0x00, 0x31, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x11, 0x0D,
+0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xAD, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xB2, 0x13,
+0x00, 0x13, 0x65, 0x3C, 0x00, 0xB9, 0xFF, 0xFF, 0xF7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xE2, 0xFF, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xB6, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xC6, 0xFF, 0xFF, 0xF5, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0xFF,
+0xAE, 0x11, 0x00, 0x08, 0x4E, 0xAC, 0x00, 0x1E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFE, 0xEA, 0xFB, 0xFF,
+0xE0, 0x00, 0x00, 0x55, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A,
+0x9C, 0xDD, 0xF7, 0xFB, 0xE6, 0xAD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x64, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF,
+0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 0xFF, 0x34, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x46, 0xBE, 0xF1, 0xF3, 0xC5,
+0x54, 0x4D, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0xFF,
+0xFF, 0xFF, 0x34, 0x1D, 0xF6, 0xFF, 0xFF, 0xFF, 0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34,
+0x7F, 0xFF, 0xFF, 0xFF, 0xB0, 0x10, 0x01, 0x3F, 0xE8, 0xFF, 0xFF, 0xFF, 0x34, 0xBF, 0xFF, 0xFF,
+0xF8, 0x15, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0x34, 0xE1, 0xFF, 0xFF, 0xCB, 0x00, 0x00,
+0x00, 0x00, 0x36, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x26,
+0xFF, 0xFF, 0xFF, 0x34, 0xE2, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0xFF,
+0x34, 0xC2, 0xFF, 0xFF, 0xF3, 0x0F, 0x00, 0x00, 0x00, 0x62, 0xFF, 0xFF, 0xFF, 0x34, 0x83, 0xFF,
+0xFF, 0xFF, 0xA0, 0x06, 0x00, 0x27, 0xDC, 0xFF, 0xFF, 0xFF, 0x34, 0x21, 0xF8, 0xFF, 0xFF, 0xFF,
+0xF7, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x74, 0xFB, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x4D, 0xC4, 0xF4, 0xF3, 0xC0, 0x47, 0x00, 0xB4, 0xFF,
+0xFF, 0x34, 0x00, 0x00, 0x0E, 0x7B, 0xCB, 0xF1, 0xF9, 0xE1, 0xA5, 0x35, 0x00, 0x00, 0x00, 0x00,
+0x28, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x6E, 0x00, 0x00, 0x08, 0xD9, 0xFF, 0xFF,
+0xFC, 0xAE, 0x99, 0xDC, 0xFF, 0xFF, 0xFD, 0x3B, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00,
+0x07, 0xC9, 0xFF, 0xFF, 0xAD, 0x00, 0xB2, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF,
+0xFF, 0xEB, 0x00, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
+0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xDF, 0xFF, 0xFF,
+0xD8, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x03, 0xB5, 0xFF, 0xFF, 0xEB, 0x07, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xFF, 0xFF, 0xFF, 0x9A, 0x07, 0x00, 0x00, 0x00,
+0x0C, 0x5C, 0x2D, 0x00, 0x05, 0xD1, 0xFF, 0xFF, 0xFF, 0xE7, 0xB7, 0xB8, 0xD5, 0xF9, 0xFF, 0x48,
+0x00, 0x00, 0x1D, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00,
+0x06, 0x62, 0xB9, 0xE9, 0xFB, 0xF9, 0xE4, 0xB3, 0x5B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x9E,
+0xE1, 0xFA, 0xF2, 0xD9, 0x99, 0x02, 0x00, 0x00, 0x10, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2,
+0x00, 0x00, 0x00, 0x69, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0xF8, 0x6D, 0x00, 0x00, 0x00, 0x95, 0xFF,
+0xFF, 0xFF, 0x2E, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1A, 0x91, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x98, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x68, 0xB0, 0xE2, 0xFF, 0xFF, 0xFC, 0xB0, 0xB0,
+0xB0, 0x08, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x46, 0xBE, 0xF1, 0xF3, 0xC4, 0x51, 0x00, 0xE5, 0xFF, 0xFF, 0x34, 0x00, 0x63, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0xFF, 0x34, 0x1D, 0xF6, 0xFF, 0xFF, 0xFF, 0xFE,
-0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x7F, 0xFF, 0xFF, 0xFF, 0xAB, 0x0F, 0x02, 0x41, 0xEA,
-0xFF, 0xFF, 0xFF, 0x34, 0xBF, 0xFF, 0xFF, 0xF8, 0x13, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF,
-0x34, 0xE1, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF,
-0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xFF, 0xFF, 0x34, 0xE2, 0xFF, 0xFF, 0xCA, 0x00,
-0x00, 0x00, 0x00, 0x33, 0xFF, 0xFF, 0xFF, 0x34, 0xC1, 0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00, 0x00,
-0x5B, 0xFF, 0xFF, 0xFF, 0x34, 0x82, 0xFF, 0xFF, 0xFF, 0x90, 0x01, 0x00, 0x1A, 0xD3, 0xFF, 0xFF,
-0xFF, 0x34, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0xEF, 0xD9, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00,
-0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA1, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x50, 0xC5,
-0xF5, 0xF2, 0xBE, 0x41, 0x5A, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x6A, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFF,
-0xFF, 0xFF, 0x15, 0x15, 0x6D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF1, 0xFF, 0xFF, 0xD6, 0x00,
-0x24, 0xFF, 0xFF, 0xDD, 0xC2, 0xAA, 0xB9, 0xF6, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x24, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x08, 0x63, 0xA7, 0xD6, 0xE9, 0xFA,
-0xF4, 0xD9, 0x9F, 0x39, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-0xFF, 0xFF, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF,
-0xFF, 0x6B, 0x2C, 0xAC, 0xEA, 0xFA, 0xE4, 0xA2, 0x25, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x94,
-0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x2C, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0A, 0x00, 0x31,
-0xF2, 0xFF, 0xFF, 0xFA, 0x07, 0x18, 0xFF, 0xFF, 0xFF, 0xDB, 0x01, 0x00, 0x00, 0x00, 0x9B, 0xFF,
-0xFF, 0xFF, 0x1B, 0x18, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xFF, 0xFF,
-0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18,
-0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF,
-0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C,
-0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00,
-0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00,
-0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF,
-0xFF, 0xFF, 0x20, 0x0B, 0xBD, 0xF7, 0xD1, 0x21, 0x4F, 0xFF, 0xFF, 0xFF, 0x7B, 0x2F, 0xFE, 0xFF,
-0xFF, 0x57, 0x00, 0x3F, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x46, 0xBE, 0xF1, 0xF3, 0xC4, 0x51, 0x00, 0xE5, 0xFF, 0xFF, 0x34, 0x00, 0x63,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0xFF, 0x34, 0x1D, 0xF6, 0xFF, 0xFF, 0xFF,
+0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x7F, 0xFF, 0xFF, 0xFF, 0xAB, 0x0F, 0x02, 0x41,
+0xEA, 0xFF, 0xFF, 0xFF, 0x34, 0xBF, 0xFF, 0xFF, 0xF8, 0x13, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+0xFF, 0x34, 0xE1, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0xFF, 0xFF, 0x34, 0xEC,
+0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xFF, 0xFF, 0x34, 0xE2, 0xFF, 0xFF, 0xCA,
+0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xFF, 0xFF, 0x34, 0xC1, 0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00,
+0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0x34, 0x82, 0xFF, 0xFF, 0xFF, 0x90, 0x01, 0x00, 0x1A, 0xD3, 0xFF,
+0xFF, 0xFF, 0x34, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0xEF, 0xD9, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x34,
+0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA1, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x50,
+0xC5, 0xF5, 0xF2, 0xBE, 0x41, 0x5A, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+0xFF, 0xFF, 0xFF, 0x15, 0x15, 0x6D, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x27, 0xF1, 0xFF, 0xFF, 0xD6,
+0x00, 0x24, 0xFF, 0xFF, 0xDD, 0xC2, 0xAA, 0xB9, 0xF6, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x24, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x08, 0x63, 0xA7, 0xD6, 0xE9,
+0xFA, 0xF4, 0xD9, 0x9F, 0x39, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x18, 0xFF, 0xFF, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF,
+0xFF, 0xFF, 0x6B, 0x2C, 0xAC, 0xEA, 0xFA, 0xE4, 0xA2, 0x25, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF,
+0x94, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x2C, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x95, 0x0A, 0x00,
+0x31, 0xF2, 0xFF, 0xFF, 0xFA, 0x07, 0x18, 0xFF, 0xFF, 0xFF, 0xDB, 0x01, 0x00, 0x00, 0x00, 0x9B,
+0xFF, 0xFF, 0xFF, 0x1B, 0x18, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x79, 0xFF, 0xFF,
+0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20,
+0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF,
+0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF,
+0x7C, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00,
+0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00,
+0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x74,
+0xFF, 0xFF, 0xFF, 0x20, 0x0B, 0xBD, 0xF7, 0xD1, 0x21, 0x4F, 0xFF, 0xFF, 0xFF, 0x7B, 0x2F, 0xFE,
+0xFF, 0xFF, 0x57, 0x00, 0x3F, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF,
+0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF,
 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60,
 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34,
+0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x0B, 0xBD, 0xF7, 0xD1, 0x21, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x7B, 0x00, 0x00,
+0x00, 0x2F, 0xFE, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x77, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x5E, 0x0B, 0x02,
+0x02, 0x9E, 0xFF, 0xFF, 0xFF, 0x4A, 0x88, 0xF7, 0xF3, 0xFF, 0xFF, 0xFF, 0xF6, 0x11, 0x88, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0x00, 0x67, 0xE7, 0xFB, 0xF3, 0xC3, 0x54, 0x00, 0x00, 0x1C, 0xFF,
+0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF,
+0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x0E, 0xCD, 0xFF, 0xFF,
+0xF6, 0x3D, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x09, 0xC2, 0xFF, 0xFF, 0xFA, 0x4A, 0x00,
+0x1C, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x06, 0xB7, 0xFF, 0xFF, 0xFD, 0x57, 0x00, 0x00, 0x1C, 0xFF,
+0xFF, 0xFF, 0x6F, 0x03, 0xAB, 0xFF, 0xFF, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF,
+0x5E, 0x8C, 0xFF, 0xFF, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xA7, 0xFF,
+0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xF5, 0xFF, 0xFF, 0xD0,
+0x08, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xE0, 0x31, 0x65, 0xFF, 0xFF, 0xFF, 0x9A, 0x00,
+0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00,
+0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x11, 0xE3, 0xFF, 0xFF, 0xF4, 0x28, 0x00, 0x1C, 0xFF,
+0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xFF, 0xD3, 0x0A, 0x1C, 0xFF, 0xFF, 0xFF,
+0x80, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 0x9F, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34,
 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF,
-0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x0B, 0xBD, 0xF7, 0xD1, 0x21, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x7B, 0x00, 0x00, 0x00,
-0x2F, 0xFE, 0xFF, 0xFF, 0x57, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
-0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x5E, 0x0B, 0x02, 0x02,
-0x9E, 0xFF, 0xFF, 0xFF, 0x4A, 0x88, 0xF7, 0xF3, 0xFF, 0xFF, 0xFF, 0xF6, 0x11, 0x88, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x75, 0x00, 0x67, 0xE7, 0xFB, 0xF3, 0xC3, 0x54, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
-0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x0E, 0xCD, 0xFF, 0xFF, 0xF6,
-0x3D, 0x1C, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x09, 0xC2, 0xFF, 0xFF, 0xFA, 0x4A, 0x00, 0x1C,
-0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x06, 0xB7, 0xFF, 0xFF, 0xFD, 0x57, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
-0xFF, 0x6F, 0x03, 0xAB, 0xFF, 0xFF, 0xFF, 0x66, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x5E,
-0x8C, 0xFF, 0xFF, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF,
-0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
-0x25, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xF5, 0xFF, 0xFF, 0xD0, 0x08,
-0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xE0, 0x31, 0x65, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00,
-0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xAC, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x1C,
-0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x11, 0xE3, 0xFF, 0xFF, 0xF4, 0x28, 0x00, 0x1C, 0xFF, 0xFF,
-0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xFF, 0xD3, 0x0A, 0x1C, 0xFF, 0xFF, 0xFF, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xFF, 0x9F, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF,
 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF,
 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF,
 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60,
 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34,
-0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF, 0xFF, 0xFF, 0x60, 0x34, 0xFF,
-0xFF, 0xFF, 0x60, 0x18, 0xFF, 0xFF, 0xC4, 0x00, 0x40, 0xB6, 0xED, 0xF8, 0xDE, 0x95, 0x17, 0x00,
-0x1F, 0x9C, 0xE3, 0xFA, 0xEB, 0xB1, 0x38, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFA, 0x6C, 0xFE, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x46, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x18,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE8, 0xFE,
-0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07, 0x00, 0x67, 0xFF, 0xFF,
-0xFF, 0xFF, 0xBE, 0x15, 0x00, 0x2C, 0xF2, 0xFF, 0xFF, 0xFB, 0x06, 0x18, 0xFF, 0xFF, 0xFF, 0xE1,
-0x02, 0x00, 0x00, 0x01, 0xE9, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF,
-0x17, 0x18, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00,
-0xC8, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF,
-0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF,
-0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC,
-0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00,
-0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18,
-0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00,
-0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF,
-0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C,
-0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF,
-0x1C, 0x18, 0xFF, 0xFF, 0xC4, 0x00, 0x37, 0xAD, 0xE9, 0xFA, 0xE6, 0xA5, 0x28, 0x00, 0x00, 0x18,
-0xFF, 0xFF, 0xFA, 0x68, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0x00, 0x18, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFD, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF,
-0x99, 0x0A, 0x00, 0x2D, 0xF0, 0xFF, 0xFF, 0xFA, 0x07, 0x18, 0xFF, 0xFF, 0xFF, 0xE1, 0x03, 0x00,
-0x00, 0x00, 0x99, 0xFF, 0xFF, 0xFF, 0x1B, 0x18, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-0x79, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF,
-0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF,
-0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18,
-0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF,
-0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88,
-0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00,
-0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x08, 0x6B, 0xBF, 0xEB, 0xF9, 0xE4, 0xB7,
-0x59, 0x02, 0x00, 0x00, 0x00, 0x1E, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x11,
-0x00, 0x04, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x5B, 0xFF,
-0xFF, 0xFF, 0xB2, 0x14, 0x00, 0x19, 0xBD, 0xFF, 0xFF, 0xFF, 0x42, 0xAC, 0xFF, 0xFF, 0xF9, 0x17,
-0x00, 0x00, 0x00, 0x21, 0xFD, 0xFF, 0xFF, 0x9C, 0xD6, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xE2, 0xFF, 0xFF, 0xC4, 0xE2, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0xFF,
-0xFF, 0xDA, 0xCD, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xCC, 0xA2,
-0xFF, 0xFF, 0xFA, 0x19, 0x00, 0x00, 0x00, 0x21, 0xFD, 0xFF, 0xFF, 0x9F, 0x48, 0xFF, 0xFF, 0xFF,
-0xB4, 0x13, 0x00, 0x14, 0xBA, 0xFF, 0xFF, 0xFF, 0x4E, 0x01, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB,
-0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x01, 0x00, 0x14, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xCB, 0x17, 0x00, 0x00, 0x00, 0x03, 0x5E, 0xBA, 0xE6, 0xFA, 0xEC, 0xBD, 0x65, 0x06, 0x00, 0x00,
-0x24, 0xFF, 0xFF, 0xE5, 0x00, 0x3A, 0xB9, 0xF0, 0xF4, 0xC6, 0x53, 0x00, 0x00, 0x24, 0xFF, 0xFF,
-0xFF, 0x76, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xEC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFA, 0x25, 0x24, 0xFF, 0xFF, 0xFF, 0xF1, 0x3C, 0x00, 0x05, 0x93,
-0xFF, 0xFF, 0xFF, 0x8A, 0x24, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x09, 0xF0, 0xFF, 0xFF,
-0xC8, 0x24, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xE9, 0x24, 0xFF,
-0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xF3, 0x24, 0xFF, 0xFF, 0xFF, 0x60,
-0x00, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xE2, 0x24, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x00,
-0x0C, 0xF3, 0xFF, 0xFF, 0xC3, 0x24, 0xFF, 0xFF, 0xFF, 0xF6, 0x50, 0x02, 0x09, 0x9C, 0xFF, 0xFF,
-0xFF, 0x7D, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFA, 0xFF, 0xFF, 0xFF, 0xF4, 0x1A, 0x24,
-0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x61, 0x00, 0x24, 0xFF, 0xFF, 0xFF,
-0x5D, 0x4E, 0xC3, 0xF4, 0xEF, 0xBD, 0x44, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF,
-0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xBF, 0xF2, 0xF2, 0xC0, 0x44, 0x00,
-0xE9, 0xFF, 0xFF, 0x34, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xFF,
-0x34, 0x1C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x7E, 0xFF,
-0xFF, 0xFF, 0xAB, 0x0F, 0x01, 0x3F, 0xE8, 0xFF, 0xFF, 0xFF, 0x34, 0xBF, 0xFF, 0xFF, 0xF8, 0x13,
-0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0x34, 0xE1, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00,
-0x36, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF, 0xFF,
-0xFF, 0x34, 0xE2, 0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x34, 0xC2,
-0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x34, 0x84, 0xFF, 0xFF, 0xFF,
-0x90, 0x01, 0x00, 0x1D, 0xD4, 0xFF, 0xFF, 0xFF, 0x34, 0x22, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0xD8,
-0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x86, 0xFF,
-0xFF, 0xFF, 0x34, 0x00, 0x00, 0x50, 0xC5, 0xF5, 0xF1, 0xB9, 0x39, 0x59, 0xFF, 0xFF, 0xFF, 0x34,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
-0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x1C, 0xFF,
-0xFF, 0xB3, 0x00, 0x15, 0x94, 0xE4, 0xF8, 0x68, 0x1C, 0xFF, 0xFF, 0xEC, 0x1D, 0xE1, 0xFF, 0xFF,
-0xFF, 0x5F, 0x1C, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x1C, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFD, 0xA7, 0x70, 0x63, 0x1B, 0x1C, 0xFF, 0xFF, 0xFF, 0xFD, 0x46, 0x00, 0x00, 0x00, 0x00,
-0x1C, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x87, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
-0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x21, 0x93, 0xD6, 0xF5, 0xFB, 0xEA, 0xC1, 0x7F, 0x23, 0x00, 0x38, 0xF3, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xBB, 0xAE, 0xD2, 0xFE, 0xFF, 0x4D,
-0x00, 0xE6, 0xFF, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x22, 0x76, 0x02, 0x00, 0xC9, 0xFF, 0xFF, 0xFF,
-0xA8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x5C, 0x02,
-0x00, 0x00, 0x00, 0x56, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x18, 0x00, 0x00, 0x00, 0x06,
-0x60, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xE4, 0xFF,
-0xFF, 0xFC, 0x04, 0x7F, 0x39, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFE, 0x05, 0xE4, 0xFF,
-0xE6, 0xB5, 0xA0, 0xB5, 0xFA, 0xFF, 0xFF, 0xC8, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xF2, 0x36, 0x00, 0x54, 0xA9, 0xE0, 0xF7, 0xFD, 0xF2, 0xD0, 0x8D, 0x1E, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xB9, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFB, 0xFF, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x75, 0xF3,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x1C, 0x60, 0xB0, 0xF2, 0xFF, 0xFF, 0xEC, 0xB0, 0xB0, 0xB0, 0x13, 0x00, 0x00, 0xD4, 0xFF, 0xFF,
-0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3,
-0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xEA, 0x12, 0x00, 0x10,
-0x0E, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xF4, 0xE1, 0xFC, 0x40, 0x00, 0x00, 0x33, 0xFC, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x46, 0xC4, 0xF5, 0xF7, 0xE0, 0xA4, 0x1C, 0x2C,
-0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF,
-0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64,
-0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00,
-0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00,
-0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF,
-0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF,
-0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0xFF, 0xFF, 0x10, 0x28,
-0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFE, 0xFF,
-0xFF, 0xE6, 0x23, 0x00, 0x09, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0xC8, 0xFF, 0xFF, 0xFF,
-0xFD, 0xE3, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x3B, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFD, 0x6D, 0xFE, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x31, 0xAC, 0xE9, 0xFB, 0xE8, 0xAB, 0x35,
-0x00, 0xD1, 0xFF, 0xFF, 0x10, 0xCE, 0xFF, 0xFF, 0xF4, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF5,
-0xFF, 0xFF, 0xCD, 0x69, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF,
-0x68, 0x0E, 0xF5, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xF5, 0x0E, 0x00,
-0x9F, 0xFF, 0xFF, 0xFA, 0x12, 0x00, 0x00, 0x13, 0xFA, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x3A, 0xFF,
-0xFF, 0xFF, 0x67, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF,
-0xC0, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFE, 0x1C,
-0x1C, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0xFF, 0xFF, 0x70, 0x71, 0xFF,
-0xFF, 0xF8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xB4, 0xB7, 0xFF, 0xFF, 0xA5,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xFF, 0xDF, 0xE3, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x17, 0xFA, 0xFF, 0xFF, 0xFA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF8, 0x09,
-0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0xFF, 0x9D,
-0x53, 0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xEA, 0x01, 0x00, 0x00,
-0x3C, 0xFF, 0xFF, 0xFF, 0x51, 0x0E, 0xFA, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xF2,
-0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xF9, 0x0C, 0x00, 0xBD, 0xFF, 0xFF, 0xD0, 0x00,
-0x00, 0x6B, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0xCB, 0xFF, 0xFF, 0xB9, 0x00, 0x00,
-0x72, 0xFF, 0xFF, 0xFE, 0x16, 0x00, 0xAF, 0xFF, 0xF7, 0x15, 0xFD, 0xFF, 0xAC, 0x00, 0x14, 0xFD,
-0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x5A, 0x03, 0xEF, 0xFF, 0xC2, 0x00, 0xCF,
-0xFF, 0xEB, 0x01, 0x5A, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0x94, 0x30,
-0xFF, 0xFF, 0x85, 0x00, 0x92, 0xFF, 0xFF, 0x29, 0x9A, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00,
-0x91, 0xFF, 0xFF, 0xC3, 0x61, 0xFF, 0xFF, 0x49, 0x00, 0x56, 0xFF, 0xFF, 0x59, 0xCF, 0xFF, 0xFF,
-0x89, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xEC, 0x8F, 0xFF, 0xFD, 0x0F, 0x00, 0x19, 0xFF,
-0xFF, 0x86, 0xF8, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFF, 0xFF, 0xC6, 0xFF,
-0xCF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xC9, 0xFF, 0xFF, 0xED, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x6C, 0xFF,
-0xFF, 0xFF, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A,
-0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0xFF, 0xFC, 0x11, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF, 0xFF,
-0xBE, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0x54, 0x00, 0xA7, 0xFF, 0xFF, 0xFF, 0x5D,
-0x00, 0x00, 0x59, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x13, 0xE8, 0xFF, 0xFF, 0xE9, 0x11, 0x10,
-0xE8, 0xFF, 0xFF, 0xE7, 0x12, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x9A, 0x9A, 0xFF, 0xFF,
-0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0x9E, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x0E, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x31, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD2,
-0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF, 0xCB, 0x04, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0xFF,
-0x67, 0x68, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x35, 0xFC, 0xFF, 0xFF, 0xC5, 0x01, 0x01,
-0xC6, 0xFF, 0xFF, 0xFA, 0x31, 0x00, 0x07, 0xD5, 0xFF, 0xFF, 0xFA, 0x2C, 0x00, 0x00, 0x2D, 0xFB,
-0xFF, 0xFF, 0xD3, 0x06, 0x8A, 0xFF, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF,
-0xFF, 0x88, 0xCC, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFD, 0xFF, 0xFF, 0xCE,
-0x64, 0xFF, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0x6D, 0x0B, 0xF0,
-0xFF, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xF8, 0x12, 0x00, 0x94, 0xFF, 0xFF,
-0xFF, 0x34, 0x00, 0x00, 0x1B, 0xFE, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0x8B,
-0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xE1, 0x01, 0x00,
-0xC6, 0xFF, 0xFF, 0xE2, 0x02, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0x39, 0x1C, 0xFE, 0xFF,
-0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xFF, 0xFF, 0x8D, 0x6D, 0xFF, 0xFF, 0xFE, 0x22,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xCF, 0xA9, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x24, 0xFE, 0xFF, 0xF6, 0xE4, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE5,
-0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
-0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x74, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x37, 0xE4, 0xFF, 0xFF, 0xF5, 0x12, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x28, 0xF8, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xDF,
-0xF8, 0xEF, 0xBA, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xB6, 0xBC, 0xBC, 0xBC, 0xBC, 0xCA, 0xFF, 0xFF, 0xFF, 0xDB, 0x04,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xF7, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x76, 0xFF, 0xFF, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFB, 0xFF, 0xFF,
-0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xE6, 0xFF, 0xFF, 0xD3, 0x0A, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x03, 0xBD, 0xFF, 0xFF, 0xF3, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF,
-0xFF, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFE, 0xFF, 0xFF, 0x94, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x1D, 0xED, 0xFF, 0xFF, 0xFF, 0xC2, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x31,
-0x58, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x58, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5F, 0xB5, 0xDE,
-0xEE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x01,
-0xEF, 0xFF, 0xFF, 0xFB, 0xBF, 0x08, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF,
-0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x14, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0xFF, 0xFF, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x07, 0x71, 0xA7, 0xFB,
-0xFF, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xDE, 0x78, 0x02, 0x00, 0x00, 0x00,
-0x14, 0xFF, 0xFF, 0xFF, 0xDB, 0x78, 0x03, 0x00, 0x00, 0x00, 0x08, 0x79, 0xB0, 0xFD, 0xFF, 0xFF,
-0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0x04,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
-0xFF, 0xFA, 0xBC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00,
-0x00, 0x00, 0x02, 0x66, 0xBD, 0xE4, 0xF3, 0x0B, 0xC6, 0xF4, 0xBA, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF,
-0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4,
-0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0,
-0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF,
-0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xD0, 0xFF, 0xC4, 0xC9, 0xF8, 0xBD,
-0xC6, 0xE3, 0xC1, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00,
-0x00, 0x00, 0x9D, 0xF3, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF6, 0xFF, 0xFF,
-0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8,
-0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC8, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF,
-0xC7, 0x7E, 0x21, 0x00, 0x00, 0x00, 0x5E, 0xCD, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x52,
-0xC7, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xC1, 0x7C, 0x21, 0x00, 0x00,
-0xAB, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x50, 0x00,
-0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF,
-0x50, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xF5, 0xFF, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x94, 0xEE, 0xFF,
-0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xCA,
-0xE9, 0xC9, 0x7F, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0xA4, 0xB7, 0x96, 0x46, 0x02, 0x00,
-0x00, 0x00, 0x17, 0x3E, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x89, 0x5E, 0x84, 0xEC, 0x6C,
-0xBC, 0xFF, 0xEA, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0xA6, 0x53, 0x01, 0x00,
-0x20, 0x84, 0xE4, 0xFF, 0xFF, 0xFD, 0xA7, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24,
-0x33, 0x13, 0x00, 0x00, 0x00, 0x0E, 0x4E, 0x6F, 0x74, 0x6F, 0x20, 0x53, 0x61, 0x6E, 0x73, 0x20,
-0x42, 0x6F, 0x6C, 0x64, 0x00, 0x0D, 0x4E, 0x6F, 0x74, 0x6F, 0x53, 0x61, 0x6E, 0x73, 0x2D, 0x42,
-0x6F, 0x6C, 0x64, 0x01
+0xFF, 0xFF, 0xFF, 0x60, 0x18, 0xFF, 0xFF, 0xC4, 0x00, 0x40, 0xB6, 0xED, 0xF8, 0xDE, 0x95, 0x17,
+0x00, 0x1F, 0x9C, 0xE3, 0xFA, 0xEB, 0xB1, 0x38, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFA, 0x6C, 0xFE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x46, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE8,
+0xFE, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07, 0x00, 0x67, 0xFF,
+0xFF, 0xFF, 0xFF, 0xBE, 0x15, 0x00, 0x2C, 0xF2, 0xFF, 0xFF, 0xFB, 0x06, 0x18, 0xFF, 0xFF, 0xFF,
+0xE1, 0x02, 0x00, 0x00, 0x01, 0xE9, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF,
+0xFF, 0x17, 0x18, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00,
+0x00, 0xC8, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF,
+0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C,
+0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF,
+0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00,
+0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C,
+0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00,
+0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8,
+0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xFF,
+0x8C, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+0xFF, 0x1C, 0x18, 0xFF, 0xFF, 0xC4, 0x00, 0x37, 0xAD, 0xE9, 0xFA, 0xE6, 0xA5, 0x28, 0x00, 0x00,
+0x18, 0xFF, 0xFF, 0xFA, 0x68, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0x00, 0x18, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x18, 0xFF, 0xFF, 0xFF,
+0xFF, 0x99, 0x0A, 0x00, 0x2D, 0xF0, 0xFF, 0xFF, 0xFA, 0x07, 0x18, 0xFF, 0xFF, 0xFF, 0xE1, 0x03,
+0x00, 0x00, 0x00, 0x99, 0xFF, 0xFF, 0xFF, 0x1B, 0x18, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
+0x00, 0x79, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x74,
+0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF,
+0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20,
+0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF,
+0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF,
+0x88, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x18, 0xFF, 0xFF, 0xFF, 0x88, 0x00,
+0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x08, 0x6B, 0xBF, 0xEB, 0xF9, 0xE4,
+0xB7, 0x59, 0x02, 0x00, 0x00, 0x00, 0x1E, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB,
+0x11, 0x00, 0x04, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x5B,
+0xFF, 0xFF, 0xFF, 0xB2, 0x14, 0x00, 0x19, 0xBD, 0xFF, 0xFF, 0xFF, 0x42, 0xAC, 0xFF, 0xFF, 0xF9,
+0x17, 0x00, 0x00, 0x00, 0x21, 0xFD, 0xFF, 0xFF, 0x9C, 0xD6, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xC4, 0xE2, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE,
+0xFF, 0xFF, 0xDA, 0xCD, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xCC,
+0xA2, 0xFF, 0xFF, 0xFA, 0x19, 0x00, 0x00, 0x00, 0x21, 0xFD, 0xFF, 0xFF, 0x9F, 0x48, 0xFF, 0xFF,
+0xFF, 0xB4, 0x13, 0x00, 0x14, 0xBA, 0xFF, 0xFF, 0xFF, 0x4E, 0x01, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x01, 0x00, 0x14, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xCB, 0x17, 0x00, 0x00, 0x00, 0x03, 0x5E, 0xBA, 0xE6, 0xFA, 0xEC, 0xBD, 0x65, 0x06, 0x00,
+0x00, 0x24, 0xFF, 0xFF, 0xE5, 0x00, 0x3A, 0xB9, 0xF0, 0xF4, 0xC6, 0x53, 0x00, 0x00, 0x24, 0xFF,
+0xFF, 0xFF, 0x76, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xEC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFA, 0x25, 0x24, 0xFF, 0xFF, 0xFF, 0xF1, 0x3C, 0x00, 0x05,
+0x93, 0xFF, 0xFF, 0xFF, 0x8A, 0x24, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x09, 0xF0, 0xFF,
+0xFF, 0xC8, 0x24, 0xFF, 0xFF, 0xFF, 0x61, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xE9, 0x24,
+0xFF, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xF3, 0x24, 0xFF, 0xFF, 0xFF,
+0x60, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xE2, 0x24, 0xFF, 0xFF, 0xFF, 0x95, 0x00, 0x00,
+0x00, 0x0C, 0xF3, 0xFF, 0xFF, 0xC3, 0x24, 0xFF, 0xFF, 0xFF, 0xF6, 0x50, 0x02, 0x09, 0x9C, 0xFF,
+0xFF, 0xFF, 0x7D, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFA, 0xFF, 0xFF, 0xFF, 0xF4, 0x1A,
+0x24, 0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x61, 0x00, 0x24, 0xFF, 0xFF,
+0xFF, 0x5D, 0x4E, 0xC3, 0xF4, 0xEF, 0xBD, 0x44, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x6E, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF,
+0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0xFF, 0xFF, 0x70,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xBF, 0xF2, 0xF2, 0xC0, 0x44,
+0x00, 0xE9, 0xFF, 0xFF, 0x34, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF,
+0xFF, 0x34, 0x1C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFE, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x7E,
+0xFF, 0xFF, 0xFF, 0xAB, 0x0F, 0x01, 0x3F, 0xE8, 0xFF, 0xFF, 0xFF, 0x34, 0xBF, 0xFF, 0xFF, 0xF8,
+0x13, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0x34, 0xE1, 0xFF, 0xFF, 0xCE, 0x00, 0x00, 0x00,
+0x00, 0x36, 0xFF, 0xFF, 0xFF, 0x34, 0xEC, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x25, 0xFF,
+0xFF, 0xFF, 0x34, 0xE2, 0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x34,
+0xC2, 0xFF, 0xFF, 0xF2, 0x0A, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0x34, 0x84, 0xFF, 0xFF,
+0xFF, 0x90, 0x01, 0x00, 0x1D, 0xD4, 0xFF, 0xFF, 0xFF, 0x34, 0x22, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF,
+0xD8, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x86,
+0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x50, 0xC5, 0xF5, 0xF1, 0xB9, 0x39, 0x59, 0xFF, 0xFF, 0xFF,
+0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x34, 0x1C,
+0xFF, 0xFF, 0xB3, 0x00, 0x15, 0x94, 0xE4, 0xF8, 0x68, 0x1C, 0xFF, 0xFF, 0xEC, 0x1D, 0xE1, 0xFF,
+0xFF, 0xFF, 0x5F, 0x1C, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x1C, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFD, 0xA7, 0x70, 0x63, 0x1B, 0x1C, 0xFF, 0xFF, 0xFF, 0xFD, 0x46, 0x00, 0x00, 0x00,
+0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x87,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
+0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x21, 0x93, 0xD6, 0xF5, 0xFB, 0xEA, 0xC1, 0x7F, 0x23, 0x00, 0x38, 0xF3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xBB, 0xAE, 0xD2, 0xFE, 0xFF,
+0x4D, 0x00, 0xE6, 0xFF, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x22, 0x76, 0x02, 0x00, 0xC9, 0xFF, 0xFF,
+0xFF, 0xA8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x5C,
+0x02, 0x00, 0x00, 0x00, 0x56, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x18, 0x00, 0x00, 0x00,
+0x06, 0x60, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xE4,
+0xFF, 0xFF, 0xFC, 0x04, 0x7F, 0x39, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xFE, 0x05, 0xE4,
+0xFF, 0xE6, 0xB5, 0xA0, 0xB5, 0xFA, 0xFF, 0xFF, 0xC8, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF2, 0x36, 0x00, 0x54, 0xA9, 0xE0, 0xF7, 0xFD, 0xF2, 0xD0, 0x8D, 0x1E, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xB9, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFB, 0xFF, 0xC0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x75,
+0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0x1C, 0x60, 0xB0, 0xF2, 0xFF, 0xFF, 0xEC, 0xB0, 0xB0, 0xB0, 0x13, 0x00, 0x00, 0xD4, 0xFF,
+0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xD3, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xEA, 0x12, 0x00,
+0x10, 0x0E, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xF4, 0xE1, 0xFC, 0x40, 0x00, 0x00, 0x33, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x46, 0xC4, 0xF5, 0xF7, 0xE0, 0xA4, 0x1C,
+0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF,
+0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF,
+0x64, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00,
+0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00,
+0x00, 0x88, 0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x88,
+0xFF, 0xFF, 0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF,
+0xFF, 0x10, 0x2C, 0xFF, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFF, 0xFF, 0xFF, 0x10,
+0x28, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xFF, 0xFF, 0xFF, 0x10, 0x10, 0xFE,
+0xFF, 0xFF, 0xE6, 0x23, 0x00, 0x09, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0xC8, 0xFF, 0xFF,
+0xFF, 0xFD, 0xE3, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x3B, 0xF8, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFD, 0x6D, 0xFE, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x31, 0xAC, 0xE9, 0xFB, 0xE8, 0xAB,
+0x35, 0x00, 0xD1, 0xFF, 0xFF, 0x10, 0xCE, 0xFF, 0xFF, 0xF4, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0B,
+0xF5, 0xFF, 0xFF, 0xCD, 0x69, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF,
+0xFF, 0x68, 0x0E, 0xF5, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xF5, 0x0E,
+0x00, 0x9F, 0xFF, 0xFF, 0xFA, 0x12, 0x00, 0x00, 0x13, 0xFA, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x3A,
+0xFF, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0xFF, 0x39, 0x00, 0x00, 0x00, 0xD4, 0xFF,
+0xFF, 0xC0, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFE,
+0x1C, 0x1C, 0xFE, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0xFF, 0xFF, 0x70, 0x71,
+0xFF, 0xFF, 0xF8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xB4, 0xB7, 0xFF, 0xFF,
+0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xFF, 0xDF, 0xE3, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x17, 0xFA, 0xFF, 0xFF, 0xFA, 0x17, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF8,
+0x09, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0xFF,
+0x9D, 0x53, 0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xEA, 0x01, 0x00,
+0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x51, 0x0E, 0xFA, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x27, 0xFF, 0xFF,
+0xF2, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xF9, 0x0C, 0x00, 0xBD, 0xFF, 0xFF, 0xD0,
+0x00, 0x00, 0x6B, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0xCB, 0xFF, 0xFF, 0xB9, 0x00,
+0x00, 0x72, 0xFF, 0xFF, 0xFE, 0x16, 0x00, 0xAF, 0xFF, 0xF7, 0x15, 0xFD, 0xFF, 0xAC, 0x00, 0x14,
+0xFD, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x27, 0xFF, 0xFF, 0xFF, 0x5A, 0x03, 0xEF, 0xFF, 0xC2, 0x00,
+0xCF, 0xFF, 0xEB, 0x01, 0x5A, 0xFF, 0xFF, 0xFF, 0x21, 0x00, 0x00, 0x00, 0xDC, 0xFF, 0xFF, 0x94,
+0x30, 0xFF, 0xFF, 0x85, 0x00, 0x92, 0xFF, 0xFF, 0x29, 0x9A, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00,
+0x00, 0x91, 0xFF, 0xFF, 0xC3, 0x61, 0xFF, 0xFF, 0x49, 0x00, 0x56, 0xFF, 0xFF, 0x59, 0xCF, 0xFF,
+0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x46, 0xFF, 0xFF, 0xEC, 0x8F, 0xFF, 0xFD, 0x0F, 0x00, 0x19,
+0xFF, 0xFF, 0x86, 0xF8, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFF, 0xFF, 0xC6,
+0xFF, 0xCF, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xC9, 0xFF, 0xFF, 0xED, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x6C,
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
+0x1A, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0xFF, 0xFC, 0x11, 0x00, 0x00, 0x00, 0x53, 0xFF, 0xFF,
+0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xFF, 0xFF, 0x54, 0x00, 0xA7, 0xFF, 0xFF, 0xFF,
+0x5D, 0x00, 0x00, 0x59, 0xFF, 0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x13, 0xE8, 0xFF, 0xFF, 0xE9, 0x11,
+0x10, 0xE8, 0xFF, 0xFF, 0xE7, 0x12, 0x00, 0x00, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x9A, 0x9A, 0xFF,
+0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0x9E,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x0E, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x31, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+0xD2, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF, 0xCB, 0x04, 0x00, 0x00, 0x00, 0x00, 0x85, 0xFF, 0xFF,
+0xFF, 0x67, 0x68, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x35, 0xFC, 0xFF, 0xFF, 0xC5, 0x01,
+0x01, 0xC6, 0xFF, 0xFF, 0xFA, 0x31, 0x00, 0x07, 0xD5, 0xFF, 0xFF, 0xFA, 0x2C, 0x00, 0x00, 0x2D,
+0xFB, 0xFF, 0xFF, 0xD3, 0x06, 0x8A, 0xFF, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF,
+0xFF, 0xFF, 0x88, 0xCC, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFD, 0xFF, 0xFF,
+0xCE, 0x64, 0xFF, 0xFF, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0x6D, 0x0B,
+0xF0, 0xFF, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xF8, 0x12, 0x00, 0x94, 0xFF,
+0xFF, 0xFF, 0x34, 0x00, 0x00, 0x1B, 0xFE, 0xFF, 0xFF, 0xA9, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF,
+0x8B, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x47, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xE1, 0x01,
+0x00, 0xC6, 0xFF, 0xFF, 0xE2, 0x02, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0x39, 0x1C, 0xFE,
+0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xFF, 0xFF, 0x8D, 0x6D, 0xFF, 0xFF, 0xFE,
+0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0xCF, 0xA9, 0xFF, 0xFF, 0xBF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x24, 0xFE, 0xFF, 0xF6, 0xE4, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+0xE5, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x74,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x37, 0xE4, 0xFF, 0xFF, 0xF5, 0x12, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x28, 0xF8, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x28, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+0xDF, 0xF8, 0xEF, 0xBA, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x4E,
+0x6F, 0x74, 0x6F, 0x20, 0x53, 0x61, 0x6E, 0x73, 0x20, 0x42, 0x6F, 0x6C, 0x64, 0x00, 0x0D, 0x4E,
+0x6F, 0x74, 0x6F, 0x53, 0x61, 0x6E, 0x73, 0x2D, 0x42, 0x6F, 0x6C, 0x64, 0x01
 };
\ No newline at end of file
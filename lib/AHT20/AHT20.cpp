@@ -0,0 +1,124 @@
+#include <Arduino.h>
+#include "AHT20.h"
+
+AHT20::AHT20(TwoWire &wire) : _wire(wire) {
+  _address = AHT20_ADDRESS;
+  _aht10 = false;
+  _state = AHT20_IDLE;
+  _due = 0;
+  _humidity = 0;
+  _temperature = 0;
+}
+
+// Resets the sensor, loads its calibration and works out which part is
+// fitted; this is the only call that waits. The AHT20 takes 0xBE to
+// initialize, the AHT10 NACKs it and takes 0xE1. A part that ACKs 0xBE
+// is an AHT20 however long it stays busy, so its CRC is always checked.
+bool AHT20::begin(uint8_t address) {
+  uint32_t start;
+  uint8_t value;
+  _address = address;
+  _aht10 = false;
+  _state = AHT20_IDLE;
+  _wire.begin();
+  _wire.beginTransmission(_address);
+  _wire.write(0xBA);
+  if (_wire.endTransmission() != 0) return false;
+  delay(AHT20_RESET_TIME);
+  if (command(0xBE, 0x08, 0x00)) {
+    start = millis();
+    delay(10);
+    while ((value = status()) & AHT20_STATUS_BUSY) {
+      if (millis() - start > AHT20_CONVERSION) return false;
+      delay(AHT20_POLL);
+    }
+    return value & AHT20_STATUS_CALIBRATED;
+  }
+  if (!command(0xE1, 0x08, 0x00)) return false;
+  delay(10);
+  _aht10 = true;
+  return status() & AHT20_STATUS_CALIBRATED;
+}
+
+// Whether begin() found an AHT10, whose frames carry no CRC
+bool AHT20::aht10() {
+  return _aht10;
+}
+
+// Starts a measurement, abandoning one still in progress
+bool AHT20::trigger() {
+  if (!command(0xAC, 0x33, 0x00)) {
+    _state = AHT20_ERROR;
+    return false;
+  }
+  _due = millis() + AHT20_CONVERSION;
+  _state = AHT20_MEASURING;
+  return true;
+}
+
+// Returns true once, when the measurement started last has been read.
+// Before the conversion time is up this does not touch the bus.
+bool AHT20::poll() {
+  uint8_t data[7];
+  uint8_t length = _aht10 ? 6 : 7;
+  uint32_t raw;
+  uint32_t now = millis();
+  if (_state != AHT20_MEASURING || (int32_t)(now - _due) < 0) return false;
+  if (_wire.requestFrom(_address, length) != length) {
+    _state = AHT20_ERROR;
+    return false;
+  }
+  for (uint8_t i = 0; i < length; i++) data[i] = _wire.read();
+  if (data[0] & AHT20_STATUS_BUSY) {
+    _due = now + AHT20_POLL;
+    return false;
+  }
+  // An uncalibrated sensor or a corrupted frame gives meaningless values
+  if (!(data[0] & AHT20_STATUS_CALIBRATED) || (!_aht10 && crc(data, 6) != data[6])) {
+    _state = AHT20_ERROR;
+    return false;
+  }
+  raw = ((uint32_t)data[1] << 12) | ((uint32_t)data[2] << 4) | (data[3] >> 4);
+  _humidity = raw * 100.0F / 1048576;
+  raw = ((uint32_t)(data[3] & 0x0F) << 16) | ((uint32_t)data[4] << 8) | data[5];
+  _temperature = raw * 200.0F / 1048576 - 50;
+  _state = AHT20_READY;
+  return true;
+}
+
+uint8_t AHT20::state() {
+  return _state;
+}
+
+float AHT20::humidity() {
+  return _humidity;
+}
+
+float AHT20::temperature() {
+  return _temperature;
+}
+
+bool AHT20::command(uint8_t code, uint8_t a, uint8_t b) {
+  _wire.beginTransmission(_address);
+  _wire.write(code);
+  _wire.write(a);
+  _wire.write(b);
+  return _wire.endTransmission() == 0;
+}
+
+uint8_t AHT20::status() {
+  if (_wire.requestFrom(_address, (uint8_t)1) != 1) return 0;
+  return _wire.read();
+}
+
+// CRC-8, polynomial 0x31, initial value 0xFF
+uint8_t AHT20::crc(const uint8_t *data, uint8_t length) {
+  uint8_t value = 0xFF;
+  for (uint8_t i = 0; i < length; i++) {
+    value ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      value = value & 0x80 ? (value << 1) ^ 0x31 : value << 1;
+    }
+  }
+  return value;
+}
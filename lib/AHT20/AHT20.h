@@ -0,0 +1,49 @@
+#ifndef AHT20_h
+#define AHT20_h
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define AHT20_ADDRESS 0x38
+
+#define AHT20_IDLE      0
+#define AHT20_MEASURING 1
+#define AHT20_READY     2
+#define AHT20_ERROR     3
+
+#define AHT20_CONVERSION 80   // ms, datasheet maximum
+#define AHT20_POLL       2    // ms between status polls once the conversion is due
+#define AHT20_RESET_TIME 20   // ms after a soft reset before the sensor answers
+
+#define AHT20_STATUS_BUSY       0x80
+#define AHT20_STATUS_CALIBRATED 0x08
+
+// AHT10/AHT20 humidity and temperature sensor without blocking waits:
+// trigger() starts a measurement and returns, poll() is called from later
+// loop passes and collects the result once the conversion time is up.
+// begin() tells the two parts apart; the AHT20's CRC-8 is checked on
+// every frame, the AHT10 sends none.
+class AHT20 {
+  public:
+    AHT20(TwoWire &wire = Wire);
+    bool begin(uint8_t address = AHT20_ADDRESS);
+    bool aht10();
+    bool trigger();
+    bool poll();
+    uint8_t state();
+    float humidity();
+    float temperature();
+  private:
+    bool command(uint8_t code, uint8_t a, uint8_t b);
+    uint8_t status();
+    static uint8_t crc(const uint8_t *data, uint8_t length);
+    TwoWire &_wire;
+    uint8_t _address;
+    bool _aht10;
+    uint8_t _state;
+    uint32_t _due;
+    float _humidity;
+    float _temperature;
+};
+
+#endif
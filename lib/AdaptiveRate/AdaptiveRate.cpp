@@ -0,0 +1,45 @@
+#include <Arduino.h>
+#include "AdaptiveRate.h"
+
+AdaptiveRate::AdaptiveRate() {
+  _minimum = _maximum = _interval = 0;
+  _activity = 0;
+  _primed = false;
+}
+
+// Also forgets the last sample, so the next one only sets the baseline
+void AdaptiveRate::configure(uint32_t minimum, uint32_t maximum, uint32_t initial) {
+  _minimum = minimum;
+  _maximum = max(minimum, maximum);
+  _interval = constrain(initial, _minimum, _maximum);
+  _activity = 0;
+  _primed = false;
+}
+
+// Takes one sample and returns the interval until the next
+uint32_t AdaptiveRate::update(const float *values, const float *thresholds, uint8_t count) {
+  count = min(count, (uint8_t)ADAPTIVE_CHANNELS);
+  if (_primed) {
+    _activity = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      if (thresholds[i] > 0) _activity = max(_activity, fabsf(values[i] - _previous[i]) / thresholds[i]);
+    }
+    if (_activity >= ADAPTIVE_FAST) {
+      _interval = max(_interval / 2, _minimum);
+    } else if (_activity < ADAPTIVE_STABLE) {
+      _interval = min(_interval + _interval / 2, _maximum);
+    }
+  }
+  for (uint8_t i = 0; i < count; i++) _previous[i] = values[i];
+  _primed = true;
+  return _interval;
+}
+
+uint32_t AdaptiveRate::interval() {
+  return _interval;
+}
+
+// Largest step of the last sample, in thresholds
+float AdaptiveRate::activity() {
+  return _activity;
+}
@@ -0,0 +1,33 @@
+#ifndef ADAPTIVERATE_h
+#define ADAPTIVERATE_h
+
+#include <Arduino.h>
+
+#define ADAPTIVE_CHANNELS 4
+
+#define ADAPTIVE_FAST   1.0f    // Step, in thresholds, that halves the interval
+#define ADAPTIVE_STABLE 0.25f   // Step below which the interval grows by half
+
+// Sampling interval that follows the signal. Each sample is compared with
+// the previous one, channel by channel, in units of that channel's
+// threshold: a step of a whole threshold halves the interval, a step under
+// a quarter of one stretches it by half, within [minimum, maximum]. With
+// the publishing deadbands as thresholds this settles where the signal
+// moves about one deadband per sample.
+class AdaptiveRate {
+  public:
+    AdaptiveRate();
+    void configure(uint32_t minimum, uint32_t maximum, uint32_t initial);
+    uint32_t update(const float *values, const float *thresholds, uint8_t count);
+    uint32_t interval();
+    float activity();
+  private:
+    uint32_t _minimum;
+    uint32_t _maximum;
+    uint32_t _interval;
+    float _activity;
+    float _previous[ADAPTIVE_CHANNELS];
+    bool _primed;
+};
+
+#endif
@@ -0,0 +1,156 @@
+#include <Arduino.h>
+#include "BMP280.h"
+
+BMP280::BMP280(TwoWire *wire) {
+  _wire = wire;
+  _address = BMP280_ADDRESS;
+  _id = 0;
+  _control = 0;
+  _conversion = 0;
+  _t1 = _p1 = 0;
+  _t2 = _t3 = 0;
+  _p2 = _p3 = _p4 = _p5 = _p6 = _p7 = _p8 = _p9 = 0;
+  _temperature = 0;
+  _pressure = 0;
+}
+
+bool BMP280::begin(uint8_t addr, uint8_t chipid) {
+  uint8_t trim[24];
+  _address = addr;
+  _wire->begin();
+  if (!readRegisters(BMP280_REG_CHIPID, &_id, 1) || _id != chipid) return false;
+  // The trim words are little-endian, T1..T3 then P1..P9
+  if (!readRegisters(BMP280_REG_CALIB, trim, sizeof(trim))) return false;
+  _t1 = trim[0] | (trim[1] << 8);
+  _t2 = trim[2] | (trim[3] << 8);
+  _t3 = trim[4] | (trim[5] << 8);
+  _p1 = trim[6] | (trim[7] << 8);
+  _p2 = trim[8] | (trim[9] << 8);
+  _p3 = trim[10] | (trim[11] << 8);
+  _p4 = trim[12] | (trim[13] << 8);
+  _p5 = trim[14] | (trim[15] << 8);
+  _p6 = trim[16] | (trim[17] << 8);
+  _p7 = trim[18] | (trim[19] << 8);
+  _p8 = trim[20] | (trim[21] << 8);
+  _p9 = trim[22] | (trim[23] << 8);
+  setSampling();
+  return true;
+}
+
+uint8_t BMP280::sensorID() {
+  return _id;
+}
+
+// In forced mode this also starts a first measurement, as on the Adafruit driver
+void BMP280::setSampling(sensor_mode mode, sensor_sampling tempSampling, sensor_sampling pressSampling,
+                         sensor_filter filter, standby_duration duration) {
+  uint32_t t = tempSampling ? 1 << (tempSampling - 1) : 0;
+  uint32_t p = pressSampling ? 1 << (pressSampling - 1) : 0;
+  _control = (tempSampling << 5) | (pressSampling << 2) | mode;
+  // Datasheet maximum measurement time, rounded up to whole milliseconds
+  _conversion = (1250 + 2300 * t + (p ? 2300 * p + 575 : 0) + 999) / 1000;
+  writeRegister(BMP280_REG_CONFIG, (duration << 5) | (filter << 2));
+  writeRegister(BMP280_REG_CTRL, _control);
+}
+
+// Worst-case time from trigger() until read() has fresh data, in ms
+uint8_t BMP280::conversionTime() {
+  return _conversion;
+}
+
+// Starts one forced-mode conversion and returns
+void BMP280::trigger() {
+  writeRegister(BMP280_REG_CTRL, (_control & ~0x03) | MODE_FORCED);
+}
+
+bool BMP280::busy() {
+  uint8_t status;
+  if (!readRegisters(BMP280_REG_STATUS, &status, 1)) return false;
+  return status & 0x08;
+}
+
+bool BMP280::takeForcedMeasurement() {
+  uint32_t start = millis();
+  if ((_control & 0x03) != MODE_FORCED) return false;
+  trigger();
+  while (busy()) {
+    if (millis() - start > 4 * (uint32_t)_conversion) return false;
+    delay(1);
+  }
+  return true;
+}
+
+// Burst-reads the last conversion and compensates it
+bool BMP280::read() {
+  uint8_t data[6];
+  int32_t adcP, adcT, var1, var2, tFine;
+  int64_t pvar1, pvar2, p;
+  if (!readRegisters(BMP280_REG_DATA, data, sizeof(data))) return false;
+  adcP = ((uint32_t)data[0] << 12) | ((uint32_t)data[1] << 4) | (data[2] >> 4);
+  adcT = ((uint32_t)data[3] << 12) | ((uint32_t)data[4] << 4) | (data[5] >> 4);
+  if (adcT == BMP280_SKIPPED) return false;
+  // Temperature in 0.01 °C; tFine carries it into the pressure formula
+  var1 = ((((adcT >> 3) - ((int32_t)_t1 << 1))) * (int32_t)_t2) >> 11;
+  var2 = (((((adcT >> 4) - (int32_t)_t1) * ((adcT >> 4) - (int32_t)_t1)) >> 12) * (int32_t)_t3) >> 14;
+  tFine = var1 + var2;
+  _temperature = (tFine * 5 + 128) >> 8;
+  if (adcP == BMP280_SKIPPED) return false;
+  // Pressure in Pa as Q24.8
+  pvar1 = (int64_t)tFine - 128000;
+  pvar2 = pvar1 * pvar1 * (int64_t)_p6;
+  pvar2 = pvar2 + ((pvar1 * (int64_t)_p5) << 17);
+  pvar2 = pvar2 + ((int64_t)_p4 << 35);
+  pvar1 = ((pvar1 * pvar1 * (int64_t)_p3) >> 8) + ((pvar1 * (int64_t)_p2) << 12);
+  pvar1 = ((((int64_t)1 << 47) + pvar1) * (int64_t)_p1) >> 33;
+  if (pvar1 == 0) return false;
+  p = 1048576 - adcP;
+  p = (((p << 31) - pvar2) * 3125) / pvar1;
+  pvar1 = ((int64_t)_p9 * (p >> 13) * (p >> 13)) >> 25;
+  pvar2 = ((int64_t)_p8 * p) >> 19;
+  _pressure = (uint32_t)(((p + pvar1 + pvar2) >> 8) + ((int64_t)_p7 << 4));
+  return true;
+}
+
+// Last read() temperature, in 0.01 °C
+int32_t BMP280::temperature() {
+  return _temperature;
+}
+
+// Last read() pressure, in 1/256 Pa
+uint32_t BMP280::pressure() {
+  return _pressure;
+}
+
+float BMP280::readTemperature() {
+  if (!read()) return NAN;
+  return _temperature / 100.0F;
+}
+
+// Pa, like Adafruit_BMP280::readPressure()
+float BMP280::readPressure() {
+  if (!read()) return NAN;
+  return _pressure / 256.0F;
+}
+
+// One burst for both channels, where the Adafruit driver reads temperature
+// and pressure separately
+float BMP280::readAltitude(float seaLevelhPa) {
+  float pressure = readPressure() / 100.0F;
+  return 44330.0F * (1.0F - powf(pressure / seaLevelhPa, 0.1903F));
+}
+
+bool BMP280::readRegisters(uint8_t reg, uint8_t *data, uint8_t length) {
+  _wire->beginTransmission(_address);
+  _wire->write(reg);
+  if (_wire->endTransmission(false) != 0) return false;
+  if (_wire->requestFrom(_address, length) != length) return false;
+  for (uint8_t i = 0; i < length; i++) data[i] = _wire->read();
+  return true;
+}
+
+void BMP280::writeRegister(uint8_t reg, uint8_t value) {
+  _wire->beginTransmission(_address);
+  _wire->write(reg);
+  _wire->write(value);
+  _wire->endTransmission();
+}
@@ -0,0 +1,63 @@
+#ifndef BMP280_h
+#define BMP280_h
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define BMP280_ADDRESS (0x77)
+#define BMP280_CHIPID  (0x58)
+
+#define BMP280_REG_CALIB  0x88
+#define BMP280_REG_CHIPID 0xD0
+#define BMP280_REG_STATUS 0xF3
+#define BMP280_REG_CTRL   0xF4
+#define BMP280_REG_CONFIG 0xF5
+#define BMP280_REG_DATA   0xF7   // Pressure then temperature, 3 bytes each
+
+#define BMP280_SKIPPED 0x80000   // Raw value of a channel with oversampling off
+
+// BMP280 on I2C, with the subset of the Adafruit_BMP280 interface the
+// firmware used. The calibration trim is read once in begin(); read()
+// fetches pressure and temperature in a single 6-byte burst and runs
+// Bosch's integer compensation (32-bit temperature, 64-bit pressure), so
+// a sample costs one bus transaction and no float maths.
+class BMP280 {
+  public:
+    enum sensor_sampling { SAMPLING_NONE, SAMPLING_X1, SAMPLING_X2, SAMPLING_X4, SAMPLING_X8, SAMPLING_X16 };
+    enum sensor_mode { MODE_SLEEP = 0x00, MODE_FORCED = 0x01, MODE_NORMAL = 0x03 };
+    enum sensor_filter { FILTER_OFF, FILTER_X2, FILTER_X4, FILTER_X8, FILTER_X16 };
+    enum standby_duration { STANDBY_MS_1, STANDBY_MS_63, STANDBY_MS_125, STANDBY_MS_250, STANDBY_MS_500,
+                            STANDBY_MS_1000, STANDBY_MS_2000, STANDBY_MS_4000 };
+    BMP280(TwoWire *wire = &Wire);
+    bool begin(uint8_t addr = BMP280_ADDRESS, uint8_t chipid = BMP280_CHIPID);
+    uint8_t sensorID();
+    void setSampling(sensor_mode mode = MODE_NORMAL, sensor_sampling tempSampling = SAMPLING_X16,
+                     sensor_sampling pressSampling = SAMPLING_X16, sensor_filter filter = FILTER_OFF,
+                     standby_duration duration = STANDBY_MS_1);
+    uint8_t conversionTime();
+    void trigger();
+    bool busy();
+    bool takeForcedMeasurement();
+    bool read();
+    int32_t temperature();
+    uint32_t pressure();
+    float readTemperature();
+    float readPressure();
+    float readAltitude(float seaLevelhPa = 1013.25);
+  private:
+    bool readRegisters(uint8_t reg, uint8_t *data, uint8_t length);
+    void writeRegister(uint8_t reg, uint8_t value);
+    TwoWire *_wire;
+    uint8_t _address;
+    uint8_t _id;
+    uint8_t _control;
+    uint8_t _conversion;
+    uint16_t _t1;
+    int16_t _t2, _t3;
+    uint16_t _p1;
+    int16_t _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9;
+    int32_t _temperature;
+    uint32_t _pressure;
+};
+
+#endif
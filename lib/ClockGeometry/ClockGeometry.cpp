@@ -0,0 +1,53 @@
+#include <Arduino.h>
+#include "ClockGeometry.h"
+
+// Quarter-wave sine, one Q15 entry per tenth of a degree (0-90 inclusive)
+struct SineTable {
+  int16_t value[CLOCK_QUARTER + 1];
+  constexpr SineTable() : value() {
+    for (int i = 0; i <= CLOCK_QUARTER; i++) {
+      // Taylor series, exact to well below one Q15 step over [0, pi/2]
+      double x = i * 3.14159265358979323846 / (2 * CLOCK_QUARTER);
+      double term = x, sum = x;
+      for (int n = 1; n < 12; n++) {
+        term = -term * x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+      }
+      value[i] = (int16_t)(sum * 32767.0 + 0.5);
+    }
+  }
+};
+
+static constexpr SineTable sine_table PROGMEM = SineTable();
+
+ClockGeometry::ClockGeometry(int16_t x, int16_t y, int16_t outer, int16_t inner) {
+  for (uint8_t i = 0; i < CLOCK_TICKS; i++) {
+    int32_t angle = (int32_t)i * CLOCK_TURN / CLOCK_TICKS;
+    point(angle, outer, x, y, _ticks[i].x0, _ticks[i].y0);
+    point(angle, inner, x, y, _ticks[i].x1, _ticks[i].y1);
+  }
+}
+
+int16_t ClockGeometry::sine(int32_t angle) {
+  angle %= CLOCK_TURN;
+  if (angle < 0) angle += CLOCK_TURN;
+  bool negative = angle >= CLOCK_TURN / 2;
+  if (negative) angle -= CLOCK_TURN / 2;
+  if (angle > CLOCK_QUARTER) angle = CLOCK_TURN / 2 - angle;
+  int16_t value = pgm_read_word(&sine_table.value[angle]);
+  return negative ? -value : value;
+}
+
+int16_t ClockGeometry::cosine(int32_t angle) {
+  return sine(angle + CLOCK_QUARTER);
+}
+
+void ClockGeometry::point(int32_t angle, int16_t radius, int16_t x, int16_t y, int16_t &px, int16_t &py) {
+  // Round to the nearest pixel; the shift is an arithmetic floor division
+  px = x + (((int32_t)sine(angle) * radius + 16384) >> 15);
+  py = y - (((int32_t)cosine(angle) * radius + 16384) >> 15);
+}
+
+const Segment &ClockGeometry::tick(uint8_t index) const {
+  return _ticks[index];
+}
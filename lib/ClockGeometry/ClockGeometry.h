@@ -0,0 +1,29 @@
+#ifndef CLOCKGEOMETRY_h
+#define CLOCKGEOMETRY_h
+
+#include <Arduino.h>
+
+// Angles are in tenths of a degree, clockwise from 12 o'clock
+#define CLOCK_TURN    3600
+#define CLOCK_QUARTER 900
+#define CLOCK_TICKS   12
+
+struct Segment {
+  int16_t x0, y0, x1, y1;
+};
+
+// Integer clock-face geometry backed by a compile-time Q15 sine table,
+// so neither the hands nor the tick marks need soft-float trig. The tick
+// marks are laid out once, when the face is constructed.
+class ClockGeometry {
+  public:
+    ClockGeometry(int16_t x, int16_t y, int16_t outer, int16_t inner);
+    static int16_t sine(int32_t angle);
+    static int16_t cosine(int32_t angle);
+    static void point(int32_t angle, int16_t radius, int16_t x, int16_t y, int16_t &px, int16_t &py);
+    const Segment &tick(uint8_t index) const;
+  private:
+    Segment _ticks[CLOCK_TICKS];
+};
+
+#endif
@@ -0,0 +1,65 @@
+#include <Arduino.h>
+#include "Deadband.h"
+
+Deadband::Deadband() {
+  for (int i = 0; i < DEADBAND_CHANNELS; i++) {
+    _channels[i].band = 0;
+    _channels[i].heartbeat = 0;
+  }
+  _reported = 0;
+  _suppressed = 0;
+  reset();
+}
+
+void Deadband::configure(uint8_t channel, float band, uint32_t heartbeat) {
+  if (channel >= DEADBAND_CHANNELS) return;
+  _channels[channel].band = max(band, 0.0f);
+  _channels[channel].heartbeat = heartbeat;
+}
+
+float Deadband::band(uint8_t channel) {
+  return channel < DEADBAND_CHANNELS ? _channels[channel].band : 0;
+}
+
+uint32_t Deadband::heartbeat(uint8_t channel) {
+  return channel < DEADBAND_CHANNELS ? _channels[channel].heartbeat : 0;
+}
+
+bool Deadband::due(uint8_t channel, float value, uint32_t now) {
+  if (channel >= DEADBAND_CHANNELS) return true;
+  Channel &c = _channels[channel];
+  return !c.sent || c.band <= 0 || fabsf(value - c.last) > c.band ||
+         (c.heartbeat && now - c.time >= c.heartbeat);
+}
+
+void Deadband::sent(uint8_t channel, float value, uint32_t now) {
+  if (channel >= DEADBAND_CHANNELS) return;
+  _channels[channel].last = value;
+  _channels[channel].time = now;
+  _channels[channel].sent = true;
+  _reported++;
+}
+
+// Counts a value that was not due and went unreported. Left to the
+// caller, since a value can still go out with others that were due.
+void Deadband::suppress(uint8_t channel) {
+  if (channel >= DEADBAND_CHANNELS) return;
+  _suppressed++;
+}
+
+// Forgets what was reported, so every channel is due on its next value
+void Deadband::reset() {
+  for (int i = 0; i < DEADBAND_CHANNELS; i++) {
+    _channels[i].last = 0;
+    _channels[i].time = 0;
+    _channels[i].sent = false;
+  }
+}
+
+uint32_t Deadband::reported() {
+  return _reported;
+}
+
+uint32_t Deadband::suppressed() {
+  return _suppressed;
+}
@@ -0,0 +1,37 @@
+#ifndef DEADBAND_h
+#define DEADBAND_h
+
+#include <Arduino.h>
+
+#define DEADBAND_CHANNELS 8
+
+// Report-by-exception filter. A channel is due when its value has moved by
+// more than its band since it was last reported, or when it has been silent
+// for its heartbeat interval. A band of 0 reports every value; a heartbeat
+// of 0 never forces a report.
+class Deadband {
+  public:
+    Deadband();
+    void configure(uint8_t channel, float band, uint32_t heartbeat);
+    float band(uint8_t channel);
+    uint32_t heartbeat(uint8_t channel);
+    bool due(uint8_t channel, float value, uint32_t now);
+    void sent(uint8_t channel, float value, uint32_t now);
+    void suppress(uint8_t channel);
+    void reset();
+    uint32_t reported();
+    uint32_t suppressed();
+  private:
+    struct Channel {
+      float band;
+      uint32_t heartbeat;
+      float last;
+      uint32_t time;
+      bool sent;
+    };
+    Channel _channels[DEADBAND_CHANNELS];
+    uint32_t _reported;
+    uint32_t _suppressed;
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include <Arduino.h>
+#include "FontManager.h"
+
+FontManager::FontManager(TFT_eSPI &lcd) : _lcd(lcd) {
+  memset(_fonts, 0, sizeof(_fonts));
+  _current = -1;
+}
+
+bool FontManager::load(uint8_t id, const uint8_t *font) {
+  if (id >= FONT_SLOTS || _fonts[id].unicode) return false;
+  release();
+  _lcd.loadFont(font);
+  if (!_lcd.fontLoaded) return false;
+  Font &f = _fonts[id];
+  f.metrics = _lcd.gFont;
+  f.unicode = _lcd.gUnicode;
+  f.height = _lcd.gHeight;
+  f.width = _lcd.gWidth;
+  f.xAdvance = _lcd.gxAdvance;
+  f.dY = _lcd.gdY;
+  f.dX = _lcd.gdX;
+  f.bitmap = _lcd.gBitmap;
+  detach();
+  return true;
+}
+
+void FontManager::select(uint8_t id) {
+  if (id >= FONT_SLOTS || id == _current || !_fonts[id].unicode) return;
+  const Font &f = _fonts[id];
+  _lcd.gFont = f.metrics;
+  _lcd.gUnicode = f.unicode;
+  _lcd.gHeight = f.height;
+  _lcd.gWidth = f.width;
+  _lcd.gxAdvance = f.xAdvance;
+  _lcd.gdY = f.dY;
+  _lcd.gdX = f.dX;
+  _lcd.gBitmap = f.bitmap;
+  _lcd.fontLoaded = true;
+  _current = id;
+}
+
+void FontManager::release() {
+  if (_current < 0) return;
+  detach();
+}
+
+// Hand the metric tables back to us so unloadFont() can never free them
+void FontManager::detach() {
+  _lcd.gUnicode = NULL;
+  _lcd.gHeight = NULL;
+  _lcd.gWidth = NULL;
+  _lcd.gxAdvance = NULL;
+  _lcd.gdY = NULL;
+  _lcd.gdX = NULL;
+  _lcd.gBitmap = NULL;
+  _lcd.fontLoaded = false;
+  _current = -1;
+}
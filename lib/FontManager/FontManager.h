@@ -0,0 +1,35 @@
+#ifndef FONTMANAGER_h
+#define FONTMANAGER_h
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define FONT_SLOTS 4
+
+// Keeps the glyph metrics of each smooth font resident after parsing it
+// once, and swaps them into the TFT_eSPI instance on demand. Fonts loaded
+// here must not be released with lcd.unloadFont().
+class FontManager {
+  public:
+    FontManager(TFT_eSPI &lcd);
+    bool load(uint8_t id, const uint8_t *font);
+    void select(uint8_t id);
+    void release();
+  private:
+    struct Font {
+      TFT_eSPI::fontMetrics metrics;
+      uint16_t *unicode;
+      uint8_t *height;
+      uint8_t *width;
+      uint8_t *xAdvance;
+      int16_t *dY;
+      int8_t *dX;
+      uint32_t *bitmap;
+    };
+    void detach();
+    TFT_eSPI &_lcd;
+    Font _fonts[FONT_SLOTS];
+    int8_t _current;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include <Arduino.h>
+#include "GlyphAtlas.h"
+
+GlyphAtlas::GlyphAtlas(TFT_eSPI &lcd, const AtlasGlyph *glyphs, uint8_t count, const uint8_t *spans, uint8_t ascent) : _lcd(lcd) {
+  _glyphs = glyphs;
+  _count = count;
+  _spans = spans;
+  _ascent = ascent;
+}
+
+bool GlyphAtlas::find(char c, AtlasGlyph &glyph) {
+  for (uint8_t i = 0; i < _count; i++) {
+    memcpy_P(&glyph, &_glyphs[i], sizeof(AtlasGlyph));
+    if (glyph.code == (uint8_t)c) return true;
+  }
+  return false;
+}
+
+int16_t GlyphAtlas::textWidth(const char *text) {
+  AtlasGlyph glyph;
+  int16_t width = 0;
+  while (*text) {
+    if ( !find(*text++, glyph) ) return -1;
+    if (width == 0 && glyph.dX < 0) width -= glyph.dX;
+    if (*text) width += glyph.xAdvance;
+    else width += glyph.dX + glyph.width;
+  }
+  return width;
+}
+
+bool GlyphAtlas::drawCentre(const char *text, int32_t x, int32_t y, const uint16_t *pixels) {
+  AtlasGlyph glyph;
+  int16_t width = textWidth(text);
+  if (width < 0) return false;
+  bool swap = _lcd.getSwapBytes();
+  // Atlas pixels are stored in native order, as pushImage() expects from flash
+  _lcd.setSwapBytes(true);
+  x -= width / 2;
+  while (*text) {
+    find(*text++, glyph);
+    int32_t cx = x + glyph.dX;
+    int32_t cy = y + _ascent - glyph.dY;
+    const uint8_t *span = _spans + glyph.span * 3;
+    const uint16_t *pixel = pixels + glyph.pixel;
+    for (uint16_t i = 0; i < glyph.spans; i++, span += 3) {
+      uint8_t row = pgm_read_byte(span);
+      uint8_t left = pgm_read_byte(span + 1);
+      uint8_t length = pgm_read_byte(span + 2);
+      _lcd.pushImage(cx + left, cy + row, length, 1, pixel);
+      pixel += length;
+    }
+    x += glyph.xAdvance;
+  }
+  _lcd.setSwapBytes(swap);
+  return true;
+}
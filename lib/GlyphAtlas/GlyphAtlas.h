@@ -0,0 +1,38 @@
+#ifndef GLYPHATLAS_h
+#define GLYPHATLAS_h
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// One pre-rendered glyph: metrics as in the source smooth font, plus the
+// range of (row, x, length) spans and the first RGB565 pixel it owns
+struct AtlasGlyph {
+  uint16_t code;
+  uint8_t width;
+  uint8_t xAdvance;
+  int8_t dX;
+  int8_t dY;
+  uint16_t span;
+  uint16_t spans;
+  uint16_t pixel;
+};
+
+// Draws text from glyphs blended ahead of time (see tools/clock_atlas.py),
+// pushing each covered run of pixels straight from flash instead of
+// decoding and alpha-blending the font bitmap on every redraw. Placement
+// matches drawCentreString() with the source font selected.
+class GlyphAtlas {
+  public:
+    GlyphAtlas(TFT_eSPI &lcd, const AtlasGlyph *glyphs, uint8_t count, const uint8_t *spans, uint8_t ascent);
+    int16_t textWidth(const char *text);
+    bool drawCentre(const char *text, int32_t x, int32_t y, const uint16_t *pixels);
+  private:
+    bool find(char c, AtlasGlyph &glyph);
+    TFT_eSPI &_lcd;
+    const AtlasGlyph *_glyphs;
+    uint8_t _count;
+    const uint8_t *_spans;
+    uint8_t _ascent;
+};
+
+#endif
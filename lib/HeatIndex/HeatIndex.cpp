@@ -0,0 +1,73 @@
+#include <Arduino.h>
+#include "HeatIndex.h"
+
+float HeatIndex::compute(float temperature, float percentHumidity, bool isFahrenheit) {
+  float hi, t2, rh2;
+
+  if (!isFahrenheit)
+    temperature = toFahrenheit(temperature);
+
+  hi = 0.5f * (temperature + 61.0f + ((temperature - 68.0f) * 1.2f) + (percentHumidity * 0.094f));
+
+  if (hi > 79) {
+    t2 = temperature * temperature;
+    rh2 = percentHumidity * percentHumidity;
+    hi = -42.379f + 2.04901523f * temperature + 10.14333127f * percentHumidity +
+         -0.22475541f * temperature * percentHumidity +
+         -0.00683783f * t2 +
+         -0.05481717f * rh2 +
+         0.00122874f * t2 * percentHumidity +
+         0.00085282f * temperature * rh2 +
+         -0.00000199f * t2 * rh2;
+
+    if ((percentHumidity < 13) && (temperature >= 80.0f) &&
+        (temperature <= 112.0f))
+      hi -= ((13.0f - percentHumidity) * 0.25f) *
+            sqrtf((17.0f - fabsf(temperature - 95.0f)) * 0.05882f);
+
+    else if ((percentHumidity > 85.0f) && (temperature >= 80.0f) &&
+             (temperature <= 87.0f))
+      hi += ((percentHumidity - 85.0f) * 0.1f) * ((87.0f - temperature) * 0.2f);
+  }
+
+  return isFahrenheit ? hi : toCelsius(hi);
+}
+
+// The DHT library's implementation, kept as the accuracy reference
+float HeatIndex::reference(float temperature, float percentHumidity, bool isFahrenheit) {
+  float hi;
+
+  if (!isFahrenheit)
+    temperature = temperature * 1.8 + 32;
+
+  hi = 0.5 * (temperature + 61.0 + ((temperature - 68.0) * 1.2) + (percentHumidity * 0.094));
+
+  if (hi > 79) {
+    hi = -42.379 + 2.04901523 * temperature + 10.14333127 * percentHumidity +
+         -0.22475541 * temperature * percentHumidity +
+         -0.00683783 * pow(temperature, 2) +
+         -0.05481717 * pow(percentHumidity, 2) +
+         0.00122874 * pow(temperature, 2) * percentHumidity +
+         0.00085282 * temperature * pow(percentHumidity, 2) +
+         -0.00000199 * pow(temperature, 2) * pow(percentHumidity, 2);
+
+    if ((percentHumidity < 13) && (temperature >= 80.0) &&
+        (temperature <= 112.0))
+      hi -= ((13.0 - percentHumidity) * 0.25) *
+            sqrt((17.0 - abs(temperature - 95.0)) * 0.05882);
+
+    else if ((percentHumidity > 85.0) && (temperature >= 80.0) &&
+             (temperature <= 87.0))
+      hi += ((percentHumidity - 85.0) * 0.1) * ((87.0 - temperature) * 0.2);
+  }
+
+  return isFahrenheit ? hi : (hi - 32) * 0.55555;
+}
+
+float HeatIndex::toFahrenheit(float c) {
+  return c * 1.8f + 32.0f;
+}
+
+float HeatIndex::toCelsius(float f) {
+  return (f - 32.0f) * 0.55555f;
+}
@@ -0,0 +1,18 @@
+#ifndef HEATINDEX_h
+#define HEATINDEX_h
+
+#include <Arduino.h>
+
+// Rothfusz heat index with the NWS adjustments, as in the DHT sensor
+// library. compute() is the single-precision version the firmware runs,
+// without pow() or double promotion; reference() is the original double
+// maths it is tested against (test/test_heat_index).
+class HeatIndex {
+  public:
+    static float compute(float temperature, float percentHumidity, bool isFahrenheit);
+    static float reference(float temperature, float percentHumidity, bool isFahrenheit);
+    static float toFahrenheit(float c);
+    static float toCelsius(float f);
+};
+
+#endif
@@ -0,0 +1,151 @@
+#include <Arduino.h>
+#include "History.h"
+
+static const char *history_names[HISTORY_CHANNELS] = { "temperature", "humidity", "pressure" };
+static const float history_base[HISTORY_CHANNELS] = { 0.0F, 0.0F, 800.0F };
+static const float history_scale[HISTORY_CHANNELS] = { 100.0F, 100.0F, 50.0F };
+
+History::History() {
+  clear();
+}
+
+void History::clear() {
+  for (int i = 0; i < HISTORY_CAPACITY; i++) {
+    for (int c = 0; c < HISTORY_CHANNELS; c++) _slots[i][c] = HISTORY_GAP;
+  }
+  for (int b = 0; b < HISTORY_BLOCKS; b++) {
+    _blocks[b].id = 0;
+    for (int c = 0; c < HISTORY_CHANNELS; c++) _blocks[b].channels[c].count = 0;
+  }
+  _first = 0;
+  _newest = 0;
+  _minute = 0;
+  _count = 0;
+}
+
+// Readings taken within the same minute are averaged into one slot, which
+// is written once a reading from a later minute arrives
+void History::add(uint32_t time, const float *values) {
+  uint32_t minute = time / 60;
+  if (_count && minute != _minute) commit();
+  if (!_count) {
+    _minute = minute;
+    for (int c = 0; c < HISTORY_CHANNELS; c++) _sums[c] = 0;
+  }
+  for (int c = 0; c < HISTORY_CHANNELS; c++) _sums[c] += values[c];
+  _count++;
+}
+
+uint32_t History::oldest() {
+  if (!_newest) return 0;
+  return max(_first, _newest - HISTORY_CAPACITY + 1) * 60;
+}
+
+uint32_t History::newest() {
+  return _newest * 60;
+}
+
+bool History::sample(uint32_t time, uint8_t channel, float &value) {
+  uint32_t minute = time / 60;
+  int16_t raw;
+  if (!_newest || time < oldest() || minute > _newest) return false;
+  raw = _slots[minute % HISTORY_CAPACITY][channel];
+  if (raw == HISTORY_GAP) return false;
+  value = decode(channel, raw);
+  return true;
+}
+
+// Min, max and mean of one channel over [from, to], in seconds
+bool History::summarize(uint32_t from, uint32_t to, uint8_t channel, float &low, float &high, float &mean) {
+  int16_t lo = INT16_MAX, hi = INT16_MIN;
+  int32_t sum = 0;
+  uint32_t count = 0;
+  uint32_t first, last, minute;
+  if (!_newest) return false;
+  first = max(from, oldest()) / 60;
+  last = min(to / 60, _newest);
+  minute = first;
+  while (minute <= last) {
+    const Block &block = _blocks[(minute % HISTORY_CAPACITY) / HISTORY_BLOCK];
+    if (minute % HISTORY_BLOCK == 0 && minute + HISTORY_BLOCK - 1 <= last && block.id == minute / HISTORY_BLOCK) {
+      const Summary &summary = block.channels[channel];
+      if (summary.count) {
+        lo = min(lo, summary.low);
+        hi = max(hi, summary.high);
+        sum += summary.sum;
+        count += summary.count;
+      }
+      minute += HISTORY_BLOCK;
+    } else {
+      int16_t raw = _slots[minute % HISTORY_CAPACITY][channel];
+      if (raw != HISTORY_GAP) {
+        lo = min(lo, raw);
+        hi = max(hi, raw);
+        sum += raw;
+        count++;
+      }
+      minute++;
+    }
+  }
+  if (!count) return false;
+  low = decode(channel, lo);
+  high = decode(channel, hi);
+  mean = history_base[channel] + (float)sum / count / history_scale[channel];
+  return true;
+}
+
+const char *History::name(uint8_t channel) {
+  return history_names[channel];
+}
+
+void History::commit() {
+  int16_t values[HISTORY_CHANNELS];
+  int16_t gap[HISTORY_CHANNELS];
+  uint32_t minute = _minute;
+  for (int c = 0; c < HISTORY_CHANNELS; c++) {
+    values[c] = encode(c, _sums[c] / _count);
+    gap[c] = HISTORY_GAP;
+  }
+  _count = 0;
+  // A clock that went backwards invalidates the ordering
+  if (_newest && (minute <= _newest || minute - _newest > HISTORY_CAPACITY)) clear();
+  if (_newest) {
+    for (uint32_t skipped = _newest + 1; skipped < minute; skipped++) write(skipped, gap);
+  }
+  if (!_newest) _first = minute;
+  write(minute, values);
+  _newest = minute;
+}
+
+void History::write(uint32_t minute, const int16_t *values) {
+  int16_t *slot = _slots[minute % HISTORY_CAPACITY];
+  Block &block = _blocks[(minute % HISTORY_CAPACITY) / HISTORY_BLOCK];
+  if (block.id != minute / HISTORY_BLOCK) {
+    block.id = minute / HISTORY_BLOCK;
+    for (int c = 0; c < HISTORY_CHANNELS; c++) block.channels[c].count = 0;
+  }
+  for (int c = 0; c < HISTORY_CHANNELS; c++) {
+    Summary &summary = block.channels[c];
+    slot[c] = values[c];
+    if (values[c] == HISTORY_GAP) continue;
+    if (!summary.count) {
+      summary.low = summary.high = values[c];
+      summary.sum = 0;
+    }
+    summary.low = min(summary.low, values[c]);
+    summary.high = max(summary.high, values[c]);
+    summary.sum += values[c];
+    summary.count++;
+  }
+}
+
+int16_t History::encode(uint8_t channel, float value) {
+  float scaled;
+  if (isnan(value)) return HISTORY_GAP;
+  scaled = roundf((value - history_base[channel]) * history_scale[channel]);
+  return (int16_t)constrain(scaled, -INT16_MAX, INT16_MAX);
+}
+
+float History::decode(uint8_t channel, int32_t value) {
+  return history_base[channel] + value / history_scale[channel];
+}
@@ -0,0 +1,57 @@
+#ifndef HISTORY_h
+#define HISTORY_h
+
+#include <Arduino.h>
+
+#ifndef HISTORY_CAPACITY
+#define HISTORY_CAPACITY 1440   // One-minute slots, 24 h
+#endif
+#define HISTORY_BLOCK    60     // Slots summarised together, must divide the capacity
+#define HISTORY_BLOCKS   (HISTORY_CAPACITY / HISTORY_BLOCK)
+#define HISTORY_CHANNELS 3
+#define HISTORY_GAP      INT16_MIN
+
+#define HISTORY_TEMPERATURE 0
+#define HISTORY_HUMIDITY    1
+#define HISTORY_PRESSURE    2
+
+// Fixed-size store of the last HISTORY_CAPACITY minutes of readings. Each
+// channel is kept as a 16-bit offset from a fixed base, minutes without a
+// reading are left as gaps. Every block of HISTORY_BLOCK slots carries a
+// running min/max/sum that is updated as slots are written, so range
+// summaries only scan the partial blocks at either end.
+class History {
+  public:
+    History();
+    void clear();
+    void add(uint32_t time, const float *values);
+    uint32_t oldest();
+    uint32_t newest();
+    bool sample(uint32_t time, uint8_t channel, float &value);
+    bool summarize(uint32_t from, uint32_t to, uint8_t channel, float &low, float &high, float &mean);
+    static const char *name(uint8_t channel);
+  private:
+    struct Summary {
+      int16_t low;
+      int16_t high;
+      int32_t sum;
+      uint16_t count;
+    };
+    struct Block {
+      uint32_t id;
+      Summary channels[HISTORY_CHANNELS];
+    };
+    void commit();
+    void write(uint32_t minute, const int16_t *values);
+    static int16_t encode(uint8_t channel, float value);
+    static float decode(uint8_t channel, int32_t value);
+    int16_t _slots[HISTORY_CAPACITY][HISTORY_CHANNELS];
+    Block _blocks[HISTORY_BLOCKS];
+    uint32_t _first;
+    uint32_t _newest;
+    uint32_t _minute;
+    float _sums[HISTORY_CHANNELS];
+    uint8_t _count;
+};
+
+#endif
@@ -0,0 +1,87 @@
+#include <Arduino.h>
+#include "MqttLink.h"
+
+MqttLink::MqttLink(PubSubClient &pubsub, WiFiClient &client) : _pubsub(pubsub), _client(client) {
+  _host = NULL;
+  _port = 0;
+  _resolved = false;
+  _state = MQTT_LINK_IDLE;
+  _failures = 0;
+  _backoff = MQTT_LINK_BACKOFF_MIN;
+  _last = 0;
+  _wait = 0;
+}
+
+void MqttLink::begin(const char *host, uint16_t port) {
+  _host = host;
+  _port = port;
+  _resolved = false;
+  _client.setTimeout(MQTT_LINK_CONNECT_TIMEOUT);
+  _pubsub.setSocketTimeout(MQTT_LINK_SOCKET_TIMEOUT);
+}
+
+void MqttLink::configure(const String &id, const String &user, const String &pass) {
+  _id = id;
+  _user = user;
+  _pass = pass;
+  if (_pubsub.connected()) _pubsub.disconnect();
+  _state = _user.isEmpty() || _pass.isEmpty() ? MQTT_LINK_IDLE : MQTT_LINK_BACKOFF;
+  retry();
+}
+
+void MqttLink::retry() {
+  _backoff = MQTT_LINK_BACKOFF_MIN;
+  _wait = 0;
+}
+
+// Returns true when a connection attempt was made during this call
+bool MqttLink::update() {
+  switch (_state) {
+    case MQTT_LINK_UP:
+      if (_pubsub.connected()) return false;
+      // Dropped: come back quickly the first time, then back off as usual
+      _state = MQTT_LINK_BACKOFF;
+      retry();
+      _last = millis();
+      _wait = random(MQTT_LINK_BACKOFF_MIN);
+      return false;
+    case MQTT_LINK_BACKOFF:
+      if (millis() - _last < _wait) return false;
+      break;
+    default:
+      return false;
+  }
+  _last = millis();
+  if (!_resolved || _failures % MQTT_LINK_RESOLVE_EVERY == MQTT_LINK_RESOLVE_EVERY - 1) {
+    if (!WiFi.hostByName(_host, _address)) {
+      fail();
+      return true;
+    }
+    _resolved = true;
+    _pubsub.setServer(_address, _port);
+  }
+  if (_pubsub.connect(_id.c_str(), _user.c_str(), _pass.c_str())) {
+    _state = MQTT_LINK_UP;
+    _failures = 0;
+    _backoff = MQTT_LINK_BACKOFF_MIN;
+  } else {
+    fail();
+  }
+  return true;
+}
+
+void MqttLink::fail() {
+  _failures++;
+  // Equal jitter: wait between half and all of the current backoff
+  _wait = _backoff / 2 + random(_backoff / 2 + 1);
+  _backoff = _backoff < MQTT_LINK_BACKOFF_MAX / 2 ? _backoff * 2 : MQTT_LINK_BACKOFF_MAX;
+  _last = millis();
+}
+
+uint8_t MqttLink::state() {
+  return _state;
+}
+
+uint32_t MqttLink::failures() {
+  return _failures;
+}
@@ -0,0 +1,49 @@
+#ifndef MQTTLINK_h
+#define MQTTLINK_h
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <PubSubClient.h>
+
+#define MQTT_LINK_IDLE    0   // No credentials, nothing to do
+#define MQTT_LINK_BACKOFF 1   // Down, waiting for the next attempt
+#define MQTT_LINK_UP      2
+
+#define MQTT_LINK_CONNECT_TIMEOUT 1000    // ms allowed for the TCP handshake
+#define MQTT_LINK_SOCKET_TIMEOUT  2       // s allowed for the CONNACK
+#define MQTT_LINK_BACKOFF_MIN     1000
+#define MQTT_LINK_BACKOFF_MAX     300000
+#define MQTT_LINK_RESOLVE_EVERY   8       // Failed attempts before a fresh DNS lookup
+
+// Keeps the broker connection alive without stalling the main loop: at
+// most one bounded connection attempt per update(), spaced out by an
+// exponential backoff with jitter while the broker is unreachable. The
+// broker address is resolved once and reused.
+class MqttLink {
+  public:
+    MqttLink(PubSubClient &pubsub, WiFiClient &client);
+    void begin(const char *host, uint16_t port);
+    void configure(const String &id, const String &user, const String &pass);
+    void retry();
+    bool update();
+    uint8_t state();
+    uint32_t failures();
+  private:
+    void fail();
+    PubSubClient &_pubsub;
+    WiFiClient &_client;
+    const char *_host;
+    uint16_t _port;
+    IPAddress _address;
+    bool _resolved;
+    String _id;
+    String _user;
+    String _pass;
+    uint8_t _state;
+    uint32_t _failures;
+    uint32_t _backoff;
+    uint32_t _last;
+    uint32_t _wait;
+};
+
+#endif
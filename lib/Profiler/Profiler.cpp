@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include "Profiler.h"
+
+Profiler::Profiler(const char * const *names, uint8_t count) {
+  _names = names;
+  _count = count < PROFILER_SECTIONS ? count : PROFILER_SECTIONS;
+  reset();
+}
+
+uint32_t Profiler::stamp() {
+#ifdef ESP8266
+  return ESP.getCycleCount();
+#else
+  return micros();
+#endif
+}
+
+void Profiler::record(uint8_t section, uint32_t start) {
+  if (section >= _count) return;
+  uint32_t elapsed = stamp() - start;
+#ifdef ESP8266
+  elapsed /= ESP.getCpuFreqMHz();
+#endif
+  Section &s = _sections[section];
+  uint8_t bucket = 0;
+  while (bucket < PROFILER_BUCKETS - 1 && (elapsed >> bucket) > 1) bucket++;
+  s.buckets[bucket]++;
+  if (s.count == 0 || elapsed < s.min) s.min = elapsed;
+  if (elapsed > s.max) s.max = elapsed;
+  s.total += elapsed;
+  s.count++;
+}
+
+void Profiler::reset() {
+  memset(_sections, 0, sizeof(_sections));
+}
+
+uint8_t Profiler::sections() {
+  return _count;
+}
+
+const char *Profiler::name(uint8_t section) {
+  return section < _count ? _names[section] : "";
+}
+
+uint32_t Profiler::count(uint8_t section) {
+  return section < _count ? _sections[section].count : 0;
+}
+
+uint32_t Profiler::shortest(uint8_t section) {
+  return section < _count ? _sections[section].min : 0;
+}
+
+uint32_t Profiler::longest(uint8_t section) {
+  return section < _count ? _sections[section].max : 0;
+}
+
+uint32_t Profiler::average(uint8_t section) {
+  if (section >= _count || _sections[section].count == 0) return 0;
+  return _sections[section].total / _sections[section].count;
+}
+
+uint32_t Profiler::percentile(uint8_t section, uint8_t p) {
+  if (section >= _count || _sections[section].count == 0) return 0;
+  const Section &s = _sections[section];
+  // Upper bound of the bucket holding the p-th percentile sample
+  uint32_t rank = ((uint64_t)s.count * p + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+    seen += s.buckets[i];
+    if (seen >= rank) {
+      uint32_t bound = i < 31 ? (2UL << i) - 1 : 0xFFFFFFFF;
+      return bound < s.max ? (bound > s.min ? bound : s.min) : s.max;
+    }
+  }
+  return s.max;
+}
@@ -0,0 +1,40 @@
+#ifndef PROFILER_h
+#define PROFILER_h
+
+#include <Arduino.h>
+
+#define PROFILER_SECTIONS 12
+#define PROFILER_BUCKETS  25
+
+// Per-section timing statistics in microseconds. Durations go into
+// power-of-two buckets (the last one catches everything from ~16 s up),
+// which is enough to estimate percentiles without keeping samples.
+// On the device stamps come from the CPU cycle counter, so a single
+// section must finish within one counter period (~53 s at 80 MHz).
+class Profiler {
+  public:
+    Profiler(const char * const *names, uint8_t count);
+    static uint32_t stamp();
+    void record(uint8_t section, uint32_t start);
+    void reset();
+    uint8_t sections();
+    const char *name(uint8_t section);
+    uint32_t count(uint8_t section);
+    uint32_t shortest(uint8_t section);
+    uint32_t longest(uint8_t section);
+    uint32_t average(uint8_t section);
+    uint32_t percentile(uint8_t section, uint8_t p);
+  private:
+    struct Section {
+      uint32_t count;
+      uint32_t min;
+      uint32_t max;
+      uint64_t total;
+      uint32_t buckets[PROFILER_BUCKETS];
+    };
+    const char * const *_names;
+    uint8_t _count;
+    Section _sections[PROFILER_SECTIONS];
+};
+
+#endif
@@ -0,0 +1,235 @@
+#include <Arduino.h>
+#include "Renderer.h"
+
+Region::Region() {
+  _kind = REGION_NONE;
+  _x0 = _y0 = _x1 = _y1 = _a = _b = 0;
+  _left = _top = _right = _bottom = 0;
+}
+
+Region Region::box(int16_t x, int16_t y, int16_t w, int16_t h) {
+  Region region;
+  region._kind = REGION_BOX;
+  region._left = x;
+  region._top = y;
+  region._right = x + w - 1;
+  region._bottom = y + h - 1;
+  return region;
+}
+
+Region Region::line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width) {
+  Region region;
+  int16_t pad = width / 2 + 1;
+  region._kind = REGION_LINE;
+  region._x0 = x0;
+  region._y0 = y0;
+  region._x1 = x1;
+  region._y1 = y1;
+  region._a = width;
+  region._left = min(x0, x1) - pad;
+  region._top = min(y0, y1) - pad;
+  region._right = max(x0, x1) + pad;
+  region._bottom = max(y0, y1) + pad;
+  return region;
+}
+
+Region Region::ring(int16_t x, int16_t y, int16_t r, int16_t ir) {
+  Region region;
+  region._kind = REGION_RING;
+  region._x0 = x;
+  region._y0 = y;
+  region._a = r;
+  region._b = ir;
+  region._left = x - r - 1;
+  region._top = y - r - 1;
+  region._right = x + r + 1;
+  region._bottom = y + r + 1;
+  return region;
+}
+
+bool Region::touchesBox(int16_t left, int16_t top, int16_t right, int16_t bottom) const {
+  switch (_kind) {
+    case REGION_RING:
+    {
+      // Nearest and farthest points of the box from the ring centre
+      int32_t nx = constrain(_x0, left, right) - _x0;
+      int32_t ny = constrain(_y0, top, bottom) - _y0;
+      int32_t fx = max(abs(left - _x0), abs(right - _x0));
+      int32_t fy = max(abs(top - _y0), abs(bottom - _y0));
+      int32_t outer = _a + 1;
+      int32_t inner = max(_b - 1, 0);
+      return nx * nx + ny * ny <= outer * outer && fx * fx + fy * fy >= inner * inner;
+    }
+    case REGION_LINE:
+    {
+      // Clip the segment against the box grown by half the line width
+      int16_t pad = _a / 2 + 1;
+      float t0 = 0.0f, t1 = 1.0f;
+      float dx = _x1 - _x0, dy = _y1 - _y0;
+      float p[4] = { -dx, dx, -dy, dy };
+      float q[4] = { (float)(_x0 - (left - pad)), (float)((right + pad) - _x0),
+                     (float)(_y0 - (top - pad)), (float)((bottom + pad) - _y0) };
+      for (int i = 0; i < 4; i++) {
+        if (p[i] == 0.0f) {
+          if (q[i] < 0.0f) return false;
+        } else {
+          float t = q[i] / p[i];
+          if (p[i] < 0.0f) {
+            if (t > t1) return false;
+            if (t > t0) t0 = t;
+          } else {
+            if (t < t0) return false;
+            if (t < t1) t1 = t;
+          }
+        }
+      }
+      return true;
+    }
+    case REGION_BOX:
+      return true;
+  }
+  return false;
+}
+
+bool Region::intersects(const Region &other) const {
+  if (_kind == REGION_NONE || other._kind == REGION_NONE) return false;
+  if (_right < other._left || other._right < _left || _bottom < other._top || other._bottom < _top) return false;
+  return touchesBox(other._left, other._top, other._right, other._bottom) &&
+         other.touchesBox(_left, _top, _right, _bottom);
+}
+
+bool Region::covers(const Region &other) const {
+  if (other._kind == REGION_NONE) return true;
+  if (_kind != other._kind) return _kind == REGION_BOX && _left <= other._left && _top <= other._top &&
+                                    _right >= other._right && _bottom >= other._bottom;
+  return _left <= other._left && _top <= other._top && _right >= other._right && _bottom >= other._bottom &&
+         (_kind != REGION_RING || (_x0 == other._x0 && _y0 == other._y0 && _b <= other._b)) &&
+         (_kind != REGION_LINE || (_x0 == other._x0 && _y0 == other._y0 && _x1 == other._x1 && _y1 == other._y1 && _a >= other._a));
+}
+
+void Region::erase(TFT_eSPI &lcd, uint16_t color) const {
+  switch (_kind) {
+    case REGION_BOX:
+      lcd.fillRect(_left, _top, _right - _left + 1, _bottom - _top + 1, color);
+    break;
+    case REGION_LINE:
+      lcd.drawWideLine(_x0, _y0, _x1, _y1, _a + 2, color, color);
+    break;
+    case REGION_RING:
+      lcd.drawSmoothArc(_x0, _y0, _a + 1, max(_b - 1, 0), 0, 360, color, color);
+    break;
+  }
+}
+
+uint32_t Region::area() const {
+  switch (_kind) {
+    case REGION_BOX:
+      return (uint32_t)(_right - _left + 1) * (_bottom - _top + 1);
+    case REGION_LINE:
+      return (uint32_t)(sqrtf((float)(_x1 - _x0) * (_x1 - _x0) + (float)(_y1 - _y0) * (_y1 - _y0)) + 1) * (_a + 2);
+    case REGION_RING:
+      return (uint32_t)(3.1416f * ((_a + 1) * (_a + 1) - max(_b - 1, 0) * max(_b - 1, 0)));
+  }
+  return 0;
+}
+
+Renderer::Renderer(TFT_eSPI &lcd, uint16_t background) : _lcd(lcd) {
+  _background = background;
+  _erased = 0;
+  reset();
+}
+
+void Renderer::reset() {
+  for (int i = 0; i < RENDERER_SLOTS; i++) {
+    _slots[i].hash = 0;
+    _slots[i].region = Region();
+    _slots[i].previous = Region();
+    _slots[i].shown = false;
+    _slots[i].staged = false;
+    _slots[i].changed = false;
+    _slots[i].opaque = false;
+    _slots[i].dirty = false;
+  }
+}
+
+void Renderer::begin() {
+  for (int i = 0; i < RENDERER_SLOTS; i++) {
+    _slots[i].staged = false;
+    _slots[i].changed = false;
+    _slots[i].dirty = false;
+  }
+}
+
+bool Renderer::stage(uint8_t slot, uint32_t hash) {
+  Slot &s = _slots[slot];
+  s.staged = true;
+  if (s.shown && s.hash == hash) return false;
+  s.previous = s.shown ? s.region : Region();
+  s.hash = hash;
+  s.changed = true;
+  return true;
+}
+
+void Renderer::place(uint8_t slot, const Region &region, bool opaque) {
+  _slots[slot].region = region;
+  _slots[slot].opaque = opaque;
+}
+
+void Renderer::commit() {
+  Region damage[RENDERER_SLOTS];
+  int count = 0;
+  // Clear whatever is leaving the screen or moving
+  for (int i = 0; i < RENDERER_SLOTS; i++) {
+    Slot &s = _slots[i];
+    if (s.shown && !s.staged) {
+      damage[count++] = s.region;
+      s.shown = false;
+    } else if (s.changed && !(s.opaque && s.region.covers(s.previous))) {
+      damage[count++] = s.previous;
+    } else {
+      continue;
+    }
+    damage[count - 1].erase(_lcd, _background);
+    _erased += damage[count - 1].area();
+  }
+  // Redraw changed slots plus anything they or the erases overlap
+  for (int i = 0; i < RENDERER_SLOTS; i++) {
+    Slot &s = _slots[i];
+    if (!s.staged) continue;
+    s.dirty = s.changed;
+    for (int j = 0; j < count && !s.dirty; j++) {
+      s.dirty = damage[j].intersects(s.region);
+    }
+    for (int j = 0; j < i && !s.dirty; j++) {
+      s.dirty = _slots[j].dirty && _slots[j].region.intersects(s.region);
+    }
+    s.shown = true;
+  }
+}
+
+bool Renderer::dirty(uint8_t slot) {
+  return _slots[slot].dirty;
+}
+
+uint32_t Renderer::erased() {
+  return _erased;
+}
+
+uint32_t Renderer::hash(const char *text, uint32_t seed) {
+  uint32_t h = seed;
+  while (*text) {
+    h ^= (uint8_t)*text++;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+uint32_t Renderer::hash(uint32_t value, uint32_t seed) {
+  uint32_t h = seed;
+  for (int i = 0; i < 4; i++) {
+    h ^= value & 0xFF;
+    h *= 16777619UL;
+    value >>= 8;
+  }
+  return h;
+}
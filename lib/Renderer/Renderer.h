@@ -0,0 +1,66 @@
+#ifndef RENDERER_h
+#define RENDERER_h
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define RENDERER_SLOTS 12
+
+#define REGION_NONE 0
+#define REGION_BOX  1
+#define REGION_LINE 2
+#define REGION_RING 3
+
+// Screen area covered by one element: a box, a wide line or a ring
+class Region {
+  public:
+    Region();
+    static Region box(int16_t x, int16_t y, int16_t w, int16_t h);
+    static Region line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width);
+    static Region ring(int16_t x, int16_t y, int16_t r, int16_t ir);
+    bool intersects(const Region &other) const;
+    bool covers(const Region &other) const;
+    void erase(TFT_eSPI &lcd, uint16_t color) const;
+    uint32_t area() const;
+  private:
+    bool touchesBox(int16_t left, int16_t top, int16_t right, int16_t bottom) const;
+    uint8_t _kind;
+    int16_t _x0, _y0, _x1, _y1;
+    int16_t _a, _b;
+    int16_t _left, _top, _right, _bottom;
+};
+
+// Retained-mode frame tracking: each element lives in a numbered slot
+// (lower slots are drawn first) with a content hash and the region it
+// covers. Only slots whose content changed, or whose pixels were damaged
+// by an erase or by a changed element below them, are redrawn.
+class Renderer {
+  public:
+    Renderer(TFT_eSPI &lcd, uint16_t background);
+    void reset();
+    void begin();
+    bool stage(uint8_t slot, uint32_t hash);
+    void place(uint8_t slot, const Region &region, bool opaque = false);
+    void commit();
+    bool dirty(uint8_t slot);
+    uint32_t erased();
+    static uint32_t hash(const char *text, uint32_t seed = 2166136261UL);
+    static uint32_t hash(uint32_t value, uint32_t seed = 2166136261UL);
+  private:
+    struct Slot {
+      uint32_t hash;
+      Region region;
+      Region previous;
+      bool shown;
+      bool staged;
+      bool changed;
+      bool opaque;
+      bool dirty;
+    };
+    TFT_eSPI &_lcd;
+    uint16_t _background;
+    Slot _slots[RENDERER_SLOTS];
+    uint32_t _erased;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#include <Arduino.h>
+#include "ResponseStream.h"
+
+ResponseStream::ResponseStream(ESP8266WebServer &server, char *buffer, size_t size) : _server(server) {
+  _buffer = buffer;
+  _size = size;
+  _length = 0;
+  _sent = 0;
+}
+
+size_t ResponseStream::write(uint8_t c) {
+  if (_length == _size) flush();
+  _buffer[_length++] = c;
+  return 1;
+}
+
+size_t ResponseStream::write(const uint8_t *data, size_t size) {
+  for (size_t i = 0; i < size; i++) write(data[i]);
+  return size;
+}
+
+void ResponseStream::flush() {
+  if (!_length) return;
+  _server.sendContent(_buffer, _length);
+  _sent += _length;
+  _length = 0;
+}
+
+// Bytes handed to the server so far, not counting what is still buffered
+size_t ResponseStream::sent() const {
+  return _sent;
+}
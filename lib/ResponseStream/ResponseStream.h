@@ -0,0 +1,37 @@
+#ifndef RESPONSESTREAM_h
+#define RESPONSESTREAM_h
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+
+// Print that passes a response body to the client through
+// ESP8266WebServer::sendContent() in blocks of the buffer size, so
+// serializeJson() can write straight into the socket instead of into a
+// reply buffer. The caller sends the headers first and calls flush() at
+// the end for the last partial block.
+class ResponseStream : public Print {
+  public:
+    ResponseStream(ESP8266WebServer &server, char *buffer, size_t size);
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t size) override;
+    void flush() override;
+    size_t sent() const;
+  private:
+    ESP8266WebServer &_server;
+    char *_buffer;
+    size_t _size;
+    size_t _length;
+    size_t _sent;
+};
+
+// ResponseStream with its own storage, for use on the stack
+template <size_t N>
+class ResponseBuffer : public ResponseStream {
+  public:
+    explicit ResponseBuffer(ESP8266WebServer &server) : ResponseStream(server, _storage, N) {}
+    ~ResponseBuffer() { flush(); }
+  private:
+    char _storage[N];
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include <Arduino.h>
+#include "SampleLog.h"
+
+SampleLog::SampleLog(FS &fs, const char *dir) : _fs(fs) {
+  _dir = dir;
+  _tail = 1;
+  _head = 0;
+  _headRecords = 0;
+  _stored = 0;
+  _offset = 0;
+  _dropped = 0;
+  _count = 0;
+}
+
+// Picks up segments left over from before a reboot
+void SampleLog::begin() {
+  _fs.mkdir(_dir);
+  Dir dir = _fs.openDir(_dir);
+  _tail = 0xFFFFFFFF;
+  _head = 0;
+  _stored = 0;
+  _offset = 0;
+  while (dir.next()) {
+    uint32_t segment = strtoul(dir.fileName().c_str(), NULL, 16);
+    uint32_t count = dir.fileSize() / sizeof(LogSample);
+    if (!segment) continue;
+    _stored += count;
+    if (segment < _tail) _tail = segment;
+    if (segment > _head) {
+      _head = segment;
+      _headRecords = count;
+    }
+  }
+  if (!_head) {
+    _tail = 1;
+    _headRecords = 0;
+  }
+}
+
+void SampleLog::append(const LogSample &sample) {
+  _staged[_count++] = sample;
+  if (_count == SAMPLE_LOG_STAGE) flush();
+}
+
+void SampleLog::flush() {
+  char name[32];
+  uint8_t written = 0;
+  while (written < _count) {
+    uint32_t count;
+    if (_tail > _head || _headRecords >= SAMPLE_LOG_RECORDS) {
+      _head++;
+      _headRecords = 0;
+      if (_head - _tail + 1 > SAMPLE_LOG_SEGMENTS) drop();
+    }
+    count = min((uint32_t)(_count - written), SAMPLE_LOG_RECORDS - _headRecords);
+    path(_head, name, sizeof(name));
+    File file = _fs.open(name, "a");
+    if (!file) break;
+    count = file.write((const uint8_t *)&_staged[written], count * sizeof(LogSample)) / sizeof(LogSample);
+    file.close();
+    if (!count) break;
+    _headRecords += count;
+    _stored += count;
+    written += count;
+  }
+  _dropped += _count - written;
+  _count = 0;
+}
+
+// Copies up to count of the oldest samples without removing them
+size_t SampleLog::peek(LogSample *samples, size_t count) {
+  char name[32];
+  while (_stored > _offset) {
+    size_t read = 0;
+    path(_tail, name, sizeof(name));
+    File file = _fs.open(name, "r");
+    if (file && file.seek(_offset * sizeof(LogSample))) {
+      read = file.read((uint8_t *)samples, count * sizeof(LogSample)) / sizeof(LogSample);
+    }
+    if (file) file.close();
+    if (read) return read;
+    // Missing or truncated segment, skip it
+    drop();
+  }
+  count = min(count, (size_t)_count);
+  memcpy(samples, _staged, count * sizeof(LogSample));
+  return count;
+}
+
+// Removes the count samples last returned by peek()
+void SampleLog::consume(size_t count) {
+  char name[32];
+  if (_stored > _offset) {
+    _offset += count;
+    if (_offset >= records(_tail)) {
+      path(_tail, name, sizeof(name));
+      _fs.remove(name);
+      _stored -= min(_stored, records(_tail));
+      _tail++;
+      _offset = 0;
+      if (_tail > _head) _headRecords = 0;
+    }
+  } else {
+    count = min(count, (size_t)_count);
+    memmove(_staged, _staged + count, (_count - count) * sizeof(LogSample));
+    _count -= count;
+  }
+}
+
+uint32_t SampleLog::pending() {
+  return _stored - _offset + _count;
+}
+
+uint32_t SampleLog::dropped() {
+  return _dropped;
+}
+
+void SampleLog::path(uint32_t segment, char *buffer, size_t size) {
+  snprintf(buffer, size, "%s/%08lx", _dir, (unsigned long)segment);
+}
+
+uint32_t SampleLog::records(uint32_t segment) {
+  return segment == _head ? _headRecords : SAMPLE_LOG_RECORDS;
+}
+
+// Discards the oldest segment
+void SampleLog::drop() {
+  char name[32];
+  uint32_t count = min(_stored, records(_tail));
+  path(_tail, name, sizeof(name));
+  _fs.remove(name);
+  _dropped += count - min(count, _offset);
+  _stored -= count;
+  _tail++;
+  _offset = 0;
+  if (_tail > _head) _headRecords = 0;
+}
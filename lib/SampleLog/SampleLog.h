@@ -0,0 +1,54 @@
+#ifndef SAMPLELOG_h
+#define SAMPLELOG_h
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#define SAMPLE_LOG_STAGE    8     // Samples held in RAM before a flash write
+#define SAMPLE_LOG_RECORDS  256   // Samples per segment file
+#define SAMPLE_LOG_SEGMENTS 16    // Segments kept before the oldest is dropped
+
+struct LogSample {
+  uint32_t time;
+  float temperature;
+  float humidity;
+  float pressure;
+};
+
+// Append-only log of samples in numbered segment files under one
+// directory. Samples are staged in RAM and written in groups (a power cut
+// loses at most SAMPLE_LOG_STAGE of them); full
+// segments are never rewritten, and drained segments are deleted whole,
+// so flash sees appends and deletes only. Once SAMPLE_LOG_SEGMENTS are in
+// use the oldest segment is dropped to make room.
+//
+// The read position inside the oldest segment is kept in RAM only: after
+// a reboot that segment is replayed from its start, which may resend a
+// few samples but never skips any.
+class SampleLog {
+  public:
+    SampleLog(FS &fs, const char *dir);
+    void begin();
+    void append(const LogSample &sample);
+    void flush();
+    size_t peek(LogSample *samples, size_t count);
+    void consume(size_t count);
+    uint32_t pending();
+    uint32_t dropped();
+  private:
+    void path(uint32_t segment, char *buffer, size_t size);
+    uint32_t records(uint32_t segment);
+    void drop();
+    FS &_fs;
+    const char *_dir;
+    uint32_t _tail;
+    uint32_t _head;
+    uint32_t _headRecords;
+    uint32_t _stored;
+    uint32_t _offset;
+    uint32_t _dropped;
+    LogSample _staged[SAMPLE_LOG_STAGE];
+    uint8_t _count;
+};
+
+#endif
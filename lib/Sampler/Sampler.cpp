@@ -0,0 +1,96 @@
+#include <Arduino.h>
+#include "Sampler.h"
+
+Sampler::Sampler(BMP280 &bmp, AHT20 &aht) : _bmp(bmp), _aht(aht) {
+  _bmpConversion = 0;
+  _state = SAMPLER_IDLE;
+  _bmpPending = false;
+  _ahtPending = false;
+  _valid = false;
+  _started = 0;
+  _bmpDue = 0;
+  _temperature = 0;
+  _humidity = 0;
+  _pressure = 0;
+}
+
+// Call after BMP280::setSampling(), which sets the conversion time
+void Sampler::begin() {
+  _bmpConversion = _bmp.conversionTime();
+}
+
+void Sampler::start() {
+  if (_state == SAMPLER_CONVERTING) return;
+  _started = millis();
+  // Both conversions run in parallel on the sensors
+  _bmp.trigger();
+  _bmpDue = _started + _bmpConversion;
+  _bmpPending = true;
+  _ahtPending = _aht.trigger();
+  _valid = _ahtPending;
+  _state = SAMPLER_CONVERTING;
+}
+
+// Returns true once, when the sample started last has been collected
+bool Sampler::update() {
+  uint32_t now;
+  if (_state != SAMPLER_CONVERTING) return false;
+  now = millis();
+  if (_bmpPending && (int32_t)(now - _bmpDue) >= 0) {
+    if (_bmp.busy()) {
+      _bmpDue = now + SAMPLER_POLL;
+    } else {
+      if (_bmp.read()) {
+        _pressure = _bmp.pressure() / 25600.0F;
+      } else {
+        _valid = false;
+      }
+      _bmpPending = false;
+    }
+  }
+  if (_ahtPending) {
+    if (_aht.poll()) {
+      _humidity = _aht.humidity();
+      _temperature = _aht.temperature();
+      _ahtPending = false;
+    } else if (_aht.state() == AHT20_ERROR) {
+      _ahtPending = false;
+      _valid = false;
+    }
+  }
+  if ((_bmpPending || _ahtPending) && now - _started >= SAMPLER_GIVE_UP) {
+    _bmpPending = _ahtPending = false;
+    _valid = false;
+  }
+  if (_bmpPending || _ahtPending) return false;
+  _state = SAMPLER_READY;
+  return true;
+}
+
+uint8_t Sampler::state() {
+  return _state;
+}
+
+bool Sampler::valid() {
+  return _valid;
+}
+
+float Sampler::temperature() {
+  return _temperature;
+}
+
+float Sampler::humidity() {
+  return _humidity;
+}
+
+float Sampler::pressure() {
+  return _pressure;
+}
+
+float Sampler::altitude(float seaLevel) {
+  return altitude(_pressure, seaLevel);
+}
+
+float Sampler::altitude(float pressure, float seaLevel) {
+  return 44330.0F * (1.0F - powf(pressure / seaLevel, 0.1903F));
+}
@@ -0,0 +1,47 @@
+#ifndef SAMPLER_h
+#define SAMPLER_h
+
+#include <Arduino.h>
+#include "BMP280.h"
+#include "AHT20.h"
+
+#define SAMPLER_IDLE       0
+#define SAMPLER_CONVERTING 1
+#define SAMPLER_READY      2
+
+#define SAMPLER_POLL    2     // ms between status polls once a deadline passes
+#define SAMPLER_GIVE_UP 250   // ms after start before a busy sensor is abandoned
+
+// Takes one reading from the BMP280 and the AHT20 without busy-waiting:
+// start() triggers both conversions at once and returns, update() collects
+// each result once its datasheet conversion time has elapsed. Altitude is
+// derived from the pressure already read instead of a second conversion.
+class Sampler {
+  public:
+    Sampler(BMP280 &bmp, AHT20 &aht);
+    void begin();
+    void start();
+    bool update();
+    uint8_t state();
+    bool valid();
+    float temperature();
+    float humidity();
+    float pressure();
+    float altitude(float seaLevel);
+    static float altitude(float pressure, float seaLevel);
+  private:
+    BMP280 &_bmp;
+    AHT20 &_aht;
+    uint8_t _bmpConversion;
+    uint8_t _state;
+    bool _bmpPending;
+    bool _ahtPending;
+    bool _valid;
+    uint32_t _started;
+    uint32_t _bmpDue;
+    float _temperature;
+    float _humidity;
+    float _pressure;
+};
+
+#endif
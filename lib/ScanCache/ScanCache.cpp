@@ -0,0 +1,83 @@
+#include <Arduino.h>
+#include "ScanCache.h"
+
+ScanCache::ScanCache() {
+  _count = 0;
+  _scanning = false;
+  _valid = false;
+  _updated = 0;
+}
+
+// Starts an asynchronous scan unless one is already running
+bool ScanCache::start() {
+  if (_scanning) return true;
+  _scanning = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+  return _scanning;
+}
+
+// Takes the results of a finished scan, returning true when the cache
+// was refreshed. A failed scan keeps the previous list.
+bool ScanCache::poll() {
+  int8_t n;
+  if (!_scanning) return false;
+  n = WiFi.scanComplete();
+  if (n == WIFI_SCAN_RUNNING) return false;
+  _scanning = false;
+  if (n < 0) return false;
+  _count = 0;
+  for (int8_t i = 0; i < n; i++) add(WiFi.SSID(i), WiFi.RSSI(i), WiFi.encryptionType(i));
+  WiFi.scanDelete();
+  _valid = true;
+  _updated = millis();
+  return true;
+}
+
+bool ScanCache::scanning() {
+  return _scanning;
+}
+
+// Whether a scan has completed since boot
+bool ScanCache::valid() {
+  return _valid;
+}
+
+// ms since the cached list was taken
+uint32_t ScanCache::age() {
+  return millis() - _updated;
+}
+
+uint8_t ScanCache::count() {
+  return _count;
+}
+
+const ScanNetwork &ScanCache::network(uint8_t index) {
+  return _networks[index];
+}
+
+// Merges by SSID and keeps the list sorted by RSSI, dropping the weakest
+// entry when full
+void ScanCache::add(const String &ssid, int32_t rssi, uint8_t sec) {
+  uint8_t i;
+  if (!ssid.length()) return;
+  for (i = 0; i < _count; i++) {
+    if (strcmp(_networks[i].ssid, ssid.c_str()) == 0) break;
+  }
+  if (i < _count) {
+    if (rssi <= _networks[i].rssi) return;
+  } else if (_count < SCAN_CACHE_SIZE) {
+    i = _count++;
+  } else if (rssi > _networks[_count - 1].rssi) {
+    i = _count - 1;
+  } else {
+    return;
+  }
+  // Shift weaker entries down past the slot being replaced
+  while (i > 0 && _networks[i - 1].rssi < rssi) {
+    _networks[i] = _networks[i - 1];
+    i--;
+  }
+  strncpy(_networks[i].ssid, ssid.c_str(), SCAN_SSID_SIZE - 1);
+  _networks[i].ssid[SCAN_SSID_SIZE - 1] = '\0';
+  _networks[i].rssi = rssi;
+  _networks[i].sec = sec;
+}
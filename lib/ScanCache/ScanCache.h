@@ -0,0 +1,39 @@
+#ifndef SCANCACHE_h
+#define SCANCACHE_h
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+#define SCAN_CACHE_SIZE 16   // Distinct networks kept, strongest first
+#define SCAN_SSID_SIZE  33   // 32 characters and the NUL
+
+struct ScanNetwork {
+  char ssid[SCAN_SSID_SIZE];
+  int32_t rssi;
+  uint8_t sec;
+};
+
+// Runs Wi-Fi scans in the background and keeps the last complete result,
+// so a request never waits on the radio. Access points sharing an SSID
+// are merged into one entry at the strongest RSSI, and hidden networks
+// are left out.
+class ScanCache {
+  public:
+    ScanCache();
+    bool start();
+    bool poll();
+    bool scanning();
+    bool valid();
+    uint32_t age();
+    uint8_t count();
+    const ScanNetwork &network(uint8_t index);
+  private:
+    void add(const String &ssid, int32_t rssi, uint8_t sec);
+    ScanNetwork _networks[SCAN_CACHE_SIZE];
+    uint8_t _count;
+    bool _scanning;
+    bool _valid;
+    uint32_t _updated;
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include <Arduino.h>
+#include "Scheduler.h"
+
+Scheduler::Scheduler() {
+  _count = 0;
+}
+
+// Periodic task; returns its index, or -1 when the table is full
+int8_t Scheduler::add(const char *name, TaskFunction function, uint32_t period, uint32_t deadline, uint32_t budget) {
+  int8_t index = append(name, function, deadline, budget);
+  if (index >= 0) _tasks[index].period = period;
+  return index;
+}
+
+// Task released whenever timer has finished; the timer is restarted after
+// each run, so init() on it still changes the interval
+int8_t Scheduler::add(const char *name, TaskFunction function, Timer &timer, uint32_t deadline, uint32_t budget) {
+  int8_t index = append(name, function, deadline, budget);
+  if (index < 0) return index;
+  if (!_timers.add(timer)) {
+    _count--;
+    return -1;
+  }
+  _tasks[index].timer = &timer;
+  return index;
+}
+
+// Only a change of state takes effect, so this can be called every pass
+void Scheduler::enable(uint8_t task, bool enabled) {
+  if (task >= _count || _tasks[task].enabled == enabled) return;
+  _tasks[task].enabled = enabled;
+  _tasks[task].released = false;
+  _tasks[task].release = millis();
+}
+
+// Changes the period of a periodic task from its next release on
+void Scheduler::period(uint8_t task, uint32_t period) {
+  if (task >= _count || _tasks[task].timer) return;
+  _tasks[task].period = period;
+}
+
+// Runs at most one task; returns false if none was due
+bool Scheduler::run() {
+  uint32_t now = millis();
+  int8_t next = -1;
+  _timers.update(now);
+  for (uint8_t i = 0; i < _count; i++) {
+    if (!ready(_tasks[i], now)) continue;
+    if (next < 0 || (int32_t)(_tasks[i].release + _tasks[i].deadline - _tasks[next].release - _tasks[next].deadline) < 0) {
+      next = i;
+    }
+  }
+  if (next < 0) return false;
+  Task &task = _tasks[next];
+  if ((int32_t)(now - task.release) > (int32_t)task.deadline) task.late++;
+  uint32_t start = micros();
+  task.function();
+  uint32_t elapsed = micros() - start;
+  if (task.timer) task.timer->restart();
+  task.released = false;
+  task.release = task.period ? task.release + task.period : millis();
+  // A periodic task that fell a whole period behind skips the missed releases
+  if (task.period && (int32_t)(millis() - task.release) >= (int32_t)task.period) task.release = millis();
+  task.runs++;
+  task.busy += elapsed;
+  if (elapsed > task.longest) task.longest = elapsed;
+  if (elapsed > task.budget) task.overruns++;
+  return true;
+}
+
+// Time in ms until some task is due, 0 if one already is
+uint32_t Scheduler::idle() {
+  uint32_t now = millis();
+  uint32_t wait = TIMER_NEVER;
+  for (uint8_t i = 0; i < _count; i++) {
+    Task &task = _tasks[i];
+    if (!task.enabled) continue;
+    if (task.timer) {
+      wait = min(wait, task.released ? 0 : task.timer->remaining(now));
+    } else {
+      wait = min(wait, (int32_t)(task.release - now) > 0 ? task.release - now : 0);
+    }
+  }
+  return wait;
+}
+
+void Scheduler::reset() {
+  for (uint8_t i = 0; i < _count; i++) {
+    _tasks[i].runs = 0;
+    _tasks[i].late = 0;
+    _tasks[i].overruns = 0;
+    _tasks[i].longest = 0;
+    _tasks[i].busy = 0;
+  }
+}
+
+uint8_t Scheduler::tasks() {
+  return _count;
+}
+
+const char *Scheduler::name(uint8_t task) {
+  return _tasks[task].name;
+}
+
+uint32_t Scheduler::runs(uint8_t task) {
+  return _tasks[task].runs;
+}
+
+uint32_t Scheduler::late(uint8_t task) {
+  return _tasks[task].late;
+}
+
+uint32_t Scheduler::overruns(uint8_t task) {
+  return _tasks[task].overruns;
+}
+
+// Longest single run, in microseconds
+uint32_t Scheduler::longest(uint8_t task) {
+  return _tasks[task].longest;
+}
+
+// Total time spent in the task, in microseconds
+uint64_t Scheduler::busy(uint8_t task) {
+  return _tasks[task].busy;
+}
+
+int8_t Scheduler::append(const char *name, TaskFunction function, uint32_t deadline, uint32_t budget) {
+  if (_count >= SCHEDULER_TASKS) return -1;
+  Task &task = _tasks[_count];
+  task.name = name;
+  task.function = function;
+  task.timer = NULL;
+  task.period = 0;
+  task.deadline = deadline;
+  task.budget = budget;
+  task.enabled = true;
+  task.released = false;
+  task.release = millis();
+  task.runs = 0;
+  task.late = 0;
+  task.overruns = 0;
+  task.longest = 0;
+  task.busy = 0;
+  return _count++;
+}
+
+// Timer tasks are stamped with the time their timer was first seen
+// finished, which is as close to the expiry as polling gets
+bool Scheduler::ready(Task &task, uint32_t now) {
+  if (!task.enabled) return false;
+  if (task.timer) {
+    if (!task.released) {
+      if (!task.timer->hasFinished()) return false;
+      task.released = true;
+      task.release = now;
+    }
+    return true;
+  }
+  return (int32_t)(now - task.release) >= 0;
+}
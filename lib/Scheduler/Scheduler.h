@@ -0,0 +1,59 @@
+#ifndef SCHEDULER_h
+#define SCHEDULER_h
+
+#include <Arduino.h>
+#include "Timer.h"
+
+#define SCHEDULER_TASKS 12
+
+typedef void (*TaskFunction)();
+
+// Cooperative run-to-completion scheduler over a fixed task table. A task
+// is released every period ms (0 means as soon as it last finished) or
+// when its Timer runs out, and must start within its deadline. Each run()
+// starts the single released task with the earliest deadline, so a task
+// waits at most for one slice of another task rather than a whole pass
+// over all of them. Runs longer than the task's budget count as overruns,
+// starts past the deadline as late.
+class Scheduler {
+  public:
+    Scheduler();
+    int8_t add(const char *name, TaskFunction function, uint32_t period, uint32_t deadline, uint32_t budget);
+    int8_t add(const char *name, TaskFunction function, Timer &timer, uint32_t deadline, uint32_t budget);
+    void enable(uint8_t task, bool enabled);
+    void period(uint8_t task, uint32_t period);
+    bool run();
+    uint32_t idle();
+    void reset();
+    uint8_t tasks();
+    const char *name(uint8_t task);
+    uint32_t runs(uint8_t task);
+    uint32_t late(uint8_t task);
+    uint32_t overruns(uint8_t task);
+    uint32_t longest(uint8_t task);
+    uint64_t busy(uint8_t task);
+  private:
+    struct Task {
+      const char *name;
+      TaskFunction function;
+      Timer *timer;
+      uint32_t period;
+      uint32_t deadline;
+      uint32_t budget;
+      bool enabled;
+      bool released;
+      uint32_t release;
+      uint32_t runs;
+      uint32_t late;
+      uint32_t overruns;
+      uint32_t longest;
+      uint64_t busy;
+    };
+    int8_t append(const char *name, TaskFunction function, uint32_t deadline, uint32_t budget);
+    bool ready(Task &task, uint32_t now);
+    Task _tasks[SCHEDULER_TASKS];
+    TimerGroup _timers;
+    uint8_t _count;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include <Arduino.h>
+#include "Sparkline.h"
+
+// Values are kept in tenths
+Sparkline::Sparkline(TFT_eSPI &lcd, int16_t x, int16_t y, uint8_t height, float step) : _lcd(lcd) {
+  _x = x;
+  _y = y;
+  _height = height;
+  _step = max((int16_t)1, encode(step));
+  _low = 0;
+  _high = _step;
+  clear();
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) _top[i] = _bottom[i] = SPARKLINE_EMPTY;
+}
+
+void Sparkline::clear() {
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) _values[i] = SPARKLINE_GAP;
+}
+
+// Shifts everything one column to the left and appends value
+void Sparkline::push(float value) {
+  memmove(_values, _values + 1, (SPARKLINE_WIDTH - 1) * sizeof(int16_t));
+  _values[SPARKLINE_WIDTH - 1] = encode(value);
+}
+
+// Updates the newest column in place
+void Sparkline::replace(float value) {
+  _values[SPARKLINE_WIDTH - 1] = encode(value);
+}
+
+// With all set, every span is drawn in full, for when the area was
+// damaged or the colour changed
+void Sparkline::draw(uint16_t color, uint16_t background, bool all) {
+  uint8_t top, bottom, previous = SPARKLINE_EMPTY;
+  scale();
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) {
+    uint8_t &oldTop = _top[i], &oldBottom = _bottom[i];
+    int16_t x = _x + i;
+    top = bottom = SPARKLINE_EMPTY;
+    if (_values[i] != SPARKLINE_GAP) {
+      top = bottom = row(_values[i]);
+      // Join up with the previous column
+      if (previous != SPARKLINE_EMPTY) {
+        top = min(top, previous);
+        bottom = max(bottom, previous);
+      }
+      previous = row(_values[i]);
+    } else {
+      previous = SPARKLINE_EMPTY;
+    }
+    if (!all && top == oldTop && bottom == oldBottom) continue;
+    bool overlap = top != SPARKLINE_EMPTY && oldTop != SPARKLINE_EMPTY && top <= oldBottom && bottom >= oldTop;
+    if (oldTop != SPARKLINE_EMPTY) {
+      if (!overlap) {
+        _lcd.drawFastVLine(x, _y + oldTop, oldBottom - oldTop + 1, background);
+      } else {
+        if (oldTop < top) _lcd.drawFastVLine(x, _y + oldTop, top - oldTop, background);
+        if (oldBottom > bottom) _lcd.drawFastVLine(x, _y + bottom + 1, oldBottom - bottom, background);
+      }
+    }
+    if (top != SPARKLINE_EMPTY) {
+      if (all || !overlap) {
+        _lcd.drawFastVLine(x, _y + top, bottom - top + 1, color);
+      } else {
+        if (top < oldTop) _lcd.drawFastVLine(x, _y + top, oldTop - top, color);
+        if (bottom > oldBottom) _lcd.drawFastVLine(x, _y + oldBottom + 1, bottom - oldBottom, color);
+      }
+    }
+    oldTop = top;
+    oldBottom = bottom;
+  }
+}
+
+// Fits the range to the data, rounded out to whole steps, at least two
+// steps tall
+void Sparkline::scale() {
+  int16_t low = INT16_MAX, high = INT16_MIN;
+  for (int i = 0; i < SPARKLINE_WIDTH; i++) {
+    if (_values[i] == SPARKLINE_GAP) continue;
+    low = min(low, _values[i]);
+    high = max(high, _values[i]);
+  }
+  if (low > high) return;
+  _low = (low >= 0 ? low / _step : (low - _step + 1) / _step) * _step;
+  _high = (high >= 0 ? (high + _step - 1) / _step : high / _step) * _step;
+  if (_high - _low < 2 * _step) _high = _low + 2 * _step;
+}
+
+uint8_t Sparkline::row(int16_t value) {
+  return _height - 1 - (int32_t)(value - _low) * (_height - 1) / (_high - _low);
+}
+
+int16_t Sparkline::encode(float value) {
+  if (isnan(value)) return SPARKLINE_GAP;
+  return (int16_t)constrain(roundf(value * 10), -INT16_MAX, INT16_MAX);
+}
@@ -0,0 +1,39 @@
+#ifndef SPARKLINE_h
+#define SPARKLINE_h
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define SPARKLINE_WIDTH 160
+#define SPARKLINE_GAP   INT16_MIN
+#define SPARKLINE_EMPTY 0xFF
+
+// One-pixel line graph of the last SPARKLINE_WIDTH values, one column
+// each, scaled to whole multiples of a step. The panel cannot scroll
+// sideways and reading pixels back is slow, so columns are shifted in RAM
+// and draw() only touches the pixels whose column span differs from what
+// is already on screen.
+class Sparkline {
+  public:
+    Sparkline(TFT_eSPI &lcd, int16_t x, int16_t y, uint8_t height, float step);
+    void clear();
+    void push(float value);
+    void replace(float value);
+    void draw(uint16_t color, uint16_t background, bool all);
+  private:
+    void scale();
+    uint8_t row(int16_t value);
+    static int16_t encode(float value);
+    TFT_eSPI &_lcd;
+    int16_t _x;
+    int16_t _y;
+    uint8_t _height;
+    int16_t _step;
+    int16_t _low;
+    int16_t _high;
+    int16_t _values[SPARKLINE_WIDTH];
+    uint8_t _top[SPARKLINE_WIDTH];
+    uint8_t _bottom[SPARKLINE_WIDTH];
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include "TextBuilder.h"
+
+TextBuilder::TextBuilder(char *buffer, size_t size) {
+  _buffer = buffer;
+  _size = size;
+  clear();
+}
+
+TextBuilder &TextBuilder::clear() {
+  _length = 0;
+  _overflowed = false;
+  if (_size) _buffer[0] = '\0';
+  return *this;
+}
+
+TextBuilder &TextBuilder::append(const char *text) {
+  while (text && *text) append(*text++);
+  return *this;
+}
+
+TextBuilder &TextBuilder::append(const __FlashStringHelper *text) {
+  PGM_P p = reinterpret_cast<PGM_P>(text);
+  char c;
+  while ( p && (c = pgm_read_byte(p++)) ) append(c);
+  return *this;
+}
+
+TextBuilder &TextBuilder::append(char c) {
+  if (_length + 1 < _size) {
+    _buffer[_length++] = c;
+    _buffer[_length] = '\0';
+  } else {
+    _overflowed = true;
+  }
+  return *this;
+}
+
+TextBuilder &TextBuilder::appendInt(long value) {
+  return format("%ld", value);
+}
+
+TextBuilder &TextBuilder::appendFloat(float value, uint8_t decimals) {
+  return format("%.*f", decimals, value);
+}
+
+TextBuilder &TextBuilder::format(const char *format, ...) {
+  if (_length >= _size) return *this;
+  va_list args;
+  va_start(args, format);
+  grow(vsnprintf(_buffer + _length, _size - _length, format, args));
+  va_end(args);
+  return *this;
+}
+
+void TextBuilder::grow(int written) {
+  if (written < 0) return;
+  if (_length + written < _size) {
+    _length += written;
+  } else {
+    // vsnprintf() kept what fit and terminated it
+    _length = _size ? _size - 1 : 0;
+    _overflowed = true;
+  }
+}
+
+const char *TextBuilder::c_str() const {
+  return _buffer;
+}
+
+size_t TextBuilder::length() const {
+  return _length;
+}
+
+bool TextBuilder::overflowed() const {
+  return _overflowed;
+}
@@ -0,0 +1,39 @@
+#ifndef TEXTBUILDER_h
+#define TEXTBUILDER_h
+
+#include <Arduino.h>
+
+// Appends text into a caller-owned, fixed-size buffer, always keeping it
+// NUL-terminated. Anything that does not fit is dropped and flagged, so
+// building a topic or a request body never touches the heap.
+class TextBuilder {
+  public:
+    TextBuilder(char *buffer, size_t size);
+    TextBuilder &clear();
+    TextBuilder &append(const char *text);
+    TextBuilder &append(const __FlashStringHelper *text);
+    TextBuilder &append(char c);
+    TextBuilder &appendInt(long value);
+    TextBuilder &appendFloat(float value, uint8_t decimals = 2);
+    TextBuilder &format(const char *format, ...);
+    const char *c_str() const;
+    size_t length() const;
+    bool overflowed() const;
+  private:
+    void grow(int written);
+    char *_buffer;
+    size_t _size;
+    size_t _length;
+    bool _overflowed;
+};
+
+// TextBuilder with its own storage, for use on the stack or as a global
+template <size_t N>
+class TextBuffer : public TextBuilder {
+  public:
+    TextBuffer() : TextBuilder(_storage, N) {}
+  private:
+    char _storage[N];
+};
+
+#endif
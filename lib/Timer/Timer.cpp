@@ -2,37 +2,81 @@
 #include "Timer.h"
 
 Timer::Timer() {
+  _deadline = 0;
+  _duration = 0;
   _finished = false;
 }
 
 void Timer::init(long duration) {
-    _start = millis();
-    _duration = duration;
-    _finished = false;
+  _duration = duration > 0 ? duration : 0;
+  restart();
 }
 
+// Returns the elapsed time in ms, or 0 while disabled
 long Timer::update() {
-  long elapsed;
-  long delta;
-  long ret = 0;
-  if (_duration) {
-    elapsed = millis() - _start;
-    delta = (elapsed * 100) / _duration;
-    if (!_finished) {
-      if (delta >= 100) {
-        _finished = true;
-      }
-    }
-    ret = elapsed;
-  }
-  return ret;
+  return update(millis());
+}
+
+long Timer::update(uint32_t now) {
+  if (!_duration) return 0;
+  // Latched, so a timer left unattended for weeks cannot wrap back
+  if (!_finished && (int32_t)(now - _deadline) >= 0) _finished = true;
+  return now - (_deadline - _duration);
 }
 
 void Timer::restart() {
-  _start = millis();
+  _deadline = millis() + _duration;
   _finished = false;
 }
 
 bool Timer::hasFinished() {
   return _finished;
 }
+
+bool Timer::active() {
+  return _duration != 0;
+}
+
+// Time left in ms: 0 once finished, TIMER_NEVER while disabled
+uint32_t Timer::remaining() {
+  return remaining(millis());
+}
+
+uint32_t Timer::remaining(uint32_t now) {
+  if (!_duration) return TIMER_NEVER;
+  if (_finished || (int32_t)(now - _deadline) >= 0) return 0;
+  return _deadline - now;
+}
+
+TimerGroup::TimerGroup() {
+  _count = 0;
+}
+
+bool TimerGroup::add(Timer &timer) {
+  if (_count >= TIMER_GROUP_SIZE) return false;
+  _timers[_count++] = &timer;
+  return true;
+}
+
+// Updates every timer and returns the time until the soonest one finishes
+uint32_t TimerGroup::update() {
+  return update(millis());
+}
+
+uint32_t TimerGroup::update(uint32_t now) {
+  uint32_t soonest = TIMER_NEVER;
+  for (uint8_t i = 0; i < _count; i++) {
+    _timers[i]->update(now);
+    soonest = min(soonest, _timers[i]->remaining(now));
+  }
+  return soonest;
+}
+
+uint32_t TimerGroup::remaining() {
+  uint32_t now = millis();
+  uint32_t soonest = TIMER_NEVER;
+  for (uint8_t i = 0; i < _count; i++) {
+    soonest = min(soonest, _timers[i]->remaining(now));
+  }
+  return soonest;
+}
@@ -1,17 +1,44 @@
 #ifndef TIMER_h
 #define TIMER_h
 
+#include <Arduino.h>
+
+#define TIMER_NEVER      0xFFFFFFFF
+#define TIMER_GROUP_SIZE 8
+
+// One-shot interval timer on millis(). The deadline is kept as an absolute
+// tick and compared by wraparound-safe subtraction, so it works across the
+// 49-day millis() rollover for any duration under 24 days. A duration of 0
+// disables the timer.
 class Timer {
   public:
     Timer();
     long update();
+    long update(uint32_t now);
     void restart();
     void init(long duration);
     bool hasFinished();
+    bool active();
+    uint32_t remaining();
+    uint32_t remaining(uint32_t now);
   private:
-    long _start;
-    long _duration;
+    uint32_t _deadline;
+    uint32_t _duration;
     bool _finished;
 };
 
+// Polls a set of timers against a single millis() reading and reports how
+// long until the soonest of them runs out
+class TimerGroup {
+  public:
+    TimerGroup();
+    bool add(Timer &timer);
+    uint32_t update();
+    uint32_t update(uint32_t now);
+    uint32_t remaining();
+  private:
+    Timer *_timers[TIMER_GROUP_SIZE];
+    uint8_t _count;
+};
+
 #endif
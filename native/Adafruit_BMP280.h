@@ -0,0 +1,105 @@
+#ifndef ADAFRUIT_BMP280_h
+#define ADAFRUIT_BMP280_h
+
+#include <Adafruit_Sensor.h>
+#include <Wire.h>
+
+// Reproduces the bus traffic of Adafruit_BMP280 against the fake Wire:
+// twelve 2-byte reads for the trim, one 3-byte read per channel, and
+// readPressure()/readAltitude() re-reading temperature first. The
+// firmware no longer uses it; the sim's --bench compares it with the
+// in-tree BMP280 driver.
+#define BMP280_ADDRESS (0x77)
+#define BMP280_CHIPID  (0x58)
+
+class Adafruit_BMP280 {
+  public:
+    enum sensor_sampling { SAMPLING_NONE, SAMPLING_X1, SAMPLING_X2, SAMPLING_X4, SAMPLING_X8, SAMPLING_X16 };
+    enum sensor_mode { MODE_SLEEP = 0x00, MODE_FORCED = 0x01, MODE_NORMAL = 0x03, MODE_SOFT_RESET_CODE = 0xB6 };
+    enum sensor_filter { FILTER_OFF, FILTER_X2, FILTER_X4, FILTER_X8, FILTER_X16 };
+    enum standby_duration { STANDBY_MS_1, STANDBY_MS_63, STANDBY_MS_125, STANDBY_MS_250, STANDBY_MS_500,
+                            STANDBY_MS_1000, STANDBY_MS_2000, STANDBY_MS_4000 };
+    explicit Adafruit_BMP280(TwoWire *wire = &Wire) : _wire(wire) {}
+    bool begin(uint8_t addr = BMP280_ADDRESS, uint8_t chipid = BMP280_CHIPID) {
+      _address = addr;
+      _id = read8(0xD0);
+      if (_id != chipid) return false;
+      uint16_t trim[12];
+      for (int i = 0; i < 12; i++) trim[i] = read16LE(0x88 + 2 * i);
+      _t1 = trim[0]; _t2 = trim[1]; _t3 = trim[2];
+      _p1 = trim[3]; _p2 = trim[4]; _p3 = trim[5]; _p4 = trim[6]; _p5 = trim[7];
+      _p6 = trim[8]; _p7 = trim[9]; _p8 = trim[10]; _p9 = trim[11];
+      setSampling();
+      return true;
+    }
+    uint8_t sensorID() { return _id; }
+    void setSampling(sensor_mode mode = MODE_NORMAL, sensor_sampling tempSampling = SAMPLING_X16,
+                     sensor_sampling pressSampling = SAMPLING_X16, sensor_filter filter = FILTER_OFF,
+                     standby_duration duration = STANDBY_MS_1) {
+      _control = (tempSampling << 5) | (pressSampling << 2) | mode;
+      write8(0xF5, (duration << 5) | (filter << 2));
+      write8(0xF4, _control);
+    }
+    bool takeForcedMeasurement() {
+      if ((_control & 0x03) != MODE_FORCED) return false;
+      write8(0xF4, _control);
+      while (read8(0xF3) & 0x08) delay(1);
+      return true;
+    }
+    float readTemperature() {
+      int32_t adc = read24(0xFA) >> 4;
+      int32_t var1 = ((((adc >> 3) - ((int32_t)_t1 << 1))) * (int32_t)_t2) >> 11;
+      int32_t var2 = (((((adc >> 4) - (int32_t)_t1) * ((adc >> 4) - (int32_t)_t1)) >> 12) * (int32_t)_t3) >> 14;
+      _fine = var1 + var2;
+      return ((_fine * 5 + 128) >> 8) / 100.0f;
+    }
+    float readPressure() {
+      readTemperature();
+      int32_t adc = read24(0xF7) >> 4;
+      int64_t var1 = (int64_t)_fine - 128000;
+      int64_t var2 = var1 * var1 * (int64_t)_p6;
+      var2 = var2 + ((var1 * (int64_t)_p5) << 17);
+      var2 = var2 + ((int64_t)_p4 << 35);
+      var1 = ((var1 * var1 * (int64_t)_p3) >> 8) + ((var1 * (int64_t)_p2) << 12);
+      var1 = ((((int64_t)1 << 47) + var1) * (int64_t)_p1) >> 33;
+      if (var1 == 0) return 0;
+      int64_t p = 1048576 - adc;
+      p = (((p << 31) - var2) * 3125) / var1;
+      var1 = ((int64_t)_p9 * (p >> 13) * (p >> 13)) >> 25;
+      var2 = ((int64_t)_p8 * p) >> 19;
+      p = ((p + var1 + var2) >> 8) + ((int64_t)_p7 << 4);
+      return (float)p / 256;
+    }
+    float readAltitude(float seaLevelhPa = 1013.25f) {
+      float pressure = readPressure() / 100.0f;
+      return 44330.0f * (1.0f - powf(pressure / seaLevelhPa, 0.1903f));
+    }
+  private:
+    uint32_t readBytes(uint8_t reg, uint8_t length) {
+      uint32_t value = 0;
+      _wire->beginTransmission(_address);
+      _wire->write(reg);
+      _wire->endTransmission(false);
+      _wire->requestFrom(_address, length);
+      for (uint8_t i = 0; i < length; i++) value = (value << 8) | (uint8_t)_wire->read();
+      return value;
+    }
+    uint8_t read8(uint8_t reg) { return readBytes(reg, 1); }
+    uint16_t read16LE(uint8_t reg) { uint16_t v = readBytes(reg, 2); return (v >> 8) | (v << 8); }
+    uint32_t read24(uint8_t reg) { return readBytes(reg, 3); }
+    void write8(uint8_t reg, uint8_t value) {
+      _wire->beginTransmission(_address);
+      _wire->write(reg);
+      _wire->write(value);
+      _wire->endTransmission();
+    }
+    TwoWire *_wire;
+    uint8_t _address = BMP280_ADDRESS;
+    uint8_t _id = 0;
+    uint8_t _control = 0;
+    int32_t _fine = 0;
+    uint16_t _t1 = 0, _p1 = 0;
+    int16_t _t2 = 0, _t3 = 0, _p2 = 0, _p3 = 0, _p4 = 0, _p5 = 0, _p6 = 0, _p7 = 0, _p8 = 0, _p9 = 0;
+};
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef ADAFRUIT_SENSOR_h
+#define ADAFRUIT_SENSOR_h
+
+#include <Arduino.h>
+
+typedef struct {
+  int32_t version;
+  int32_t sensor_id;
+  int32_t type;
+  int32_t reserved0;
+  int32_t timestamp;
+  union {
+    float temperature;
+    float relative_humidity;
+    float pressure;
+  };
+} sensors_event_t;
+
+#endif
@@ -0,0 +1,186 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include <new>
+
+namespace fake {
+  uint64_t now_us = 0;
+  uint32_t epoch_base = 1700000000;
+  float temperature = 24.0f;
+  float humidity = 45.0f;
+  float pressure = 1013.25f;
+  bool aht10 = false;
+  bool wifi_up = true;
+  bool broker_up = true;
+  uint32_t connect_cost_ms = 5000;
+  bool button_down = false;
+  uint64_t press_from_us = 0;
+  uint64_t press_to_us = 0;
+  uint32_t mqtt_publishes = 0;
+  uint32_t mqtt_bytes = 0;
+  uint32_t heap_allocs = 0;
+  uint64_t heap_bytes = 0;
+  uint64_t sleep_us = 0;
+  uint32_t naps = 0;
+  uint64_t flash_bytes = 0;
+  bool restarted = false;
+
+  static void (*button_isr)() = nullptr;
+
+  void advance(uint64_t us) {
+    bool fire = press_to_us && now_us < press_from_us && now_us + us >= press_from_us;
+    now_us += us;
+    if (fire && button_isr) button_isr();
+  }
+}
+
+// Count every heap allocation so runs can compare allocation churn.
+void *operator new(size_t size) {
+  fake::heap_allocs++;
+  fake::heap_bytes += size;
+  void *p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(fake::now_us / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(uint32_t)fake::now_us;
+}
+
+void delay(unsigned long ms) {
+  fake::advance((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  fake::advance(us);
+}
+
+void yield() {
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+int digitalRead(uint8_t pin) {
+  bool pressed = fake::now_us >= fake::press_from_us && fake::now_us < fake::press_to_us;
+  if (pin == D4) return fake::button_down || pressed ? LOW : HIGH;
+  return HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  (void)pin;
+  (void)value;
+}
+
+// Only the button pin has an edge source on the host.
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+  (void)mode;
+  if (pin == D4) fake::button_isr = isr;
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin == D4) fake::button_isr = nullptr;
+}
+
+void esp_schedule() {
+}
+
+static uint32_t rng_state = 0x12345678;
+
+long random(long max) {
+  if (max <= 0) return 0;
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return (long)((rng_state >> 8) % (uint32_t)max);
+}
+
+long random(long min, long max) {
+  return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+  rng_state = (uint32_t)seed;
+}
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::write(uint8_t c) {
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
+
+int Print::printf(const char *format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  write(buffer);
+  return n;
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getChipId() {
+  return 10731297;
+}
+
+uint32_t EspClass::getCycleCount() {
+  return (uint32_t)(fake::now_us * getCpuFreqMHz());
+}
+
+uint32_t EspClass::getFreeHeap() {
+  return 40000;
+}
+
+uint32_t EspClass::getMaxFreeBlockSize() {
+  return 36000;
+}
+
+uint8_t EspClass::getHeapFragmentation() {
+  return 10;
+}
+
+void EspClass::restart() {
+  fake::restarted = true;
+}
+
+const String emptyString;
+
+std::string String::fromLong(long v, unsigned char base) {
+  if (v < 0 && base == 10) return "-" + fromULong((unsigned long)-v, base);
+  return fromULong((unsigned long)v, base);
+}
+
+std::string String::fromULong(unsigned long v, unsigned char base) {
+  const char *digits = "0123456789ABCDEF";
+  std::string s;
+  if (base < 2 || base > 16) base = 10;
+  do {
+    s.insert(s.begin(), digits[v % base]);
+    v /= base;
+  } while (v);
+  return s;
+}
+
+std::string String::fromDouble(double v, unsigned char decimals) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, v);
+  return buffer;
+}
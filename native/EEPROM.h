@@ -0,0 +1,18 @@
+#ifndef EEPROM_h
+#define EEPROM_h
+
+#include <Arduino.h>
+
+class EEPROMClass {
+  public:
+    void begin(size_t size) { (void)size; }
+    uint8_t read(int address) { return address >= 0 && address < 512 ? _data[address] : 0; }
+    void write(int address, uint8_t value) { if (address >= 0 && address < 512) _data[address] = value; }
+    bool commit() { return true; }
+  private:
+    uint8_t _data[512] = {};
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
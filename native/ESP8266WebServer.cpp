@@ -0,0 +1,28 @@
+#include <ESP8266WebServer.h>
+
+void ESP8266WebServer::handleClient() {
+}
+
+String ESP8266WebServer::arg(const String &name) const {
+  auto it = _args.find(name.c_str());
+  return it == _args.end() ? String() : String(it->second);
+}
+
+void ESP8266WebServer::send(int code, const String &type, const String &content) {
+  (void)type;
+  _code = code;
+  _body += content.c_str();
+}
+
+int ESP8266WebServer::request(HTTPMethod method, const String &uri, const std::vector<std::pair<String, String>> &args) {
+  auto it = _handlers.find(uri.c_str());
+  if (it == _handlers.end()) return 404;
+  _method = method;
+  _args.clear();
+  for (const auto &arg : args) _args[arg.first.c_str()] = arg.second.c_str();
+  _contentLength = CONTENT_LENGTH_NOT_SET;
+  _code = 0;
+  _body.clear();
+  it->second();
+  return _code;
+}
@@ -0,0 +1,51 @@
+#ifndef ESP8266WEBSERVER_h
+#define ESP8266WEBSERVER_h
+
+#include <ESP8266WiFi.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+// Requests are injected by the simulation driver with request(); the
+// matching handler runs synchronously and the response is kept for
+// inspection.
+class ESP8266WebServer {
+  public:
+    typedef std::function<void(void)> THandlerFunction;
+    // The captured body is reserved up front so it does not show up as heap churn
+    explicit ESP8266WebServer(int port = 80) { (void)port; _body.reserve(8192); }
+    void on(const String &uri, THandlerFunction handler) { _handlers[uri.c_str()] = handler; }
+    void begin() {}
+    void handleClient();
+    HTTPMethod method() const { return _method; }
+    bool hasArg(const String &name) const { return _args.count(name.c_str()) > 0; }
+    String arg(const String &name) const;
+    WiFiClient &client() { return _client; }
+    void setContentLength(size_t length) { _contentLength = length; }
+    void send(int code, const String &type = String(), const String &content = String());
+    void send(int code, const __FlashStringHelper *type, const String &content) { send(code, String(type), content); }
+    void send(int code, const char *type, const char *content) { (void)type; _code = code; _body += content; }
+    void sendContent(const String &content) { _body += content.c_str(); }
+    void sendContent(const char *content, size_t size) { _body.append(content, size); }
+    void chunkedResponseModeStart(int code, const String &type) { send(code, type, String()); }
+    void chunkedResponseFinalize() {}
+
+    int request(HTTPMethod method, const String &uri, const std::vector<std::pair<String, String>> &args = {});
+    const std::string &body() const { return _body; }
+    size_t written() const { return _body.size() + _client.written(); }
+  private:
+    std::map<std::string, THandlerFunction> _handlers;
+    std::map<std::string, std::string> _args;
+    HTTPMethod _method = HTTP_GET;
+    WiFiClient _client;
+    size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+    int _code = 0;
+    std::string _body;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include <ESP8266WiFi.h>
+
+ESP8266WiFiClass WiFi;
+
+static const char *fake_ssids[] = { "home", "office", "home", "guest" };
+static const int32_t fake_rssi[] = { -71, -58, -49, -83 };
+static const uint32_t fake_scan_ms = 2200;
+
+String IPAddress::toString() const {
+  char buffer[16];
+  snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(buffer);
+}
+
+int ESP8266WiFiClass::hostByName(const char *host, IPAddress &result) {
+  (void)host;
+  if (!fake::wifi_up) return 0;
+  result = IPAddress(10, 0, 0, 2);
+  return 1;
+}
+
+// A scan takes fake_scan_ms of channel hopping; async ones finish in
+// the background and are collected through scanComplete()
+int8_t ESP8266WiFiClass::scanNetworks(bool async, bool show_hidden) {
+  (void)show_hidden;
+  if (scanComplete() == WIFI_SCAN_RUNNING) return WIFI_SCAN_RUNNING;
+  if (async) {
+    _scanResult = WIFI_SCAN_RUNNING;
+    _scanStart = millis();
+    return WIFI_SCAN_RUNNING;
+  }
+  delay(fake_scan_ms);
+  _scanResult = sizeof(fake_ssids) / sizeof(fake_ssids[0]);
+  return _scanResult;
+}
+
+int8_t ESP8266WiFiClass::scanComplete() {
+  if (_scanResult == WIFI_SCAN_RUNNING && millis() - _scanStart >= fake_scan_ms) {
+    _scanResult = sizeof(fake_ssids) / sizeof(fake_ssids[0]);
+  }
+  return _scanResult;
+}
+
+String ESP8266WiFiClass::SSID(uint8_t i) {
+  return i < 4 ? String(fake_ssids[i]) : String();
+}
+
+int32_t ESP8266WiFiClass::RSSI(uint8_t i) {
+  return i < 4 ? fake_rssi[i] : 0;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+  (void)ip;
+  (void)port;
+  if (!fake::wifi_up || !fake::broker_up) {
+    // An unanswered SYN blocks until the client's timeout, as on the core
+    delay(std::min<unsigned long>(fake::connect_cost_ms, _timeout));
+    return 0;
+  }
+  _connected = true;
+  return 1;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) {
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip)) return 0;
+  return connect(ip, port);
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+  (void)buffer;
+  _written += size;
+  return size;
+}
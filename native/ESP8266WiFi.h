@@ -0,0 +1,103 @@
+#ifndef ESP8266WIFI_h
+#define ESP8266WIFI_h
+
+#include <Arduino.h>
+
+class IPAddress {
+  public:
+    IPAddress() : _addr(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+    String toString() const;
+    bool isSet() const { return _addr != 0; }
+    operator uint32_t() const { return _addr; }
+    uint8_t operator[](int i) const { return (_addr >> (8 * i)) & 0xFF; }
+  private:
+    uint32_t _addr;
+};
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} WiFiMode_t;
+
+typedef enum {
+  WIFI_NONE_SLEEP = 0,
+  WIFI_LIGHT_SLEEP = 1,
+  WIFI_MODEM_SLEEP = 2
+} WiFiSleepType_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED  (-2)
+
+class ESP8266WiFiClass {
+  public:
+    bool mode(WiFiMode_t mode) { _mode = mode; return true; }
+    bool softAP(const String &ssid, const String &pass) { (void)ssid; (void)pass; return true; }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+    bool hostname(const String &name) { (void)name; return true; }
+    wl_status_t begin(const char *ssid, const char *pass) { (void)ssid; (void)pass; return status(); }
+    wl_status_t status() { return fake::wifi_up ? WL_CONNECTED : WL_DISCONNECTED; }
+    bool isConnected() { return status() == WL_CONNECTED; }
+    IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+    String macAddress() { return String("5C:CF:7F:A3:C0:21"); }
+    int hostByName(const char *host, IPAddress &result);
+    int8_t scanNetworks(bool async = false, bool show_hidden = false);
+    int8_t scanComplete();
+    void scanDelete() { _scanResult = WIFI_SCAN_FAILED; }
+    String SSID(uint8_t i);
+    int32_t RSSI(uint8_t i);
+    uint8_t encryptionType(uint8_t i) { return i % 2 ? 4 : 2; }
+    bool setSleepMode(WiFiSleepType_t type) { _sleep = type; return true; }
+    WiFiSleepType_t getSleepMode() { return _sleep; }
+  private:
+    WiFiMode_t _mode = WIFI_OFF;
+    WiFiSleepType_t _sleep = WIFI_MODEM_SLEEP;
+    int8_t _scanResult = WIFI_SCAN_FAILED;
+    uint32_t _scanStart = 0;
+};
+
+extern ESP8266WiFiClass WiFi;
+
+class Client : public Stream {
+  public:
+    virtual int connect(IPAddress ip, uint16_t port) = 0;
+    virtual int connect(const char *host, uint16_t port) = 0;
+    virtual uint8_t connected() = 0;
+    virtual void stop() = 0;
+    virtual operator bool() = 0;
+};
+
+class WiFiClient : public Client {
+  public:
+    WiFiClient() { setTimeout(5000); }
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(const char *host, uint16_t port) override;
+    uint8_t connected() override { return _connected && fake::broker_up; }
+    void stop() override { _connected = false; }
+    operator bool() override { return _connected; }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    void setNoDelay(bool nodelay) { (void)nodelay; }
+    size_t written() const { return _written; }
+  private:
+    bool _connected = false;
+    size_t _written = 0;
+};
+
+#endif
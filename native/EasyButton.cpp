@@ -0,0 +1,19 @@
+#include <EasyButton.h>
+
+bool EasyButton::read() {
+  uint32_t now = millis();
+  bool down = digitalRead(_pin) == LOW;
+  if (down != _current && now - _changed >= _debounce) {
+    _current = down;
+    _changed = now;
+    if (!down) {
+      if (!_heldFired && _pressed) _pressed();
+      _heldFired = false;
+    }
+  }
+  if (_current && !_heldFired && _held && now - _changed >= _heldFor) {
+    _heldFired = true;
+    _held();
+  }
+  return _current;
+}
@@ -0,0 +1,30 @@
+#ifndef EASYBUTTON_h
+#define EASYBUTTON_h
+
+#include <Arduino.h>
+
+// Mirrors EasyButton's callback semantics: onPressed fires on release,
+// onPressedFor fires once the button has been held for the given time.
+class EasyButton {
+  public:
+    typedef void (*callback_t)();
+    explicit EasyButton(uint8_t pin, uint32_t debounce = 35, bool pullup = true, bool invert = true)
+      : _pin(pin), _debounce(debounce) { (void)pullup; (void)invert; }
+    void begin() { pinMode(_pin, INPUT_PULLUP); }
+    void onPressed(callback_t callback) { _pressed = callback; }
+    void onPressedFor(uint32_t duration, callback_t callback) { _heldFor = duration; _held = callback; }
+    bool read();
+    bool isPressed() const { return _current; }
+    bool supportsInterrupt() const { return true; }
+  private:
+    uint8_t _pin;
+    uint32_t _debounce;
+    uint32_t _heldFor = 0;
+    callback_t _pressed = nullptr;
+    callback_t _held = nullptr;
+    bool _current = false;
+    bool _heldFired = false;
+    uint32_t _changed = 0;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef FAKES_h
+#define FAKES_h
+
+#include <stdint.h>
+
+// Knobs shared by the native fakes. The simulation driver (native/sim.cpp)
+// scripts these to reproduce field conditions on the host.
+namespace fake {
+
+  // Simulated monotonic clock. Only delay()/advance() move it, so a run is
+  // fully deterministic; yield() and micros() do not consume time.
+  extern uint64_t now_us;
+  void advance(uint64_t us);
+
+  // Wall-clock seconds reported by NTPClient at now_us == 0.
+  extern uint32_t epoch_base;
+
+  // Scripted environment, read by the sensor fakes.
+  extern float temperature;   // °C
+  extern float humidity;      // %RH
+  extern float pressure;      // hPa
+  extern bool aht10;          // Fit an AHT10 instead of an AHT20 at 0x38
+
+  // Network conditions.
+  extern bool wifi_up;
+  extern bool broker_up;
+  extern uint32_t connect_cost_ms;  // Time a failed TCP connect burns, capped by the client timeout
+
+  // Button on PIN_BTN_RESET, active low. A scripted press holds it down
+  // between two clock readings and fires the pin's interrupt on the way.
+  extern bool button_down;
+  extern uint64_t press_from_us;
+  extern uint64_t press_to_us;
+
+  // Bookkeeping the driver reports on.
+  extern uint32_t mqtt_publishes;
+  extern uint32_t mqtt_bytes;
+  extern uint32_t heap_allocs;
+  extern uint64_t heap_bytes;
+  extern uint64_t sleep_us;         // Time spent in esp_delay() naps
+  extern uint32_t naps;
+  extern uint64_t flash_bytes;      // Bytes written to LittleFS
+
+  // Set by ESP.restart(); the driver stops the run when it sees it.
+  extern bool restarted;
+
+}
+
+#endif
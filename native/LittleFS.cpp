@@ -0,0 +1,81 @@
+#include <LittleFS.h>
+
+fs::FS LittleFS;
+
+namespace fs {
+
+size_t File::write(const uint8_t *buffer, size_t size) {
+  if (!_data || !_writable) return 0;
+  if (_pos + size > _data->size()) _data->resize(_pos + size);
+  memcpy(_data->data() + _pos, buffer, size);
+  _pos += size;
+  fake::flash_bytes += size;
+  return size;
+}
+
+size_t File::read(uint8_t *buffer, size_t size) {
+  size_t n = std::min(size, (size_t)available());
+  if (n) memcpy(buffer, _data->data() + _pos, n);
+  _pos += n;
+  return n;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_data) return false;
+  size_t base = mode == SeekSet ? 0 : (mode == SeekCur ? _pos : _data->size());
+  if (base + pos > _data->size()) return false;
+  _pos = base + pos;
+  return true;
+}
+
+const char *File::name() const {
+  size_t slash = _name.rfind('/');
+  return slash == std::string::npos ? _name.c_str() : _name.c_str() + slash + 1;
+}
+
+File FS::open(const char *path, const char *mode) {
+  auto it = _files.find(path);
+  if (mode[0] == 'r') {
+    if (it == _files.end()) return File();
+    return File(path, it->second, mode[1] == '+', 0);
+  }
+  if (mode[0] == 'w' || it == _files.end()) {
+    _files[path] = std::make_shared<std::vector<uint8_t>>();
+    it = _files.find(path);
+  }
+  return File(path, it->second, true, mode[0] == 'a' ? it->second->size() : 0);
+}
+
+bool FS::rename(const char *from, const char *to) {
+  auto it = _files.find(from);
+  if (it == _files.end()) return false;
+  _files[to] = it->second;
+  _files.erase(it);
+  return true;
+}
+
+Dir FS::openDir(const char *path) {
+  std::string prefix(path);
+  if (prefix.empty() || prefix.back() != '/') prefix += '/';
+  std::vector<std::pair<std::string, size_t>> entries;
+  for (const auto &file : _files) {
+    if (file.first.compare(0, prefix.size(), prefix) == 0 && file.first.find('/', prefix.size()) == std::string::npos) {
+      entries.push_back({ file.first.substr(prefix.size()), file.second->size() });
+    }
+  }
+  return Dir(entries);
+}
+
+bool FS::info(FSInfo &info) {
+  size_t used = 0;
+  for (const auto &file : _files) used += ((file.second->size() + 4095) / 4096 + 1) * 4096;
+  info.totalBytes = 1024 * 1024;
+  info.usedBytes = used;
+  info.blockSize = 4096;
+  info.pageSize = 256;
+  info.maxOpenFiles = 5;
+  info.maxPathLength = 32;
+  return true;
+}
+
+}
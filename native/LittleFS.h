@@ -0,0 +1,95 @@
+#ifndef LITTLEFS_h
+#define LITTLEFS_h
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// In-memory filesystem with the fs::FS surface the firmware uses. Contents
+// live for the duration of the process.
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+typedef std::shared_ptr<std::vector<uint8_t>> FileData;
+
+class File : public Stream {
+  public:
+    File() {}
+    File(const std::string &name, FileData data, bool writable, size_t pos)
+      : _name(name), _data(data), _writable(writable), _pos(pos) {}
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    int available() override { return _data ? (int)(_data->size() - _pos) : 0; }
+    int read() override { return available() > 0 ? (*_data)[_pos++] : -1; }
+    int peek() override { return available() > 0 ? (*_data)[_pos] : -1; }
+    size_t read(uint8_t *buffer, size_t size);
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const { return _pos; }
+    size_t size() const { return _data ? _data->size() : 0; }
+    const char *name() const;
+    void close() { _data.reset(); }
+    operator bool() const { return (bool)_data; }
+  private:
+    std::string _name;
+    FileData _data;
+    bool _writable = false;
+    size_t _pos = 0;
+};
+
+class Dir {
+  public:
+    Dir() {}
+    explicit Dir(const std::vector<std::pair<std::string, size_t>> &entries) : _entries(entries) {}
+    bool next() { return ++_index < (int)_entries.size(); }
+    String fileName() const { return String(_entries[_index].first); }
+    size_t fileSize() const { return _entries[_index].second; }
+    bool isFile() const { return true; }
+  private:
+    std::vector<std::pair<std::string, size_t>> _entries;
+    int _index = -1;
+};
+
+class FS {
+  public:
+    bool begin() { return true; }
+    void end() {}
+    bool format() { _files.clear(); return true; }
+    File open(const char *path, const char *mode);
+    File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+    bool exists(const char *path) const { return _files.count(path) > 0; }
+    bool exists(const String &path) const { return exists(path.c_str()); }
+    bool remove(const char *path) { return _files.erase(path) > 0; }
+    bool remove(const String &path) { return remove(path.c_str()); }
+    bool rename(const char *from, const char *to);
+    bool mkdir(const char *path) { (void)path; return true; }
+    bool mkdir(const String &path) { return mkdir(path.c_str()); }
+    Dir openDir(const char *path);
+    Dir openDir(const String &path) { return openDir(path.c_str()); }
+    bool info(FSInfo &info);
+  private:
+    std::map<std::string, FileData> _files;
+};
+
+}
+
+using fs::File;
+using fs::Dir;
+using fs::FS;
+using fs::FSInfo;
+
+extern fs::FS LittleFS;
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef NTPCLIENT_h
+#define NTPCLIENT_h
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+// Wall time is fake::epoch_base plus the simulated clock.
+class NTPClient {
+  public:
+    explicit NTPClient(WiFiUDP &udp) { (void)udp; }
+    void begin() {}
+    bool update() { return true; }
+    bool forceUpdate() { return true; }
+    bool isTimeSet() const { return true; }
+    void setUpdateInterval(unsigned long interval) { (void)interval; }
+    void setTimeOffset(int offset) { _offset = offset; }
+    unsigned long getEpochTime() const { return fake::epoch_base + _offset + (unsigned long)(fake::now_us / 1000000); }
+    int getDay() const { return ((getEpochTime() / 86400L) + 4) % 7; }
+    int getHours() const { return (getEpochTime() % 86400L) / 3600; }
+    int getMinutes() const { return (getEpochTime() % 3600) / 60; }
+    int getSeconds() const { return getEpochTime() % 60; }
+  private:
+    int _offset = 0;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#include <PubSubClient.h>
+
+bool PubSubClient::connect(const char *id, const char *user, const char *pass) {
+  (void)id;
+  (void)user;
+  (void)pass;
+  if (!_client->connect("broker", 1883)) {
+    _state = MQTT_CONNECT_FAILED;
+    return false;
+  }
+  _state = MQTT_CONNECTED;
+  return true;
+}
+
+bool PubSubClient::connected() {
+  if (_state == MQTT_CONNECTED && !_client->connected()) {
+    _client->stop();
+    _state = MQTT_CONNECTION_LOST;
+  }
+  return _state == MQTT_CONNECTED;
+}
+
+bool PubSubClient::publish(const char *topic, const char *payload, bool retained) {
+  return publish(topic, (const uint8_t *)payload, payload ? strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained) {
+  (void)payload;
+  (void)retained;
+  if (!connected()) return false;
+  if (strlen(topic) + length + 7 > _bufferSize) return false;
+  fake::mqtt_publishes++;
+  fake::mqtt_bytes += strlen(topic) + length;
+  return true;
+}
+
+bool PubSubClient::beginPublish(const char *topic, unsigned int length, bool retained) {
+  (void)retained;
+  if (!connected()) return false;
+  fake::mqtt_publishes++;
+  fake::mqtt_bytes += strlen(topic) + length;
+  return true;
+}
+
+size_t PubSubClient::write(const uint8_t *buffer, size_t size) {
+  (void)buffer;
+  return size;
+}
+
+int PubSubClient::endPublish() {
+  return 1;
+}
@@ -0,0 +1,39 @@
+#ifndef PUBSUBCLIENT_h
+#define PUBSUBCLIENT_h
+
+#include <ESP8266WiFi.h>
+
+#define MQTT_CONNECTION_TIMEOUT     -4
+#define MQTT_CONNECTION_LOST        -3
+#define MQTT_CONNECT_FAILED         -2
+#define MQTT_DISCONNECTED           -1
+#define MQTT_CONNECTED               0
+
+// Broker availability follows fake::broker_up; publishes are counted.
+class PubSubClient {
+  public:
+    explicit PubSubClient(Client &client) : _client(&client) {}
+    PubSubClient &setServer(const char *domain, uint16_t port) { (void)domain; (void)port; return *this; }
+    PubSubClient &setServer(IPAddress ip, uint16_t port) { (void)ip; (void)port; return *this; }
+    PubSubClient &setKeepAlive(uint16_t keepAlive) { _keepAlive = keepAlive; return *this; }
+    PubSubClient &setSocketTimeout(uint16_t timeout) { (void)timeout; return *this; }
+    bool setBufferSize(uint16_t size) { _bufferSize = size; return true; }
+    uint16_t getBufferSize() const { return _bufferSize; }
+    bool connect(const char *id, const char *user, const char *pass);
+    void disconnect() { _client->stop(); _state = MQTT_DISCONNECTED; }
+    bool connected();
+    bool loop() { return connected(); }
+    int state() const { return _state; }
+    bool publish(const char *topic, const char *payload, bool retained = false);
+    bool publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained = false);
+    bool beginPublish(const char *topic, unsigned int length, bool retained);
+    size_t write(const uint8_t *buffer, size_t size);
+    int endPublish();
+  private:
+    Client *_client;
+    uint16_t _keepAlive = 15;
+    uint16_t _bufferSize = 256;
+    int _state = MQTT_DISCONNECTED;
+};
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef SPI_h
+#define SPI_h
+
+#include <Arduino.h>
+
+#endif
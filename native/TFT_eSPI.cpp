@@ -0,0 +1,289 @@
+#include <TFT_eSPI.h>
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : _width(w), _height(h) {
+  memset(_frame, 0, sizeof(_frame));
+}
+
+void TFT_eSPI::plot(int32_t x, int32_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  _frame[y * _width + x] = color;
+  _pixels++;
+}
+
+void TFT_eSPI::blend(int32_t x, int32_t y, float coverage, uint32_t fg, uint32_t bg) {
+  if (coverage <= 0.0f) return;
+  if (coverage >= 1.0f) {
+    plot(x, y, fg);
+    return;
+  }
+  uint16_t back = bg == 0x00FFFFFF ? readPixel(x, y) : (uint16_t)bg;
+  plot(x, y, alphaBlend((uint8_t)(coverage * 255), fg, back));
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  plot(x, y, color);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return _frame[y * _width + x];
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  for (int32_t j = y; j < y + h; j++) {
+    for (int32_t i = x; i < x + w; i++) plot(i, j, color);
+  }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  for (;;) {
+    plot(x0, y0, color);
+    if (x0 == x1 && y0 == y1) break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void TFT_eSPI::drawWideLine(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color) {
+  float r = wd / 2.0f;
+  int32_t x0 = (int32_t)floorf(std::min(ax, bx) - r - 1), x1 = (int32_t)ceilf(std::max(ax, bx) + r + 1);
+  int32_t y0 = (int32_t)floorf(std::min(ay, by) - r - 1), y1 = (int32_t)ceilf(std::max(ay, by) + r + 1);
+  float dx = bx - ax, dy = by - ay;
+  float len2 = dx * dx + dy * dy;
+  for (int32_t y = y0; y <= y1; y++) {
+    for (int32_t x = x0; x <= x1; x++) {
+      float t = len2 > 0 ? ((x - ax) * dx + (y - ay) * dy) / len2 : 0;
+      t = t < 0 ? 0 : (t > 1 ? 1 : t);
+      float px = ax + t * dx - x, py = ay + t * dy - y;
+      blend(x, y, r + 0.5f - sqrtf(px * px + py * py), fg_color, bg_color);
+    }
+  }
+}
+
+void TFT_eSPI::drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle,
+                             uint32_t fg_color, uint32_t bg_color, bool roundEnds) {
+  (void)roundEnds;
+  if (endAngle > 360) endAngle = 360;
+  if (startAngle >= endAngle) return;
+  for (int32_t j = y - r; j <= y + r; j++) {
+    for (int32_t i = x - r; i <= x + r; i++) {
+      float dx = i - x, dy = j - y;
+      float rho = sqrtf(dx * dx + dy * dy);
+      float coverage = std::min(rho - ir + 0.5f, r - rho + 0.5f);
+      if (coverage <= 0) continue;
+      // TFT_eSPI arcs start at 6 o'clock and run clockwise.
+      float angle = atan2f(-dx, dy) * 57.29578f;
+      if (angle < 0) angle += 360.0f;
+      if (angle < startAngle || angle >= endAngle) continue;
+      blend(i, j, coverage, fg_color, bg_color);
+    }
+  }
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+  for (int32_t j = -r; j <= r; j++) {
+    for (int32_t i = -r; i <= r; i++) {
+      if (i * i + j * j <= r * r) plot(x + i, y + j, color);
+    }
+  }
+}
+
+void TFT_eSPI::fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color) {
+  for (int32_t j = -r - 1; j <= r + 1; j++) {
+    for (int32_t i = -r - 1; i <= r + 1; i++) {
+      blend(x + i, y + j, r + 0.5f - sqrtf((float)(i * i + j * j)), color, bg_color);
+    }
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      uint16_t color = pgm_read_word(&data[j * w + i]);
+      // Images are stored as big-endian RGB565 unless the caller swaps.
+      plot(x + i, y + j, _swapBytes ? color : (uint16_t)((color >> 8) | (color << 8)));
+    }
+  }
+}
+
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) const {
+  uint32_t rxb = bgc & 0xF81F;
+  rxb += ((fgc & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+  uint32_t xgx = bgc & 0x07E0;
+  xgx += ((fgc & 0x07E0) - xgx) * alpha >> 8;
+  return (rxb & 0xF81F) | (xgx & 0x07E0);
+}
+
+uint16_t TFT_eSPI::decodeUTF8(const char *&string) {
+  uint8_t c = (uint8_t)*string++;
+  if (c < 0x80) return c;
+  if ((c & 0xE0) == 0xC0 && *string) return ((c & 0x1F) << 6) | ((uint8_t)*string++ & 0x3F);
+  if ((c & 0xF0) == 0xE0 && string[0] && string[1]) {
+    uint16_t code = ((c & 0x0F) << 12) | (((uint8_t)string[0] & 0x3F) << 6) | ((uint8_t)string[1] & 0x3F);
+    string += 2;
+    return code;
+  }
+  return c;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string, uint8_t font) {
+  (void)font;
+  int16_t width = 0;
+  if (!fontLoaded) return (int16_t)(strlen(string) * 6);
+  while (*string) {
+    uint16_t unicode = decodeUTF8(string);
+    if (unicode == 0x20) {
+      width += gFont.spaceWidth;
+      continue;
+    }
+    uint16_t gNum = 0;
+    if (getUnicodeIndex(unicode, &gNum)) {
+      if (width == 0 && gdX[gNum] < 0) width -= gdX[gNum];
+      if (*string) width += gxAdvance[gNum];
+      else width += gdX[gNum] + gWidth[gNum];
+    } else {
+      width += gFont.spaceWidth + 1;
+    }
+  }
+  return width;
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y, uint8_t font) {
+  int16_t width = textWidth(string, font);
+  if (textdatum == TC_DATUM) x -= width / 2;
+  else if (textdatum == TR_DATUM) x -= width;
+  setCursor(x, y);
+  while (*string) {
+    uint16_t unicode = decodeUTF8(string);
+    if (fontLoaded) drawGlyph(unicode);
+    else {
+      fillRect(cursor_x, cursor_y, 5, 7, textcolor);
+      cursor_x += 6;
+    }
+  }
+  return width;
+}
+
+int16_t TFT_eSPI::drawCentreString(const char *string, int32_t x, int32_t y, uint8_t font) {
+  uint8_t datum = textdatum;
+  textdatum = TC_DATUM;
+  int16_t width = drawString(string, x, y, font);
+  textdatum = datum;
+  return width;
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+  if (fontLoaded) drawGlyph(c);
+  return 1;
+}
+
+uint32_t TFT_eSPI::readInt32() {
+  uint32_t value = ((uint32_t)fontPtr[0] << 24) | ((uint32_t)fontPtr[1] << 16) | ((uint32_t)fontPtr[2] << 8) | fontPtr[3];
+  fontPtr += 4;
+  return value;
+}
+
+void TFT_eSPI::loadFont(const uint8_t array[]) {
+  if (array == nullptr) return;
+  if (fontLoaded) unloadFont();
+  fontPtr = array;
+  gFont.gArray = array;
+  gFont.gCount = (uint16_t)readInt32();
+  readInt32();
+  gFont.yAdvance = (uint16_t)readInt32();
+  readInt32();
+  gFont.ascent = (uint16_t)readInt32();
+  gFont.descent = (uint16_t)readInt32();
+  gFont.maxAscent = gFont.ascent;
+  gFont.maxDescent = gFont.descent;
+  gFont.yAdvance = gFont.ascent + gFont.descent;
+  gFont.spaceWidth = gFont.yAdvance / 4;
+  fontLoaded = true;
+
+  uint32_t bitmapPtr = 24 + (uint32_t)gFont.gCount * 28;
+  gUnicode = (uint16_t *)malloc(gFont.gCount * 2);
+  gHeight = (uint8_t *)malloc(gFont.gCount);
+  gWidth = (uint8_t *)malloc(gFont.gCount);
+  gxAdvance = (uint8_t *)malloc(gFont.gCount);
+  gdY = (int16_t *)malloc(gFont.gCount * 2);
+  gdX = (int8_t *)malloc(gFont.gCount);
+  gBitmap = (uint32_t *)malloc(gFont.gCount * 4);
+  fake::heap_allocs += 7;
+  for (uint16_t gNum = 0; gNum < gFont.gCount; gNum++) {
+    gUnicode[gNum] = (uint16_t)readInt32();
+    gHeight[gNum] = (uint8_t)readInt32();
+    gWidth[gNum] = (uint8_t)readInt32();
+    gxAdvance[gNum] = (uint8_t)readInt32();
+    gdY[gNum] = (int16_t)readInt32();
+    gdX[gNum] = (int8_t)readInt32();
+    readInt32();
+    if (((int16_t)gHeight[gNum] - (int16_t)gdY[gNum]) > (int16_t)gFont.maxDescent) {
+      if (((gUnicode[gNum] > 0x20) && (gUnicode[gNum] < 0x7F)) || (gUnicode[gNum] > 0xA0)) {
+        gFont.maxDescent = gHeight[gNum] - gdY[gNum];
+      }
+    }
+    gBitmap[gNum] = bitmapPtr;
+    bitmapPtr += gWidth[gNum] * gHeight[gNum];
+  }
+  gFont.yAdvance = gFont.maxAscent + gFont.maxDescent;
+  gFont.spaceWidth = (gFont.ascent + gFont.descent) * 2 / 7;
+}
+
+void TFT_eSPI::unloadFont() {
+  free(gUnicode); gUnicode = NULL;
+  free(gHeight); gHeight = NULL;
+  free(gWidth); gWidth = NULL;
+  free(gxAdvance); gxAdvance = NULL;
+  free(gdY); gdY = NULL;
+  free(gdX); gdX = NULL;
+  free(gBitmap); gBitmap = NULL;
+  gFont.gArray = nullptr;
+  fontLoaded = false;
+}
+
+bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index) {
+  for (uint16_t i = 0; i < gFont.gCount; i++) {
+    if (gUnicode[i] == unicode) {
+      *index = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TFT_eSPI::drawGlyph(uint16_t code) {
+  if (code == 0x20) {
+    if (_fillbg) fillRect(cursor_x, cursor_y, gFont.spaceWidth, gFont.yAdvance, textbgcolor);
+    cursor_x += gFont.spaceWidth;
+    return;
+  }
+  uint16_t gNum = 0;
+  if (!getUnicodeIndex(code, &gNum)) {
+    drawRect(cursor_x, cursor_y + gFont.maxAscent - gFont.ascent, gFont.spaceWidth, gFont.ascent, textcolor);
+    cursor_x += gFont.spaceWidth + 1;
+    return;
+  }
+  int32_t cy = cursor_y + gFont.maxAscent - gdY[gNum];
+  int32_t cx = cursor_x + gdX[gNum];
+  if (_fillbg) fillRect(cursor_x, cursor_y, gxAdvance[gNum], gFont.yAdvance, textbgcolor);
+  const uint8_t *bitmap = gFont.gArray + gBitmap[gNum];
+  for (int32_t y = 0; y < gHeight[gNum]; y++) {
+    for (int32_t x = 0; x < gWidth[gNum]; x++) {
+      uint8_t alpha = pgm_read_byte(bitmap + x + gWidth[gNum] * y);
+      if (alpha == 0xFF) plot(cx + x, cy + y, textcolor);
+      else if (alpha) plot(cx + x, cy + y, alphaBlend(alpha, textcolor, textbgcolor));
+    }
+  }
+  cursor_x += gxAdvance[gNum];
+}
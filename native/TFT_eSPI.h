@@ -0,0 +1,137 @@
+#ifndef TFT_ESPI_h
+#define TFT_ESPI_h
+
+#include <Arduino.h>
+
+#ifndef TFT_WIDTH
+  #define TFT_WIDTH  240
+#endif
+#ifndef TFT_HEIGHT
+  #define TFT_HEIGHT 240
+#endif
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_MAROON      0x7800
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_RED         0xF800
+#define TFT_YELLOW      0xFFE0
+#define TFT_ORANGE      0xFDA0
+#define TFT_WHITE       0xFFFF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+
+// In-memory RGB565 framebuffer with the TFT_eSPI drawing surface used by the
+// firmware. Every pixel written is counted as the equivalent SPI traffic so
+// host runs can compare render cost; anti-aliasing is approximated.
+class TFT_eSPI : public Print {
+  public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    void init(uint8_t tc = 0) { (void)tc; }
+    void begin(uint8_t tc = 0) { init(tc); }
+    void setRotation(uint8_t r) { (void)r; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void startWrite() {}
+    void endWrite() {}
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+    bool getSwapBytes() const { return _swapBytes; }
+
+    void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    uint16_t readPixel(int32_t x, int32_t y) const;
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void drawWideLine(float ax, float ay, float bx, float by, float wd, uint32_t fg_color, uint32_t bg_color = 0x00FFFFFF);
+    void drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t startAngle, uint32_t endAngle,
+                       uint32_t fg_color, uint32_t bg_color, bool roundEnds = false);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color = 0x00FFFFFF);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) const {
+      return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) const;
+
+    void setTextColor(uint16_t color) { textcolor = textbgcolor = color; _fillbg = false; }
+    void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false) {
+      textcolor = fgcolor; textbgcolor = bgcolor; _fillbg = bgfill;
+    }
+    void setTextDatum(uint8_t datum) { textdatum = datum; }
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    int16_t drawString(const char *string, int32_t x, int32_t y, uint8_t font = 1);
+    int16_t drawString(const String &string, int32_t x, int32_t y, uint8_t font = 1) { return drawString(string.c_str(), x, y, font); }
+    int16_t drawCentreString(const char *string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawCentreString(const String &string, int32_t x, int32_t y, uint8_t font) { return drawCentreString(string.c_str(), x, y, font); }
+    int16_t textWidth(const char *string, uint8_t font = 1);
+    int16_t textWidth(const String &string, uint8_t font = 1) { return textWidth(string.c_str(), font); }
+    int16_t fontHeight(int16_t font = 1) { (void)font; return fontLoaded ? gFont.yAdvance : 8; }
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    // Smooth (VLW) font support, laid out like TFT_eSPI's Smooth_font.h.
+    void loadFont(const uint8_t array[]);
+    void unloadFont();
+    bool getUnicodeIndex(uint16_t unicode, uint16_t *index);
+    void drawGlyph(uint16_t code);
+
+    typedef struct {
+      const uint8_t *gArray;
+      uint16_t gCount;
+      uint16_t yAdvance;
+      uint16_t spaceWidth;
+      int16_t ascent;
+      int16_t descent;
+      uint16_t maxAscent;
+      uint16_t maxDescent;
+    } fontMetrics;
+
+    fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
+    uint16_t *gUnicode = NULL;
+    uint8_t *gHeight = NULL;
+    uint8_t *gWidth = NULL;
+    uint8_t *gxAdvance = NULL;
+    int16_t *gdY = NULL;
+    int8_t *gdX = NULL;
+    uint32_t *gBitmap = NULL;
+    bool fontLoaded = false;
+
+    // Fake-only instrumentation.
+    const uint16_t *frame() const { return _frame; }
+    uint32_t pixels() const { return _pixels; }
+    void resetPixels() { _pixels = 0; }
+
+  protected:
+    int32_t cursor_x = 0, cursor_y = 0;
+    uint32_t textcolor = 0xFFFF, textbgcolor = 0;
+    uint8_t textdatum = TL_DATUM;
+    bool _fillbg = false;
+
+  private:
+    uint32_t readInt32();
+    void plot(int32_t x, int32_t y, uint16_t color);
+    void blend(int32_t x, int32_t y, float coverage, uint32_t fg, uint32_t bg);
+    uint16_t decodeUTF8(const char *&string);
+
+    int16_t _width, _height;
+    uint16_t _frame[TFT_WIDTH * TFT_HEIGHT];
+    uint32_t _pixels = 0;
+    bool _swapBytes = false;
+    const uint8_t *fontPtr = nullptr;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef WSTRING_h
+#define WSTRING_h
+
+#include <stdint.h>
+#include <string>
+
+class __FlashStringHelper;
+
+class String {
+  public:
+    String() {}
+    String(const char *s) : _s(s ? s : "") {}
+    String(const __FlashStringHelper *s) : _s(reinterpret_cast<const char *>(s)) {}
+    String(const std::string &s) : _s(s) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(int v, unsigned char base = 10) : _s(fromLong(v, base)) {}
+    explicit String(unsigned int v, unsigned char base = 10) : _s(fromULong(v, base)) {}
+    explicit String(long v, unsigned char base = 10) : _s(fromLong(v, base)) {}
+    explicit String(unsigned long v, unsigned char base = 10) : _s(fromULong(v, base)) {}
+    explicit String(float v, unsigned char decimals = 2) : _s(fromDouble(v, decimals)) {}
+    explicit String(double v, unsigned char decimals = 2) : _s(fromDouble(v, decimals)) {}
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned int length() const { return _s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    void reserve(unsigned int size) { _s.reserve(size); }
+    long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_s.c_str(), nullptr); }
+    int indexOf(char c) const { size_t p = _s.find(c); return p == std::string::npos ? -1 : (int)p; }
+    String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const { return from < _s.size() ? String(_s.substr(from, to - from)) : String(); }
+    bool concat(const String &s) { _s += s._s; return true; }
+    bool concat(const char *s) { _s += s; return true; }
+    bool concat(char c) { _s += c; return true; }
+
+    char operator[](unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+    char &operator[](unsigned int i) { return _s[i]; }
+    String &operator+=(const String &s) { _s += s._s; return *this; }
+    String &operator+=(const char *s) { _s += s; return *this; }
+    String &operator+=(char c) { _s += c; return *this; }
+    bool operator==(const String &s) const { return _s == s._s; }
+    bool operator==(const char *s) const { return _s == s; }
+    bool operator!=(const String &s) const { return _s != s._s; }
+    bool operator!=(const char *s) const { return _s != s; }
+    bool operator<(const String &s) const { return _s < s._s; }
+
+    friend String operator+(const String &a, const String &b) { return String(a._s + b._s); }
+    friend String operator+(const String &a, const char *b) { return String(a._s + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b._s); }
+    friend String operator+(const String &a, char b) { return String(a._s + b); }
+
+  private:
+    static std::string fromLong(long v, unsigned char base);
+    static std::string fromULong(unsigned long v, unsigned char base);
+    static std::string fromDouble(double v, unsigned char decimals);
+    std::string _s;
+};
+
+// Only needed as a type: ArduinoJson's String adapter names it
+class StringSumHelper : public String {
+  public:
+    StringSumHelper(const String &s) : String(s) {}
+};
+
+extern const String emptyString;
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef WIFICLIENT_h
+#define WIFICLIENT_h
+
+#include <ESP8266WiFi.h>
+
+#endif
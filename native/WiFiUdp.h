@@ -0,0 +1,12 @@
+#ifndef WIFIUDP_h
+#define WIFIUDP_h
+
+#include <ESP8266WiFi.h>
+
+class WiFiUDP {
+  public:
+    uint8_t begin(uint16_t port) { (void)port; return 1; }
+    void stop() {}
+};
+
+#endif
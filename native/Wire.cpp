@@ -0,0 +1,144 @@
+#include <Wire.h>
+
+TwoWire Wire;
+
+#define BMP280_CONVERSION_US 43000
+#define AHT20_CONVERSION_US  75000
+
+// Calibration trim from the BMP280 datasheet's worked example
+static const uint16_t bmp_t1 = 27504;
+static const int16_t bmp_t2 = 26435, bmp_t3 = -1000;
+static const uint16_t bmp_p1 = 36477;
+static const int16_t bmp_p2 = -10685, bmp_p3 = 3024, bmp_p4 = 2855, bmp_p5 = 140, bmp_p6 = -7,
+                     bmp_p7 = 15500, bmp_p8 = -14600, bmp_p9 = 6000;
+
+// Datasheet floating-point compensation, inverted by bisection below
+static double bmp_fine(int32_t adc) {
+  double var1 = (adc / 16384.0 - bmp_t1 / 1024.0) * bmp_t2;
+  double var2 = (adc / 131072.0 - bmp_t1 / 8192.0) * (adc / 131072.0 - bmp_t1 / 8192.0) * bmp_t3;
+  return var1 + var2;
+}
+
+static double bmp_pressure(int32_t adc, double fine) {
+  double var1 = fine / 2.0 - 64000.0;
+  double var2 = var1 * var1 * bmp_p6 / 32768.0;
+  var2 = var2 + var1 * bmp_p5 * 2.0;
+  var2 = var2 / 4.0 + bmp_p4 * 65536.0;
+  var1 = (bmp_p3 * var1 * var1 / 524288.0 + bmp_p2 * var1) / 524288.0;
+  var1 = (1.0 + var1 / 32768.0) * bmp_p1;
+  double p = 1048576.0 - adc;
+  p = (p - var2 / 4096.0) * 6250.0 / var1;
+  var1 = bmp_p9 * p * p / 2147483648.0;
+  var2 = p * bmp_p8 / 32768.0;
+  return p + (var1 + var2 + bmp_p7) / 16.0;
+}
+
+// Raw temperature and pressure for the scripted environment; the board
+// runs 2.5 °C warm, as the AHT20 fake does
+static void bmp_raw(int32_t &adcT, int32_t &adcP) {
+  int32_t low = 0, high = 1 << 20;
+  while (high - low > 1) {
+    int32_t mid = (low + high) / 2;
+    if (bmp_fine(mid) / 5120.0 <= fake::temperature + 2.5) low = mid; else high = mid;
+  }
+  adcT = low;
+  double fine = bmp_fine(adcT);
+  low = 0, high = 1 << 20;
+  while (high - low > 1) {
+    int32_t mid = (low + high) / 2;
+    if (bmp_pressure(mid, fine) >= fake::pressure * 100.0) low = mid; else high = mid;
+  }
+  adcP = low;
+}
+
+static uint8_t bmp_register(uint8_t reg, uint8_t control, uint8_t config, bool busy) {
+  static const uint16_t trim[12] = { bmp_t1, (uint16_t)bmp_t2, (uint16_t)bmp_t3, bmp_p1, (uint16_t)bmp_p2,
+                                     (uint16_t)bmp_p3, (uint16_t)bmp_p4, (uint16_t)bmp_p5, (uint16_t)bmp_p6,
+                                     (uint16_t)bmp_p7, (uint16_t)bmp_p8, (uint16_t)bmp_p9 };
+  if (reg >= 0x88 && reg < 0x88 + 24) {
+    uint16_t word = trim[(reg - 0x88) / 2];
+    return (reg - 0x88) % 2 ? word >> 8 : word & 0xFF;
+  }
+  if (reg >= 0xF7 && reg <= 0xFC) {
+    int32_t adcT, adcP;
+    bmp_raw(adcT, adcP);
+    int32_t adc = reg < 0xFA ? adcP : adcT;
+    switch ((reg - 0xF7) % 3) {
+      case 0: return adc >> 12;
+      case 1: return adc >> 4;
+      default: return (adc & 0x0F) << 4;
+    }
+  }
+  switch (reg) {
+    case 0xD0: return 0x58;
+    case 0xF3: return busy ? 0x08 : 0x00;
+    case 0xF4: return control;
+    case 0xF5: return config;
+  }
+  return 0x00;
+}
+
+static uint8_t aht_crc(const uint8_t *data, uint8_t length) {
+  uint8_t crc = 0xFF;
+  for (uint8_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) crc = crc & 0x80 ? (crc << 1) ^ 0x31 : crc << 1;
+  }
+  return crc;
+}
+
+uint8_t TwoWire::endTransmission(bool stop) {
+  (void)stop;
+  _bytes += _txLength + 1;
+  _transactions++;
+  switch (_address) {
+    case 0x77:
+      if (_txLength > 0) _register = _tx[0];
+      if (_txLength > 1 && _tx[0] == 0xF5) _config = _tx[1];
+      if (_txLength > 1 && _tx[0] == 0xF4) {
+        _control = _tx[1];
+        if ((_tx[1] & 0x03) == 0x01) _bmpReady = fake::now_us + BMP280_CONVERSION_US;
+      }
+      return 0;
+    case 0x38:
+      if (_txLength > 0 && _tx[0] == 0xAC) _ahtReady = fake::now_us + AHT20_CONVERSION_US;
+      // The AHT10 NACKs the AHT20's initialization command
+      if (fake::aht10 && _txLength > 0 && _tx[0] == 0xBE) return 2;
+      return 0;
+  }
+  return 2;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, bool stop) {
+  (void)stop;
+  _rxLength = 0;
+  _rxIndex = 0;
+  switch (address) {
+    case 0x77:
+      // Burst reads auto-increment the register pointer
+      while (_rxLength < quantity && _rxLength < sizeof(_rx)) {
+        _rx[_rxLength] = bmp_register(_register + _rxLength, _control, _config, fake::now_us < _bmpReady);
+        _rxLength++;
+      }
+    break;
+    case 0x38:
+    {
+      uint32_t h = (uint32_t)(fake::humidity / 100.0f * 1048576);
+      uint32_t t = (uint32_t)((fake::temperature + 2.5f + 50) / 200.0f * 1048576);
+      _rx[0] = fake::now_us < _ahtReady ? 0x98 : 0x18;
+      _rx[1] = h >> 12;
+      _rx[2] = h >> 4;
+      _rx[3] = ((h & 0x0F) << 4) | ((t >> 16) & 0x0F);
+      _rx[4] = t >> 8;
+      _rx[5] = t;
+      // The AHT10 sends no CRC; clocking on past the frame reads 0xFF
+      _rx[6] = fake::aht10 ? 0xFF : aht_crc(_rx, 6);
+      _rxLength = 7;
+    }
+    break;
+  }
+  if (_rxLength > quantity) _rxLength = quantity;
+  _bytes += _rxLength + 1;
+  _transactions++;
+  return _rxLength;
+}
@@ -0,0 +1,42 @@
+#ifndef WIRE_h
+#define WIRE_h
+
+#include <Arduino.h>
+
+// Answers for the two sensors on the bus: a BMP280 at 0x77 (chip id,
+// calibration trim, control, status and the 6 data registers, holding raw
+// values that compensate back to the scripted environment) and an AHT20
+// at 0x38 (trigger, then a status byte, 5 data bytes and the CRC).
+// Conversions take simulated time, so reading early reports busy. bytes()
+// and transactions() count bus traffic, addresses included.
+class TwoWire {
+  public:
+    void begin() {}
+    void setClock(uint32_t frequency) { (void)frequency; }
+    void beginTransmission(uint8_t address) { _address = address; _txLength = 0; }
+    size_t write(uint8_t data) { if (_txLength < sizeof(_tx)) _tx[_txLength++] = data; return 1; }
+    uint8_t endTransmission(bool stop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, bool stop = true);
+    int available() { return _rxLength - _rxIndex; }
+    int read() { return _rxIndex < _rxLength ? _rx[_rxIndex++] : -1; }
+    uint32_t bytes() const { return _bytes; }
+    uint32_t transactions() const { return _transactions; }
+  private:
+    uint8_t _address = 0;
+    uint8_t _tx[16];
+    uint8_t _txLength = 0;
+    uint8_t _rx[32];
+    uint8_t _rxLength = 0;
+    uint8_t _rxIndex = 0;
+    uint32_t _bytes = 0;
+    uint32_t _transactions = 0;
+    uint64_t _bmpReady = 0;
+    uint64_t _ahtReady = 0;
+    uint8_t _register = 0;
+    uint8_t _control = 0;
+    uint8_t _config = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
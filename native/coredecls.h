@@ -0,0 +1,21 @@
+#ifndef COREDECLS_h
+#define COREDECLS_h
+
+#include <Arduino.h>
+
+// Host stand-in for the core's cooperative delay. esp_delay() sleeps until
+// the timeout or until blocked() turns false, which on the device is
+// rechecked whenever esp_schedule() wakes the loop task. The time spent is
+// booked as sleep.
+void esp_schedule();
+
+template <typename T>
+void esp_delay(uint32_t timeout_ms, T &&blocked) {
+  fake::naps++;
+  for (uint32_t i = 0; i < timeout_ms && blocked(); i++) {
+    fake::advance(1000);
+    fake::sleep_us += 1000;
+  }
+}
+
+#endif
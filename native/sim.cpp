@@ -0,0 +1,153 @@
+// Host entry point for [env:native]: boots the firmware against the fakes
+// and runs loop() over simulated time, then reports what it cost.
+//
+//   .pio/build/native/program [--seconds N] [--broker-down] [--outage FROM:TO] [--press AT] [--setup] [--aht10] [--config JSON]
+//   .pio/build/native/program --bench N
+//
+// --outage takes the broker down between two offsets, in seconds. --press
+// taps the button for 200 ms at an offset, in seconds. --aht10 fits the
+// older humidity sensor, which has no CRC. --bench compares N
+// BMP280 readouts through the Adafruit driver and the in-tree one instead
+// of running the firmware.
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_BMP280.h>
+#include "BMP280.h"
+#include <EEPROM.h>
+#include <LittleFS.h>
+#include <TFT_eSPI.h>
+#include "main.h"
+
+extern TFT_eSPI lcd;
+
+static const char *device_config = "{\"timeOffset\":0,\"brightness\":8,\"updateInterval\":60000,\"apiKey\":\"key\",\"apiToken\":\"token\"}";
+
+static void provision() {
+  const char *ssid = "home";
+  const char *password = "password";
+  const char *uid = "device-uid";
+  for (size_t i = 0; i < strlen(ssid); i++) EEPROM.write(i, ssid[i]);
+  for (size_t i = 0; i < strlen(password); i++) EEPROM.write(32 + i, password[i]);
+  for (size_t i = 0; i < strlen(uid); i++) EEPROM.write(96 + i, uid[i]);
+  File file = LittleFS.open("/config.json", "w");
+  file.print(device_config);
+  file.close();
+}
+
+// The ESP8266 drives I2C in software, so the CPU is busy for the whole
+// transfer: 9 bit times per byte at the default 100 kHz
+#define BENCH_I2C_HZ     100000
+#define BENCH_CPU_MHZ    80
+
+static void bench_row(const char *name, uint32_t samples, uint32_t transactions, uint32_t bytes) {
+  double per = bytes / (double)samples;
+  printf("%-16s %6.1f %6.1f %9.0f\n", name, transactions / (double)samples, per,
+         per * 9 * BENCH_CPU_MHZ * (1000000.0 / BENCH_I2C_HZ));
+}
+
+// Readout after a finished forced conversion: the old update_sensor_data()
+// called readPressure() and readAltitude(), the driver does one read()
+static void bench(uint32_t samples) {
+  Adafruit_BMP280 reference;
+  BMP280 driver;
+  uint32_t transactions, bytes;
+  printf("--- BMP280 readout, %u samples ---\n", samples);
+  printf("%-16s %6s %6s %9s\n", "", "xfers", "bytes", "cycles");
+  transactions = Wire.transactions();
+  bytes = Wire.bytes();
+  reference.begin();
+  bench_row("begin (Adafruit)", 1, Wire.transactions() - transactions, Wire.bytes() - bytes);
+  transactions = Wire.transactions();
+  bytes = Wire.bytes();
+  driver.begin();
+  bench_row("begin (BMP280)", 1, Wire.transactions() - transactions, Wire.bytes() - bytes);
+  reference.setSampling(Adafruit_BMP280::MODE_FORCED, Adafruit_BMP280::SAMPLING_X2, Adafruit_BMP280::SAMPLING_X16);
+  driver.setSampling(BMP280::MODE_FORCED, BMP280::SAMPLING_X2, BMP280::SAMPLING_X16);
+  float error = 0;
+  transactions = bytes = 0;
+  for (uint32_t i = 0; i < samples; i++) {
+    fake::pressure = 990.0f + i % 50;
+    reference.takeForcedMeasurement();
+    uint32_t t = Wire.transactions(), b = Wire.bytes();
+    reference.readPressure();
+    reference.readAltitude(1013.25f);
+    transactions += Wire.transactions() - t;
+    bytes += Wire.bytes() - b;
+  }
+  bench_row("Adafruit_BMP280", samples, transactions, bytes);
+  transactions = bytes = 0;
+  for (uint32_t i = 0; i < samples; i++) {
+    fake::pressure = 990.0f + i % 50;
+    driver.takeForcedMeasurement();
+    uint32_t t = Wire.transactions(), b = Wire.bytes();
+    driver.read();
+    transactions += Wire.transactions() - t;
+    bytes += Wire.bytes() - b;
+    error = std::max(error, fabsf(driver.pressure() / 256.0f - fake::pressure * 100.0f));
+  }
+  bench_row("BMP280", samples, transactions, bytes);
+  printf("largest pressure error: %.2f Pa\n", error);
+}
+
+int main(int argc, char **argv) {
+  uint32_t seconds = 600;
+  bool setup_mode = false;
+  uint32_t outage_from = 0, outage_to = 0;
+  uint32_t press_at = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--broker-down")) fake::broker_up = false;
+    else if (!strcmp(argv[i], "--outage") && i + 1 < argc) sscanf(argv[++i], "%u:%u", &outage_from, &outage_to);
+    else if (!strcmp(argv[i], "--press") && i + 1 < argc) press_at = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--setup")) setup_mode = true;
+    else if (!strcmp(argv[i], "--aht10")) fake::aht10 = true;
+    else if (!strcmp(argv[i], "--config") && i + 1 < argc) device_config = argv[++i];
+    else if (!strcmp(argv[i], "--bench") && i + 1 < argc) {
+      bench(atoi(argv[++i]));
+      return 0;
+    }
+  }
+  if (!setup_mode) provision();
+
+  setup();
+  uint32_t boot_pixels = lcd.pixels();
+  uint32_t boot_allocs = fake::heap_allocs;
+  uint64_t boot_bytes = fake::heap_bytes;
+  uint64_t boot_flash = fake::flash_bytes;
+  uint64_t start = fake::now_us;
+  uint64_t end = start + (uint64_t)seconds * 1000000;
+  uint64_t boot_sleep = fake::sleep_us;
+  uint32_t boot_naps = fake::naps;
+  if (press_at) {
+    fake::press_from_us = start + (uint64_t)press_at * 1000000;
+    fake::press_to_us = fake::press_from_us + 200000;
+  }
+  uint32_t iterations = 0;
+  uint64_t worst = 0;
+  lcd.resetPixels();
+  while (fake::now_us < end && !fake::restarted) {
+    uint64_t before = fake::now_us;
+    uint64_t slept = fake::sleep_us;
+    if (outage_to) {
+      uint64_t offset = (fake::now_us - start) / 1000000;
+      fake::broker_up = offset < outage_from || offset >= outage_to;
+    }
+    loop();
+    // Account for the bare cost of one loop() pass on the device.
+    fake::advance(1000);
+    // Naps are idle time, not latency.
+    worst = std::max(worst, fake::now_us - before - (fake::sleep_us - slept));
+    iterations++;
+  }
+
+  printf("\n--- native run: %u s simulated ---\n", seconds);
+  printf("boot:         %u px, %u allocs\n", boot_pixels, boot_allocs);
+  printf("iterations:   %u\n", iterations);
+  printf("worst loop:   %.1f ms\n", worst / 1000.0);
+  printf("pixels:       %u (%.1f per s)\n", lcd.pixels(), lcd.pixels() / (double)seconds);
+  printf("allocations:  %u (%llu bytes)\n", fake::heap_allocs - boot_allocs, (unsigned long long)(fake::heap_bytes - boot_bytes));
+  printf("publishes:    %u (%u bytes)\n", fake::mqtt_publishes, fake::mqtt_bytes);
+  printf("flash writes: %llu bytes\n", (unsigned long long)(fake::flash_bytes - boot_flash));
+  printf("asleep:       %.1f%% (%u naps)\n", 100.0 * (fake::sleep_us - boot_sleep) / (double)(fake::now_us - start), fake::naps - boot_naps);
+  return 0;
+}
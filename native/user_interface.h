@@ -0,0 +1,22 @@
+#ifndef USER_INTERFACE_h
+#define USER_INTERFACE_h
+
+#include <Arduino.h>
+
+// Host stand-in for the parts of the Non-OS SDK the firmware calls.
+
+#define GPIO_ID_PIN(n) (n)
+
+typedef enum {
+  GPIO_PIN_INTR_DISABLE = 0,
+  GPIO_PIN_INTR_POSEDGE = 1,
+  GPIO_PIN_INTR_NEGEDGE = 2,
+  GPIO_PIN_INTR_ANYEDGE = 3,
+  GPIO_PIN_INTR_LOLEVEL = 4,
+  GPIO_PIN_INTR_HILEVEL = 5
+} GPIO_INT_TYPE;
+
+inline void gpio_pin_wakeup_enable(uint32_t pin, GPIO_INT_TYPE state) { (void)pin; (void)state; }
+inline void gpio_pin_wakeup_disable() {}
+
+#endif
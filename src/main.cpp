@@ -6,6 +6,8 @@
  */
 #include "main.h"
 #include <ESP8266WiFi.h>
+#include <coredecls.h>
+#include <user_interface.h>
 #include <ESP8266HTTPClient.h>
 #include <WiFiClient.h>
 #include <ArduinoJson.h>
@@ -14,9 +16,8 @@
 #include <EasyButton.h>
 #include <Wire.h>
 #include <SPI.h>
-#include <Adafruit_Sensor.h>
-#include <Adafruit_BMP280.h>
-#include <Adafruit_AHTX0.h>
+#include "BMP280.h"
+#include "AHT20.h"
 #include <NTPClient.h>
 #include <ESP8266WiFi.h>
 #include <WiFiUdp.h>
@@ -24,11 +25,29 @@
 #include <LittleFS.h>
 #include <TFT_eSPI.h>
 #include <PubSubClient.h>
+#include "Renderer.h"
+#include "FontManager.h"
+#include "GlyphAtlas.h"
+#include "ClockGeometry.h"
+#include "Profiler.h"
+#include "MqttLink.h"
+#include "TextBuilder.h"
+#include "Sampler.h"
+#include "History.h"
+#include "SampleLog.h"
+#include "Sparkline.h"
+#include "Scheduler.h"
+#include "Deadband.h"
+#include "AdaptiveRate.h"
+#include "HeatIndex.h"
+#include "ResponseStream.h"
+#include "ScanCache.h"
 
 #include "NotoSans_Regular16pt7b.h"
 #include "NotoSans_Regular24pt7b.h"
 #include "NotoSans_Regular42pt7b.h"
 #include "Sansation_Regular24.h"
+#include "ClockDigits.h"
 
 // The font names are arrays references, thus must NOT be in quotes ""
 #define AA_FONT_SMALL  NotoSansBold16
@@ -36,6 +55,11 @@
 #define AA_FONT_LARGE  NotoSansBold42
 #define AA_FONT_VECODE SansationRegular24
 
+#define FONT_SMALL  0
+#define FONT_MEDIUM 1
+#define FONT_LARGE  2
+#define FONT_VECODE 3
+
 #define TFT_DARKERGREY  0x31A6
 #define TFT_DARKESTGREY 0x18E3
 
@@ -57,6 +81,31 @@
 #define MODE_PRESSURE 3
 #define MODE_REBOOT   4
 #define MODE_RESET    5
+#define MODE_TREND    6
+
+#define SLOT_RING    0
+#define SLOT_ARC     1
+#define SLOT_HOUR    2
+#define SLOT_MINUTE  3
+#define SLOT_LABEL   4
+#define SLOT_VALUE   5
+#define SLOT_CAPTION 6
+#define SLOT_STATUS  7
+#define SLOT_PLOT    8
+#define SLOT_SECOND  9
+
+#define PROFILE_LOOP            0
+#define PROFILE_RENDER_CLOCK    1
+#define PROFILE_RENDER_TEMP     2
+#define PROFILE_RENDER_HUMIDITY 3
+#define PROFILE_RENDER_PRESSURE 4
+#define PROFILE_RENDER_PROMPT   5
+#define PROFILE_SENSORS         6
+#define PROFILE_PUBLISH         7
+#define PROFILE_CONNECT         8
+#define PROFILE_HTTP            9
+#define PROFILE_RENDER_TREND   10
+#define PROFILE_COUNT          11
 
 #define PIN_BTN_RESET D4
 
@@ -68,20 +117,66 @@
 
 #define SEALEVELPRESSURE_HPA (1013.25)
 
+#define HISTORY_PAGE 16   // Points per HISTORY response, sized to fit the response document
+
+#define CLOCK_FPS_MAX 10   // Frame rate cap for the sweeping second hand
+
+#define TREND_MINUTES 3   // History minutes per sparkline column
+
+#define BACKLOG_BATCH    4     // Samples per replay message, sized to fit the default MQTT buffer
+#define BACKLOG_INTERVAL 250   // ms between replay messages
+
+#define REPORT_TEMPERATURE 0
+#define REPORT_HEAT_INDEX  1
+#define REPORT_PRESSURE    2
+#define REPORT_ALTITUDE    3
+#define REPORT_HUMIDITY    4
+#define REPORT_CHANNELS    5
+#define REPORT_HEARTBEAT   900000   // ms; default longest silence for a channel
+
+#define SAMPLE_MIN 10000   // ms; default shortest sampling interval
+
+#define MQTT_BUFFER       255    // PubSubClient's default packet buffer
+#define MQTT_BUFFER_STATS 1024   // Fits a stats report in the reply buffer
+
+#define CONFIG_JSON_SIZE 1024   // Fits the per-channel deadband and heartbeat objects
+#define RESPONSE_JSON_SIZE 2048   // Fits a full scan list, STATS or a HISTORY page
+#define RESPONSE_BLOCK 256   // Bytes per write while streaming a response
+
+#define POLL_NETWORK 100   // ms between web server, broker and NTP polls
+#define POLL_SWEEP   20    // ms between clock polls while the second hand sweeps
+#define POLL_SAMPLER 10    // ms between sensor polls during a conversion
+#define IDLE_NAP_MIN 2     // ms; shorter waits are not worth a light-sleep entry
+
+#define SCAN_STALE 30000   // ms; an older scan list is refreshed when requested
+
 struct Config {
   int brightness;
   int timeOffset;
   int updateInterval;
+  int sampleMin;
+  int sampleMax;
+  int statsInterval;
+  bool batchTelemetry;
+  int secondHand;
+  bool idleSleep;
+  float deadband[REPORT_CHANNELS];
+  int heartbeat[REPORT_CHANNELS];
   String apiKey;
   String apiToken;
 };
 
 Config config;
 
+const char *report_names[REPORT_CHANNELS] = { "temperature", "heat_index", "pressure", "altitude", "humidity" };
+const float report_bands[REPORT_CHANNELS] = { 0.1, 0.1, 0.1, 1.0, 0.5 };
+
 int state = STATE_IDLE;
 int mode = MODE_UNSET;
 bool is_reset = false;
 bool update = true;
+volatile bool button_woken = false;
+uint8_t broker_state = MQTT_LINK_IDLE;
 
 float temp, pressure, altitude, humidity, heat_index;
 
@@ -96,16 +191,44 @@ String device_version;
 String device_serial;
 String device_mac;
 
-Timer timer_read, timer_mode;
+char topic_prefix[24];
+char reply[1024];
+StaticJsonDocument<RESPONSE_JSON_SIZE> response;   // XHR replies and stats; never used nested
+uint32_t heap_low = 0xFFFFFFFF;
+
+Timer timer_read, timer_mode, timer_stats, timer_backlog, timer_frame;
 EasyButton button_reset(PIN_BTN_RESET);
 ESP8266WebServer server(80);
 WiFiClient client;
-Adafruit_BMP280 bmp;
-Adafruit_AHTX0 aht;
+BMP280 bmp;
+AHT20 aht;
+Sampler sampler(bmp, aht);
+History history;
+SampleLog backlog(LittleFS, "/log");
+ScanCache scans;
+uint32_t trend_column = 0;
+int second_last = -1;
+uint32_t second_start = 0;
 WiFiUDP ntpUDP;
 NTPClient timeClient(ntpUDP);
 TFT_eSPI lcd = TFT_eSPI();
 PubSubClient pubsub(client);
+MqttLink broker(pubsub, client);
+Renderer renderer(lcd, TFT_BLACK);
+FontManager fonts(lcd);
+ClockGeometry face(120, 120, 114, 100);
+Sparkline trend(lcd, 40, 100, 56, 1.0f);
+GlyphAtlas digits(lcd, clock_digits_glyphs, CLOCK_DIGITS_COUNT, clock_digits_spans, CLOCK_DIGITS_ASCENT);
+
+const char *profile_names[PROFILE_COUNT] = {
+  "loop", "render_clock", "render_temp", "render_humidity", "render_pressure",
+  "render_prompt", "sensors", "publish", "connect", "http", "render_trend"
+};
+Profiler profiler(profile_names, PROFILE_COUNT);
+Scheduler scheduler;
+Deadband deadbands;
+AdaptiveRate sampling;
+int8_t input_task, clock_task, collect_task, render_task;
 
 void setup() {
   delay(200);
@@ -127,43 +250,47 @@ void setup() {
     while (1) delay(10);
   }
   // Default settings from datasheet.
-  bmp.setSampling(Adafruit_BMP280::MODE_FORCED,     /* Operating Mode. */
-                  Adafruit_BMP280::SAMPLING_X2,     /* Temp. oversampling */
-                  Adafruit_BMP280::SAMPLING_X16,    /* Pressure oversampling */
-                  Adafruit_BMP280::FILTER_X16,      /* Filtering. */
-                  Adafruit_BMP280::STANDBY_MS_500); /* Standby time. */
+  bmp.setSampling(BMP280::MODE_FORCED,     /* Operating Mode. */
+                  BMP280::SAMPLING_X2,     /* Temp. oversampling */
+                  BMP280::SAMPLING_X16,    /* Pressure oversampling */
+                  BMP280::FILTER_X16,      /* Filtering. */
+                  BMP280::STANDBY_MS_500); /* Standby time. */
+  sampler.begin();
   //
   if (! aht.begin()) {
     Serial.println("Could not find AHT? Check wiring");
     while (1) delay(10);
   }
-  Serial.println("AHT10 or AHT20 found");
+  Serial.println(aht.aht10() ? "AHT10 found" : "AHT20 found");
   //
   button_reset.begin();
   button_reset.onPressed(on_pressed_reset);
   button_reset.onPressedFor(5000, on_hold_reset);
+  attachInterrupt(digitalPinToInterrupt(PIN_BTN_RESET), on_button_edge, FALLING);
   //
   device_name = F("Aion 2");
   device_type = F("Sensor Clock");
   device_version = FIRMWARE_VERSION;
   device_serial = String( ESP.getChipId() );
+  snprintf(topic_prefix, sizeof(topic_prefix), "%s/", device_serial.c_str());
   //
   lcd.init();
+  fonts.load(FONT_SMALL, AA_FONT_SMALL);
+  fonts.load(FONT_MEDIUM, AA_FONT_MEDIUM);
+  fonts.load(FONT_LARGE, AA_FONT_LARGE);
+  fonts.load(FONT_VECODE, AA_FONT_VECODE);
   lcd.fillScreen(TFT_BLACK);
   lcd.setTextColor(lcd.color565(252, 176, 64), TFT_BLACK);
-  lcd.loadFont(AA_FONT_VECODE);
+  fonts.select(FONT_VECODE);
   lcd.drawCentreString(F("vecode"), 120, 108, 2);
-  lcd.unloadFont();
   delay(1500);
   lcd.fillScreen(TFT_BLACK);
   lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-  lcd.loadFont(AA_FONT_MEDIUM);
+  fonts.select(FONT_MEDIUM);
   lcd.drawCentreString(device_name, 120, 96, 2);
-  lcd.unloadFont();
   lcd.setTextColor(lcd.color565(189, 189, 189), TFT_BLACK);
-  lcd.loadFont(AA_FONT_SMALL);
+  fonts.select(FONT_SMALL);
   lcd.drawCentreString(device_serial, 120, 128, 2);
-  lcd.unloadFont();
   delay(2000);
   //
   Serial.println("Vecode Cloud Device Firmware v" + device_version);
@@ -193,7 +320,7 @@ void setup() {
 void load_configuration(const char *filename, Config &config) {
   // Open file for reading
   File file = LittleFS.open(filename, "r");
-  StaticJsonDocument<512> doc;
+  StaticJsonDocument<CONFIG_JSON_SIZE> doc;
   DeserializationError error = deserializeJson(doc, file);
   if (error)
     Serial.println(F("Failed to read file, using default configuration"));
@@ -201,6 +328,16 @@ void load_configuration(const char *filename, Config &config) {
   config.timeOffset = doc["timeOffset"] | 0;
   config.brightness = doc["brightness"] | 8;
   config.updateInterval = doc["updateInterval"] | 60000;
+  config.sampleMin = doc["sampleMin"] | 0;
+  config.sampleMax = doc["sampleMax"] | 0;
+  config.statsInterval = doc["statsInterval"] | 0;
+  config.batchTelemetry = doc["batchTelemetry"] | false;
+  config.secondHand = doc["secondHand"] | 0;
+  config.idleSleep = doc["idleSleep"] | true;
+  for (uint8_t c = 0; c < REPORT_CHANNELS; c++) {
+    config.deadband[c] = doc["deadband"][report_names[c]] | report_bands[c];
+    config.heartbeat[c] = doc["heartbeat"][report_names[c]] | REPORT_HEARTBEAT;
+  }
   config.apiKey = doc["apiKey"] | "";
   config.apiToken = doc["apiToken"] | "";
   file.close();
@@ -215,11 +352,23 @@ void save_configuration(const char *filename, const Config &config) {
     Serial.println(F("Failed to create file"));
     return;
   }
-  StaticJsonDocument<512> doc;
+  StaticJsonDocument<CONFIG_JSON_SIZE> doc;
   // Set the values in the document
   doc["timeOffset"] = config.timeOffset;
   doc["brightness"] = config.brightness;
   doc["updateInterval"] = config.updateInterval;
+  doc["sampleMin"] = config.sampleMin;
+  doc["sampleMax"] = config.sampleMax;
+  doc["statsInterval"] = config.statsInterval;
+  doc["batchTelemetry"] = config.batchTelemetry;
+  doc["secondHand"] = config.secondHand;
+  doc["idleSleep"] = config.idleSleep;
+  JsonObject bands = doc.createNestedObject("deadband");
+  JsonObject beats = doc.createNestedObject("heartbeat");
+  for (uint8_t c = 0; c < REPORT_CHANNELS; c++) {
+    bands[report_names[c]] = round(config.deadband[c] * 1000) / 1000.0;
+    beats[report_names[c]] = config.heartbeat[c];
+  }
   doc["apiKey"] = config.apiKey;
   doc["apiToken"] = config.apiToken;
   // Serialize JSON to file
@@ -240,16 +389,16 @@ void setup_ap() {
   Serial.println(F("Successfully set to AccessPoint mode"));
   Serial.println(WiFi.softAPIP());
   server.begin();
+  scans.start();
   //
   lcd.fillScreen(TFT_BLACK);
   lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-  lcd.loadFont(AA_FONT_SMALL);
+  fonts.select(FONT_SMALL);
   lcd.drawCentreString(F("Setup mode"), 120, 90, 2);
   lcd.setTextColor(lcd.color565(34, 139, 34), TFT_BLACK);
   lcd.drawCentreString(F("Connect to DEVICE"), 120, 112, 2);
   lcd.setTextColor(lcd.color565(189, 189, 189), TFT_BLACK);
   lcd.drawCentreString(WiFi.softAPIP().toString(), 120, 150, 2);
-  lcd.unloadFont();
   //
   delay(300);
   state = STATE_SERVER;
@@ -261,9 +410,8 @@ void setup_client() {
   //
   lcd.fillScreen(TFT_BLACK);
   lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-  lcd.loadFont(AA_FONT_SMALL);
+  fonts.select(FONT_SMALL);
   lcd.drawCentreString(F("Connecting..."), 120, 112, 2);
-  lcd.unloadFont();
   //
   WiFi.mode(WIFI_STA);
   WiFi.hostname(FIRMWARE_HOSTNAME);
@@ -278,10 +426,9 @@ void setup_client() {
   }
   //
   lcd.fillScreen(TFT_BLACK);
-  lcd.loadFont(AA_FONT_SMALL);
+  fonts.select(FONT_SMALL);
   lcd.setTextColor(lcd.color565(34, 139, 34), TFT_BLACK);
   lcd.drawCentreString(F("Connected"), 120, 112, 2);
-  lcd.unloadFont();
   //
   Serial.println(F("Connected"));
   Serial.println(F("Successfully set to Client mode"));
@@ -289,13 +436,16 @@ void setup_client() {
   Serial.println(WiFi.localIP());
   delay(300);
   //
-  String ip = WiFi.localIP().toString();
+  IPAddress ip = WiFi.localIP();
+  TextBuffer<256> body;
   //
   HTTPClient http;
   http.begin(client, F("http://cloud.vecode.net/api/devices/register"));
   http.addHeader(F("Content-Type"), F("application/x-www-form-urlencoded"));
-  String postData = "uid=" + cloud_uid + "&serial=" + device_serial + "&name=" + device_name + "&type=" + device_type + "&address=" + ip;
-  int httpCode = http.POST(postData);
+  body.append("uid=").append(cloud_uid.c_str()).append("&serial=").append(device_serial.c_str())
+      .append("&name=").append(device_name.c_str()).append("&type=").append(device_type.c_str())
+      .format("&address=%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  int httpCode = http.POST((const uint8_t *)body.c_str(), body.length());
   http.end();
   if (httpCode == 200) {
     state = STATE_CLIENT;
@@ -308,66 +458,85 @@ void setup_client() {
     server.begin();
     //
     load_configuration("/config.json", config);
+    apply_sleep_mode();
+    apply_report_policy();
+    backlog.begin();
     //
     timeClient.begin();
     timeClient.setUpdateInterval(3600000);
     timeClient.setTimeOffset(config.timeOffset);
     //
-    pubsub.setServer("cloud.vecode.net", 1883);
-    pubsub.setBufferSize(255);
+    broker.begin("cloud.vecode.net", 1883);
     Serial.println(config.apiKey);
     Serial.println(config.apiToken);
-    if ( !config.apiKey.isEmpty() && !config.apiToken.isEmpty() ) {
-      Serial.println("Connecting to broker...");
-      bool ret = pubsub.connect(device_serial.c_str(), config.apiKey.c_str(), config.apiToken.c_str());
-      Serial.println(ret ? "Success!" : "Failed");
-    }
+    // The first attempt happens from loop()
+    broker.configure(device_serial, config.apiKey, config.apiToken);
     //
+    // Block once for the first reading so the screens have data
+    sampler.start();
+    while ( !sampler.update() ) delay(1);
     update_sensor_data();
-    timer_read.init(config.updateInterval);
+    apply_sampling_policy();
     timer_mode.init(30000);
+    apply_stats_policy();
+    timer_backlog.init(BACKLOG_INTERVAL);
+    timer_frame.init(clock_frame_interval());
+    // Period or timer, deadline (ms) and budget (us) of each task. Input,
+    // collect and render are only enabled while they have work to do.
+    input_task = scheduler.add("input", task_input, 0, 10, 1000);
+    scheduler.add("http", task_http, POLL_NETWORK, 20, 20000);
+    clock_task = scheduler.add("clock", task_clock, clock_poll_interval(), 10, 2000);
+    collect_task = scheduler.add("collect", task_collect, POLL_SAMPLER, 5, 2000);
+    render_task = scheduler.add("render", task_render, 0, 50, 30000);
+    scheduler.add("broker", task_broker, POLL_NETWORK, 50, 5000);
+    scheduler.add("sample", task_sample, timer_read, 100, 1000);
+    scheduler.add("rotate", task_rotate, timer_mode, 100, 1000);
+    scheduler.add("frame", task_frame, timer_frame, 20, 100);
+    scheduler.add("backlog", task_backlog, timer_backlog, 250, 20000);
+    scheduler.add("stats", task_stats, timer_stats, 1000, 20000);
     mode = MODE_CLOCK;
     update = true;
     //
     lcd.fillScreen(TFT_BLACK);
+    renderer.reset();
   } else {
     state = STATE_ERROR;
   }
 }
 
+// Sends json with a measured Content-Length, serializing it straight into the socket
+void send_json(const JsonDocument &json) {
+  ResponseBuffer<RESPONSE_BLOCK> body(server);
+  server.setContentLength(measureJson(json));
+  server.send(200, "application/json", "");
+  serializeJson(json, body);
+  body.flush();
+}
+
+// Answers from the scan cache at once. A refresh, or a list older than
+// SCAN_STALE, starts a background scan whose results show up on a later
+// request.
 void callback_xhr_scan() {
   switch( server.method() ) {
     case HTTP_GET:
     {
-      String response;
-      DynamicJsonDocument json(2048);
+      JsonDocument &json = response;
+      json.clear();
+      bool refresh = server.hasArg("refresh") && server.arg("refresh").toInt() != 0;
+      if ( refresh || !scans.valid() || scans.age() > SCAN_STALE ) scans.start();
       JsonObject data = json.createNestedObject("data");
       JsonArray networks = data.createNestedArray("networks");
-      json["result"] = "success";
-      //
-      lcd.fillScreen(TFT_BLACK);
-      lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-      lcd.loadFont(AA_FONT_SMALL);
-      lcd.drawCentreString(F("Scanning..."), 120, 112, 2);
-      lcd.unloadFont();
-      //
-      Serial.println(F("Scanning..."));
-      int n = WiFi.scanNetworks();
-      Serial.println("Scan done, found " + String(n) + " networks");
-      //
-      if (n > 0) {
-        for (int i = 0; i < n; i++) {
-          JsonObject network = networks.createNestedObject();
-          String ssid = WiFi.SSID(i);
-          network["ssid"] = ssid;
-          network["sec"] = WiFi.encryptionType(i);
-          network["str"] = WiFi.RSSI(i);
-          Serial.println(" - " + ssid);
-        }
+      for (uint8_t i = 0; i < scans.count(); i++) {
+        const ScanNetwork &scanned = scans.network(i);
+        JsonObject network = networks.createNestedObject();
+        network["ssid"] = (const char *)scanned.ssid;
+        network["sec"] = scanned.sec;
+        network["str"] = scanned.rssi;
       }
-      serializeJson(json, response);
-      //
-      server.send(200, F("application/json"), response);
+      data["scanning"] = scans.scanning();
+      if ( scans.valid() ) data["age"] = scans.age();
+      json["result"] = "success";
+      send_json(json);
       break;
     }
     default:
@@ -380,14 +549,12 @@ void callback_xhr_connect() {
   switch( server.method() ) {
     case HTTP_POST:
     {
-      String response;
-      DynamicJsonDocument json(2048);
+      StaticJsonDocument<JSON_OBJECT_SIZE(1)> json;
       //
       lcd.fillScreen(TFT_BLACK);
       lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-      lcd.loadFont(AA_FONT_SMALL);
+      fonts.select(FONT_SMALL);
       lcd.drawCentreString(F("Connecting..."), 120, 112, 2);
-      lcd.unloadFont();
       //
       String ssid = server.hasArg("ssid") ? server.arg("ssid") : "";
       String password = server.hasArg("password") ? server.arg("password") : "";
@@ -400,15 +567,12 @@ void callback_xhr_connect() {
       } else {
         json["result"] = F("error");
       }
-      serializeJson(json, response);
-      //
-      server.send(200, F("application/json"), response);
+      send_json(json);
       //
       lcd.fillScreen(TFT_BLACK);
       lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-      lcd.loadFont(AA_FONT_SMALL);
+      fonts.select(FONT_SMALL);
       lcd.drawCentreString(F("Restarting..."), 120, 112, 2);
-      lcd.unloadFont();
       //
       is_reset = true;
       Serial.println(F("Restarting..."));
@@ -428,12 +592,9 @@ void callback_xhr_ping() {
     {
       String key = server.hasArg("key") ? server.arg("key") : "";
       if (key == device_serial) {
-        String response;
-        DynamicJsonDocument json(1024);
+        StaticJsonDocument<JSON_OBJECT_SIZE(1)> json;
         json["result"] = F("success");
-        serializeJson(json, response);
-        //
-        server.send(200, F("application/json"), response);
+        send_json(json);
       } else {
         server.send(403);
       }
@@ -451,18 +612,14 @@ void callback_xhr_reset() {
     {
       String key = server.hasArg("key") ? server.arg("key") : "";
       if (key == device_serial) {
-        String response;
-        DynamicJsonDocument json(1024);
+        StaticJsonDocument<JSON_OBJECT_SIZE(1)> json;
         json["result"] = F("success");
-        serializeJson(json, response);
-        //
-        server.send(200, F("application/json"), response);
+        send_json(json);
         //
         lcd.fillScreen(TFT_BLACK);
         lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-        lcd.loadFont(AA_FONT_SMALL);
+        fonts.select(FONT_SMALL);
         lcd.drawCentreString(F("Restarting..."), 120, 112, 2);
-        lcd.unloadFont();
         //
         is_reset = true;
         Serial.println(F("Restarting..."));
@@ -482,15 +639,15 @@ void callback_xhr_reset() {
 void callback_xhr_rpc() {
   String key = server.hasArg("key") ? server.arg("key") : "";
   String cmd = server.hasArg("cmd") ? server.arg("cmd") : "";
-  String response;
-  DynamicJsonDocument json(1024);
+  JsonDocument &json = response;
+  json.clear();
   if (key == device_serial) {
     switch( server.method() ) {
       case HTTP_GET:
         json["result"] = F("error");
         if (cmd == "CFG") {
           File file = LittleFS.open("/config.json", "r");
-          StaticJsonDocument<512> doc;
+          StaticJsonDocument<CONFIG_JSON_SIZE> doc;
           DeserializationError error = deserializeJson(doc, file);
           if (error) {
             Serial.println(F("Failed to read file"));
@@ -509,11 +666,26 @@ void callback_xhr_rpc() {
           data["pressure"] = pressure;
           data["altitude"] = altitude;
           data["humidity"] = humidity;
+          data["interval"] = sampling.interval();
+          data["activity"] = round(sampling.activity() * 100) / 100.0;
+          json["result"] = F("success");
+        } else if (cmd == "STATS") {
+          JsonObject data = json.createNestedObject("data");
+          fill_stats(data);
+          json["result"] = F("success");
+        } else if (cmd == "TASKS") {
+          JsonObject data = json.createNestedObject("data");
+          fill_tasks(data);
+          json["result"] = F("success");
+        } else if (cmd == "HISTORY") {
+          JsonObject data = json.createNestedObject("data");
+          uint32_t from = server.hasArg("from") ? server.arg("from").toInt() : 0;
+          uint32_t to = server.hasArg("to") ? server.arg("to").toInt() : 0xFFFFFFFF;
+          uint32_t step = server.hasArg("step") ? server.arg("step").toInt() : 60;
+          fill_history(data, from, to, step);
           json["result"] = F("success");
         }
-        serializeJson(json, response);
-        //
-        server.send(200, F("application/json"), response);
+        send_json(json);
         break;
       case HTTP_POST:
         json["result"] = F("error");
@@ -521,19 +693,45 @@ void callback_xhr_rpc() {
           String timeOffset = server.hasArg("timeOffset") ? server.arg("timeOffset") : "";
           String brightness = server.hasArg("brightness") ? server.arg("brightness") : "";
           String updateInterval = server.hasArg("updateInterval") ? server.arg("updateInterval") : "";
+          String sampleMin = server.hasArg("sampleMin") ? server.arg("sampleMin") : "";
+          String sampleMax = server.hasArg("sampleMax") ? server.arg("sampleMax") : "";
+          String statsInterval = server.hasArg("statsInterval") ? server.arg("statsInterval") : "";
+          String batchTelemetry = server.hasArg("batchTelemetry") ? server.arg("batchTelemetry") : "";
+          String secondHand = server.hasArg("secondHand") ? server.arg("secondHand") : "";
+          String idleSleep = server.hasArg("idleSleep") ? server.arg("idleSleep") : "";
           String apiKey = server.hasArg("apiKey") ? server.arg("apiKey") : "";
           String apiToken = server.hasArg("apiToken") ? server.arg("apiToken") : "";
           if (timeOffset.length()) config.timeOffset = timeOffset.toInt();
           if (updateInterval.length()) config.updateInterval = updateInterval.toInt();
+          if (sampleMin.length()) config.sampleMin = sampleMin.toInt();
+          if (sampleMax.length()) config.sampleMax = sampleMax.toInt();
+          if (statsInterval.length()) config.statsInterval = statsInterval.toInt();
+          if (batchTelemetry.length()) config.batchTelemetry = batchTelemetry.toInt() != 0;
+          if (secondHand.length()) config.secondHand = constrain(secondHand.toInt(), 0, CLOCK_FPS_MAX);
+          if (idleSleep.length()) config.idleSleep = idleSleep.toInt() != 0;
+          // Per channel as deadband.<name> and heartbeat.<name>
+          for (uint8_t c = 0; c < REPORT_CHANNELS; c++) {
+            TextBuffer<32> name;
+            name.append("deadband.").append(report_names[c]);
+            if (server.hasArg(name.c_str())) config.deadband[c] = max(server.arg(name.c_str()).toFloat(), 0.0f);
+            name.clear();
+            name.append("heartbeat.").append(report_names[c]);
+            if (server.hasArg(name.c_str())) config.heartbeat[c] = max(server.arg(name.c_str()).toInt(), 0L);
+          }
           if (apiKey.length()) config.apiKey = apiKey;
           if (apiToken.length()) config.apiToken = apiToken;
           //
-          if ( !pubsub.connected() && !config.apiKey.isEmpty() && !config.apiToken.isEmpty() ) {
-            pubsub.connect(device_serial.c_str(), config.apiKey.c_str(), config.apiToken.c_str());
+          if ( apiKey.length() || apiToken.length() ) {
+            broker.configure(device_serial, config.apiKey, config.apiToken);
           }
           //
           timeClient.setTimeOffset(config.timeOffset);
-          timer_read.init(config.updateInterval);
+          apply_sampling_policy();
+          apply_stats_policy();
+          timer_frame.init(clock_frame_interval());
+          scheduler.period(clock_task, clock_poll_interval());
+          apply_sleep_mode();
+          apply_report_policy();
           //
           save_configuration("/config.json", config);
           json["result"] = F("success");
@@ -543,10 +741,12 @@ void callback_xhr_rpc() {
           //timer_mode.restart();
           //update = true;
           json["result"] = F("success");
+        } else if (cmd == "STATS") {
+          profiler.reset();
+          scheduler.reset();
+          json["result"] = F("success");
         }
-        serializeJson(json, response);
-        //
-        server.send(200, F("application/json"), response);
+        send_json(json);
         break;
       default:
         server.send(405);
@@ -600,9 +800,8 @@ void on_hold_reset() {
     case MODE_REBOOT:
       lcd.fillScreen(TFT_BLACK);
       lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-      lcd.loadFont(AA_FONT_SMALL);
+      fonts.select(FONT_SMALL);
       lcd.drawCentreString(F("Rebooting..."), 120, 112, 2);
-      lcd.unloadFont();
       //
       is_reset = true;
       Serial.println(F("Rebooting..."));
@@ -613,9 +812,8 @@ void on_hold_reset() {
     case MODE_RESET:
       lcd.fillScreen(TFT_BLACK);
       lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-      lcd.loadFont(AA_FONT_SMALL);
+      fonts.select(FONT_SMALL);
       lcd.drawCentreString(F("Factory reset..."), 120, 112, 2);
-      lcd.unloadFont();
       //
       is_reset = true;
       Serial.println(F("Rebooting into config mode..."));
@@ -631,9 +829,8 @@ void on_pressed_reset() {
     case MODE_UNSET:
       lcd.fillScreen(TFT_BLACK);
       lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-      lcd.loadFont(AA_FONT_SMALL);
+      fonts.select(FONT_SMALL);
       lcd.drawCentreString(F("Rebooting..."), 120, 112, 2);
-      lcd.unloadFont();
       //
       is_reset = true;
       Serial.println(F("Rebooting..."));
@@ -650,6 +847,9 @@ void on_pressed_reset() {
       mode = MODE_PRESSURE;
     break;
     case MODE_PRESSURE:
+      mode = MODE_TREND;
+    break;
+    case MODE_TREND:
       mode = MODE_REBOOT;
     break;
     case MODE_REBOOT:
@@ -664,15 +864,29 @@ void on_pressed_reset() {
   update = true;
 }
 
+// NTPClient adds the display offset to its epoch; stored and published
+// times are UTC
+uint32_t utc_time() {
+  return timeClient.getEpochTime() - config.timeOffset;
+}
+
 void update_sensor_data() {
-  sensors_event_t humidity_evt, temp_evt;
-  aht.getEvent(&humidity_evt, &temp_evt);
-  //
-  pressure = bmp.readPressure() / 100.0F;
-  altitude = bmp.readAltitude(SEALEVELPRESSURE_HPA);
-  temp = temp_evt.temperature - 2.5;
-  humidity = humidity_evt.relative_humidity;
+  uint32_t start;
+  if ( !sampler.valid() ) {
+    Serial.println("Sensor read timed out");
+    return;
+  }
+  pressure = sampler.pressure();
+  altitude = sampler.altitude(SEALEVELPRESSURE_HPA);
+  temp = sampler.temperature() - 2.5;
+  humidity = sampler.humidity();
   heat_index = compute_heat_index(temp, humidity, false);
+  adapt_sampling();
+  if ( timeClient.isTimeSet() ) {
+    float values[HISTORY_CHANNELS] = { temp, humidity, pressure };
+    history.add(utc_time(), values);
+    if ( mode == MODE_TREND ) update = true;
+  }
   //
   Serial.println("Readings:");
   Serial.println(temp);
@@ -682,314 +896,646 @@ void update_sensor_data() {
   Serial.println(humidity);
   //
   if ( pubsub.connected() ) {
-    String topic;
-    topic = device_serial + "/temperature";
-    pubsub.publish(topic.c_str(), ((String)temp).c_str(), true);
-    topic = device_serial + "/heat_index";
-    pubsub.publish(topic.c_str(), ((String)heat_index).c_str(), true);
-    topic = device_serial + "/pressure";
-    pubsub.publish(topic.c_str(), ((String)pressure).c_str(), true);
-    topic = device_serial + "/altitude";
-    pubsub.publish(topic.c_str(), ((String)altitude).c_str(), true);
-    topic = device_serial + "/humidity";
-    pubsub.publish(topic.c_str(), ((String)humidity).c_str(), true);
+    start = Profiler::stamp();
+    publish_changes();
+    profiler.record(PROFILE_PUBLISH, start);
   } else {
     Serial.println("Not connected to broker");
+    // Kept for replay once the broker is back, unless MQTT is not set up
+    if ( broker.state() != MQTT_LINK_IDLE && timeClient.isTimeSet() ) {
+      LogSample sample = { utc_time(), temp, humidity, pressure };
+      backlog.append(sample);
+    }
   }
 }
 
-float convert_cto_f(float c) {
-  return c * 1.8 + 32;
+// Publishes the channels that left their deadband or hit their heartbeat.
+// A batched telemetry message carries every channel when any one is due.
+void publish_changes() {
+  float values[REPORT_CHANNELS] = { temp, heat_index, pressure, altitude, humidity };
+  uint32_t now = millis();
+  bool due[REPORT_CHANNELS];
+  bool any = false;
+  for (uint8_t c = 0; c < REPORT_CHANNELS; c++) {
+    due[c] = deadbands.due(c, values[c], now);
+    any = any || due[c];
+    if ( config.batchTelemetry || !due[c] ) continue;
+    if ( publish_reading(report_names[c], values[c]) ) deadbands.sent(c, values[c], now);
+  }
+  // A batch carries every channel, so only an unsent one counts as suppressed
+  if ( config.batchTelemetry && any && publish_telemetry() ) {
+    for (uint8_t c = 0; c < REPORT_CHANNELS; c++) deadbands.sent(c, values[c], now);
+    return;
+  }
+  for (uint8_t c = 0; c < REPORT_CHANNELS; c++) {
+    if ( !due[c] ) deadbands.suppress(c);
+  }
 }
 
-float convert_fto_c(float f) {
-  return (f - 32) * 0.55555;
+// Sampling runs between sampleMin and sampleMax, starting at updateInterval.
+// A bound left at 0 follows updateInterval, so changing it keeps working.
+void apply_sampling_policy() {
+  int minimum = config.sampleMin > 0 ? config.sampleMin : min(config.updateInterval, SAMPLE_MIN);
+  int maximum = config.sampleMax > 0 ? config.sampleMax : config.updateInterval;
+  sampling.configure(max(minimum, 1), max(maximum, 1), config.updateInterval);
+  timer_read.init(sampling.interval());
 }
 
-float compute_heat_index(float temperature, float percentHumidity, bool isFahrenheit) {
-  float hi;
-
-  if (!isFahrenheit)
-    temperature = convert_cto_f(temperature);
-
-  hi = 0.5 * (temperature + 61.0 + ((temperature - 68.0) * 1.2) + (percentHumidity * 0.094));
-
-  if (hi > 79) {
-    hi = -42.379 + 2.04901523 * temperature + 10.14333127 * percentHumidity +
-         -0.22475541 * temperature * percentHumidity +
-         -0.00683783 * pow(temperature, 2) +
-         -0.05481717 * pow(percentHumidity, 2) +
-         0.00122874 * pow(temperature, 2) * percentHumidity +
-         0.00085282 * temperature * pow(percentHumidity, 2) +
-         -0.00000199 * pow(temperature, 2) * pow(percentHumidity, 2);
-
-    if ((percentHumidity < 13) && (temperature >= 80.0) &&
-        (temperature <= 112.0))
-      hi -= ((13.0 - percentHumidity) * 0.25) *
-            sqrt((17.0 - abs(temperature - 95.0)) * 0.05882);
+// The measured channels, judged against their publishing deadbands
+void adapt_sampling() {
+  float values[3] = { temp, humidity, pressure };
+  float bands[3] = { config.deadband[REPORT_TEMPERATURE], config.deadband[REPORT_HUMIDITY], config.deadband[REPORT_PRESSURE] };
+  uint32_t interval = sampling.interval();
+  if ( sampling.update(values, bands, 3) != interval ) timer_read.init(sampling.interval());
+}
 
-    else if ((percentHumidity > 85.0) && (temperature >= 80.0) &&
-             (temperature <= 87.0))
-      hi += ((percentHumidity - 85.0) * 0.1) * ((87.0 - temperature) * 0.2);
+// Applies the configured deadbands; every channel is reported afresh
+void apply_report_policy() {
+  for (uint8_t c = 0; c < REPORT_CHANNELS; c++) {
+    deadbands.configure(c, config.deadband[c], config.heartbeat[c]);
   }
-
-  return isFahrenheit ? hi : convert_fto_c(hi);
+  deadbands.reset();
 }
 
-void loop() {
-  char buffer[20] = "";
-  int hh, mm, ss;
-  float sdeg, mdeg, hdeg;
-  float sx, sy, hx, hy, mx, my;
-  float x0, x1, yy0, yy1;
-  bool is_night;
-  timeClient.update();
-  button_reset.read();
-  timer_read.update();
-  timer_mode.update();
-  is_night = timeClient.getHours() <= 6 || timeClient.getHours() >= 22;
-  switch (state) {
-    case STATE_SERVER:
-      server.handleClient();
-    break;
-    case STATE_CLIENT:
-      if (update) {
-
-        lcd.fillScreen(TFT_BLACK);
-
-        float value = 0.0f;
-        uint32_t color;
-
-        switch (mode) {
-          case MODE_CLOCK:
-
-            for(int i = 0; i < 360; i += 30) {
-              sx = cos((i - 90) * 0.0174532925);
-              sy = sin((i - 90) * 0.0174532925);
-              x0 = sx * 114 + 120;
-              yy0 = sy * 114 + 120;
-              x1 = sx * 100 + 120;
-              yy1 = sy * 100 + 120;
-
-              lcd.drawLine(x0, yy0, x1, yy1, is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY);
-            }
-
-            hh = timeClient.getHours();
-            mm = timeClient.getMinutes();
-            ss = timeClient.getSeconds();
-
-            sdeg = ss * 6;                      // 0-59 -> 0-354
-            mdeg = mm * 6 + sdeg * 0.01666667;  // 0-59 -> 0-360 - includes seconds
-            hdeg = hh * 30 + mdeg * 0.0833333;  // 0-11 -> 0-360 - includes minutes and seconds
-            hx = cos((hdeg - 90) * 0.0174532925);    
-            hy = sin((hdeg - 90) * 0.0174532925);
-            mx = cos((mdeg - 90) * 0.0174532925);    
-            my = sin((mdeg - 90) * 0.0174532925);
-                  
-            lcd.drawWideLine(hx * 62 + 121, hy * 62 + 121, 121, 121, 5.0f, is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKERGREY, TFT_BLACK);
-            lcd.drawWideLine(mx * 84 + 121, my * 84 + 121, 121, 121, 3.0f, is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKERGREY, TFT_BLACK);
-
-            //
-
-            lcd.loadFont(AA_FONT_LARGE);
-
-            sprintf(buffer, "%02d:%02d", timeClient.getHours(), timeClient.getMinutes());
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE, TFT_BLACK);
-            lcd.drawCentreString(buffer, 120, 102, 2);
-
-            lcd.unloadFont();
-
-          break;
-          case MODE_TEMP:
-
-            value = ((temp + 50.0f) / 100.0f) * 360;
-
-            if (temp < 10) {
-              color = lcd.color565(72, 209, 204);
-            } else if (temp < 25) {
-              color = lcd.color565(34, 139, 34);
-            } else if (temp < 30) {
-              color = lcd.color565(218, 165, 32);
-            } else {
-              color = lcd.color565(178, 34, 34);
-            }
-
-            //
-
-            lcd.loadFont(AA_FONT_LARGE);
-
-            sprintf(buffer, "%.1fº C", temp);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE, TFT_BLACK, true);
-            lcd.drawCentreString(buffer, 120, 99, 6);
-
-            lcd.unloadFont();
-
-            //
+bool publish_reading(const char *name, float value) {
+  TextBuffer<40> topic;
+  TextBuffer<16> payload;
+  topic.append(topic_prefix).append(name);
+  payload.appendFloat(value);
+  return pubsub.publish(topic.c_str(), payload.c_str(), true);
+}
 
-            lcd.loadFont(AA_FONT_SMALL);
+// All readings in one retained message, built without touching the heap
+bool publish_telemetry() {
+  static char payload[160];
+  TextBuffer<40> topic;
+  StaticJsonDocument<JSON_OBJECT_SIZE(6)> doc;
+  topic.append(topic_prefix).append("telemetry");
+  // No timestamp until NTP has answered, rather than one from 1970
+  if ( timeClient.isTimeSet() ) doc["time"] = utc_time();
+  doc["temperature"] = round(temp * 100) / 100.0;
+  doc["heat_index"] = round(heat_index * 100) / 100.0;
+  doc["pressure"] = round(pressure * 100) / 100.0;
+  doc["altitude"] = round(altitude * 100) / 100.0;
+  doc["humidity"] = round(humidity * 100) / 100.0;
+  size_t length = serializeJson(doc, payload, sizeof(payload));
+  return pubsub.publish(topic.c_str(), (const uint8_t *)payload, length, true);
+}
 
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY, TFT_BLACK, true);
-            lcd.drawCentreString(F("Temperature"), 120, 73, 2);
+// Replays one batch of samples buffered during an outage, oldest first,
+// as rows of [time, temperature, heat_index, pressure, altitude, humidity]
+void publish_backlog() {
+  LogSample samples[BACKLOG_BATCH];
+  TextBuffer<40> topic;
+  StaticJsonDocument<JSON_ARRAY_SIZE(BACKLOG_BATCH) + BACKLOG_BATCH * JSON_ARRAY_SIZE(6)> doc;
+  size_t count = backlog.peek(samples, BACKLOG_BATCH);
+  if ( !count ) return;
+  topic.append(topic_prefix).append("backlog");
+  JsonArray rows = doc.to<JsonArray>();
+  for (size_t i = 0; i < count; i++) {
+    JsonArray row = rows.createNestedArray();
+    row.add(samples[i].time);
+    row.add(round(samples[i].temperature * 100) / 100.0);
+    row.add(round(compute_heat_index(samples[i].temperature, samples[i].humidity, false) * 100) / 100.0);
+    row.add(round(samples[i].pressure * 100) / 100.0);
+    row.add(round(Sampler::altitude(samples[i].pressure, SEALEVELPRESSURE_HPA) * 100) / 100.0);
+    row.add(round(samples[i].humidity * 100) / 100.0);
+  }
+  size_t length = serializeJson(doc, reply, sizeof(reply));
+  if ( pubsub.publish(topic.c_str(), (const uint8_t *)reply, length) ) {
+    backlog.consume(count);
+  }
+}
 
-            sprintf(buffer, "Feels like %.0fº C", heat_index);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : color, TFT_BLACK, true);
-            lcd.drawCentreString(buffer, 120, 150, 2);
+// Build with -DHEAT_INDEX_REFERENCE for the original double-precision maths
+float compute_heat_index(float temperature, float percentHumidity, bool isFahrenheit) {
+#ifdef HEAT_INDEX_REFERENCE
+  return HeatIndex::reference(temperature, percentHumidity, isFahrenheit);
+#else
+  return HeatIndex::compute(temperature, percentHumidity, isFahrenheit);
+#endif
+}
 
-            lcd.unloadFont();
+void stage_text(uint8_t slot, uint8_t font, const char *text, int y, uint16_t color) {
+  if ( renderer.stage(slot, Renderer::hash(text, Renderer::hash(((uint32_t)y << 16) | color))) ) {
+    fonts.select(font);
+    int16_t width = lcd.textWidth(text);
+    renderer.place(slot, Region::box(118 - width / 2, y - 2, width + 4, lcd.fontHeight() + 4));
+  }
+}
 
-            //
+void draw_text(uint8_t slot, uint8_t font, const char *text, int y, uint16_t color, bool fill) {
+  if ( renderer.dirty(slot) ) {
+    fonts.select(font);
+    lcd.setTextColor(color, TFT_BLACK, fill);
+    lcd.drawCentreString(text, 120, y, 2);
+  }
+}
 
-            lcd.drawSmoothArc(120, 120, 115, 100, 0, 360, is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY, TFT_BLACK);
-            lcd.drawSmoothArc(120, 120, 110, 105, 0, value, is_night ? TFT_NIGHTR_RED_DARK : color, TFT_DARKESTGREY, true);
+// Amber dot while the broker is configured but unreachable
+void stage_status(bool is_night) {
+  uint16_t color = is_night ? TFT_NIGHTR_RED_DARK : lcd.color565(218, 165, 32);
+  if ( broker.state() != MQTT_LINK_BACKOFF ) return;
+  if ( renderer.stage(SLOT_STATUS, Renderer::hash("broker", color)) ) {
+    renderer.place(SLOT_STATUS, Region::box(115, 185, 11, 11));
+  }
+}
 
-          break;
-          case MODE_HUMIDITY:
+void draw_status(bool is_night) {
+  uint16_t color = is_night ? TFT_NIGHTR_RED_DARK : lcd.color565(218, 165, 32);
+  if ( renderer.dirty(SLOT_STATUS) ) {
+    lcd.fillSmoothCircle(120, 190, 4, color, TFT_BLACK);
+  }
+}
 
-            value = (humidity / 100.0f) * 360;
+// Redraw period of the clock face: once a second, or the second hand rate
+uint32_t clock_frame_interval() {
+  return config.secondHand > 0 ? 1000 / config.secondHand : 1000;
+}
 
-            // Td = T - ((100 - RH)/5.)
+// The sweep needs the start of each second to within a frame or so
+uint32_t clock_poll_interval() {
+  return config.secondHand > 1 ? POLL_SWEEP : POLL_NETWORK;
+}
 
-            if (humidity < 30) {
-              color = lcd.color565(255, 87, 34);
-            } else if (humidity < 60) {
-              color = lcd.color565(139, 195, 74);
-            } else {
-              color = lcd.color565(38, 198, 218);
-            }
+void render_clock(bool is_night) {
+  char buffer[20] = "";
+  int hh, mm, ss;
+  int32_t mdeg, hdeg, sdeg;
+  int16_t hx, hy, mx, my, sx, sy, tx, ty;
+  uint16_t ticks = is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY;
+  uint16_t hands = is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKERGREY;
+  uint16_t text = is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE;
+  uint16_t second = is_night ? TFT_NIGHTR_RED_DARK : lcd.color565(178, 34, 34);
+
+  hh = timeClient.getHours();
+  mm = timeClient.getMinutes();
+  ss = timeClient.getSeconds();
+
+  // Tenths of a degree
+  mdeg = mm * 60 + ss;                    // 0-59 -> 0-3599 - includes seconds
+  hdeg = (hh % 12) * 300 + mdeg / 12;     // 0-11 -> 0-3599 - includes minutes and seconds
+  ClockGeometry::point(hdeg, 62, 121, 121, hx, hy);
+  ClockGeometry::point(mdeg, 84, 121, 121, mx, my);
+  // Sweeps between whole seconds when drawn more than once a second
+  sdeg = ss * 60;
+  if ( config.secondHand > 1 ) sdeg += min(millis() - second_start, 999UL) * 60 / 1000;
+  ClockGeometry::point(sdeg, 92, 121, 121, sx, sy);
+  ClockGeometry::point(sdeg + CLOCK_TURN / 2, 16, 121, 121, tx, ty);
+
+  sprintf(buffer, "%02d:%02d", hh, mm);
+
+  renderer.begin();
+  if ( renderer.stage(SLOT_RING, Renderer::hash("ticks", ticks)) ) {
+    renderer.place(SLOT_RING, Region::ring(120, 120, 115, 99));
+  }
+  if ( renderer.stage(SLOT_HOUR, Renderer::hash(((uint32_t)hx << 16) | (uint16_t)hy, hands)) ) {
+    renderer.place(SLOT_HOUR, Region::line(hx, hy, 121, 121, 5));
+  }
+  if ( renderer.stage(SLOT_MINUTE, Renderer::hash(((uint32_t)mx << 16) | (uint16_t)my, hands)) ) {
+    renderer.place(SLOT_MINUTE, Region::line(mx, my, 121, 121, 3));
+  }
+  stage_text(SLOT_VALUE, FONT_LARGE, buffer, 102, text);
+  if ( config.secondHand && renderer.stage(SLOT_SECOND, Renderer::hash(((uint32_t)tx << 16) | (uint16_t)ty, Renderer::hash(((uint32_t)sx << 16) | (uint16_t)sy, second))) ) {
+    renderer.place(SLOT_SECOND, Region::line(sx, sy, tx, ty, 2));
+  }
+  stage_status(is_night);
+  renderer.commit();
 
-            //
+  if ( renderer.dirty(SLOT_RING) ) {
+    for(int i = 0; i < CLOCK_TICKS; i++) {
+      const Segment &tick = face.tick(i);
+      lcd.drawLine(tick.x0, tick.y0, tick.x1, tick.y1, ticks);
+    }
+  }
+  if ( renderer.dirty(SLOT_HOUR) ) {
+    lcd.drawWideLine(hx, hy, 121, 121, 5.0f, hands, TFT_BLACK);
+  }
+  if ( renderer.dirty(SLOT_MINUTE) ) {
+    lcd.drawWideLine(mx, my, 121, 121, 3.0f, hands, TFT_BLACK);
+  }
+  if ( renderer.dirty(SLOT_VALUE) && !digits.drawCentre(buffer, 120, 102, is_night ? clock_digits_night : clock_digits_day) ) {
+    draw_text(SLOT_VALUE, FONT_LARGE, buffer, 102, text, false);
+  }
+  if ( renderer.dirty(SLOT_SECOND) ) {
+    lcd.drawWideLine(sx, sy, tx, ty, 1.5f, second, TFT_BLACK);
+  }
+  draw_status(is_night);
+}
 
-            lcd.loadFont(AA_FONT_LARGE);
+void render_gauge(const char *label, const char *value, const char *caption, float sweep, uint16_t color, bool is_night) {
+  uint16_t track = is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY;
+  uint16_t arc = is_night ? TFT_NIGHTR_RED_DARK : color;
+  uint16_t text = is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE;
+  uint16_t dim = is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY;
+  uint32_t end = constrain(sweep, 0.0f, 360.0f);
 
-            sprintf(buffer, "%.0f%%", humidity);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE, TFT_BLACK, true);
-            lcd.drawCentreString(buffer, 120, 99, 6);
+  renderer.begin();
+  if ( renderer.stage(SLOT_RING, Renderer::hash("track", track)) ) {
+    renderer.place(SLOT_RING, Region::ring(120, 120, 115, 100), true);
+  }
+  // The arc repaints its own track, so a shorter sweep needs no erase
+  if ( renderer.stage(SLOT_ARC, Renderer::hash(end, arc)) ) {
+    renderer.place(SLOT_ARC, Region::ring(120, 120, 110, 105), true);
+  }
+  stage_text(SLOT_LABEL, FONT_SMALL, label, 73, dim);
+  stage_text(SLOT_VALUE, FONT_LARGE, value, 99, text);
+  stage_text(SLOT_CAPTION, FONT_SMALL, caption, 150, arc);
+  stage_status(is_night);
+  renderer.commit();
+
+  if ( renderer.dirty(SLOT_RING) ) {
+    lcd.drawSmoothArc(120, 120, 115, 100, 0, 360, track, TFT_BLACK);
+  }
+  if ( renderer.dirty(SLOT_ARC) ) {
+    lcd.drawSmoothArc(120, 120, 110, 105, end, 360, TFT_DARKESTGREY, TFT_DARKESTGREY);
+    lcd.drawSmoothArc(120, 120, 110, 105, 0, end, arc, TFT_DARKESTGREY, true);
+  }
+  draw_text(SLOT_LABEL, FONT_SMALL, label, 73, dim, true);
+  draw_text(SLOT_VALUE, FONT_LARGE, value, 99, text, true);
+  draw_text(SLOT_CAPTION, FONT_SMALL, caption, 150, arc, true);
+  draw_status(is_night);
+}
 
-            lcd.unloadFont();
+void render_prompt(const char *title, const char *hint, bool is_night) {
+  uint16_t text = is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE;
+  uint16_t dim = is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY;
 
-            //
+  renderer.begin();
+  stage_text(SLOT_LABEL, FONT_SMALL, hint, 96, dim);
+  stage_text(SLOT_VALUE, FONT_MEDIUM, title, 120, text);
+  stage_status(is_night);
+  renderer.commit();
 
-            lcd.loadFont(AA_FONT_SMALL);
+  draw_text(SLOT_LABEL, FONT_SMALL, hint, 96, dim, true);
+  draw_text(SLOT_VALUE, FONT_MEDIUM, title, 120, text, true);
+  draw_status(is_night);
+}
 
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY, TFT_BLACK, true);
-            lcd.drawCentreString(F("Humidty"), 120, 73, 2);
+// Mean temperature over one sparkline column, NAN if nothing was recorded
+float trend_value(uint32_t column) {
+  float low, high, mean;
+  uint32_t from = column * TREND_MINUTES * 60;
+  if ( history.summarize(from, from + TREND_MINUTES * 60 - 1, HISTORY_TEMPERATURE, low, high, mean) ) return mean;
+  return NAN;
+}
 
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : color, TFT_BLACK, true);
-            if (humidity < 30) {
-              lcd.drawCentreString("Dry", 120, 150, 2);
-            } else if (humidity < 60) {
-              lcd.drawCentreString("Comfortable", 120, 150, 2);
-            } else {
-              lcd.drawCentreString("Humid", 120, 150, 2);
-            }
+// Brings the sparkline up to the newest history minute, one column at a time
+void update_trend() {
+  uint32_t column = history.newest() / 60 / TREND_MINUTES;
+  if ( !history.newest() ) return;
+  if ( column < trend_column || column - trend_column > SPARKLINE_WIDTH ) {
+    trend.clear();
+    trend_column = column - SPARKLINE_WIDTH;
+  }
+  while ( trend_column < column ) {
+    trend_column++;
+    trend.push(trend_value(trend_column));
+  }
+  // The newest column is still filling up
+  trend.replace(trend_value(column));
+}
 
-            lcd.unloadFont();
+void render_trend(bool is_night) {
+  char label[24] = "";
+  char value[20] = "";
+  char caption[24] = "";
+  float low, high, mean;
+  uint32_t window = SPARKLINE_WIDTH * TREND_MINUTES * 60;
+  uint16_t track = is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY;
+  uint16_t line = is_night ? TFT_NIGHTR_RED_DARK : temperature_color(temp);
+  uint16_t text = is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE;
+  uint16_t dim = is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY;
+
+  update_trend();
+  sprintf(label, "Last %d hours", (int)(window / 3600));
+  sprintf(value, "%.1fº C", temp);
+  if ( history.summarize(history.newest() + 60 - window, history.newest() + 59, HISTORY_TEMPERATURE, low, high, mean) ) {
+    sprintf(caption, "%.1f - %.1fº C", low, high);
+  }
 
-            //
+  renderer.begin();
+  if ( renderer.stage(SLOT_RING, Renderer::hash("track", track)) ) {
+    renderer.place(SLOT_RING, Region::ring(120, 120, 115, 100), true);
+  }
+  if ( renderer.stage(SLOT_PLOT, Renderer::hash("trend", line)) ) {
+    renderer.place(SLOT_PLOT, Region::box(40, 100, SPARKLINE_WIDTH, 56));
+  }
+  stage_text(SLOT_LABEL, FONT_SMALL, label, 44, dim);
+  stage_text(SLOT_VALUE, FONT_MEDIUM, value, 64, text);
+  stage_text(SLOT_CAPTION, FONT_SMALL, caption, 164, line);
+  stage_status(is_night);
+  renderer.commit();
+
+  if ( renderer.dirty(SLOT_RING) ) {
+    lcd.drawSmoothArc(120, 120, 115, 100, 0, 360, track, TFT_BLACK);
+  }
+  // Only the columns that moved are repainted, unless the slot was damaged
+  trend.draw(line, TFT_BLACK, renderer.dirty(SLOT_PLOT));
+  draw_text(SLOT_LABEL, FONT_SMALL, label, 44, dim, true);
+  draw_text(SLOT_VALUE, FONT_MEDIUM, value, 64, text, true);
+  draw_text(SLOT_CAPTION, FONT_SMALL, caption, 164, line, true);
+  draw_status(is_night);
+}
 
-            lcd.drawSmoothArc(120, 120, 115, 100, 0, 360, is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY, TFT_BLACK);
-            lcd.drawSmoothArc(120, 120, 110, 105, 0, value, is_night ? TFT_NIGHTR_RED_DARK : color, TFT_DARKESTGREY, true);
+uint16_t temperature_color(float value) {
+  if (value < 10) {
+    return lcd.color565(72, 209, 204);
+  } else if (value < 25) {
+    return lcd.color565(34, 139, 34);
+  } else if (value < 30) {
+    return lcd.color565(218, 165, 32);
+  }
+  return lcd.color565(178, 34, 34);
+}
 
-          break;
-          case MODE_PRESSURE:
+void render(bool is_night) {
+  char value[20] = "";
+  char caption[24] = "";
+  uint16_t color;
+  uint32_t start = Profiler::stamp();
+  switch (mode) {
+    case MODE_CLOCK:
+      render_clock(is_night);
+    break;
+    case MODE_TEMP:
+      color = temperature_color(temp);
+      sprintf(value, "%.1fº C", temp);
+      sprintf(caption, "Feels like %.0fº C", heat_index);
+      render_gauge("Temperature", value, caption, ((temp + 50.0f) / 100.0f) * 360, color, is_night);
+    break;
+    case MODE_HUMIDITY:
+      // Td = T - ((100 - RH)/5.)
+      if (humidity < 30) {
+        color = lcd.color565(255, 87, 34);
+        strcpy(caption, "Dry");
+      } else if (humidity < 60) {
+        color = lcd.color565(139, 195, 74);
+        strcpy(caption, "Comfortable");
+      } else {
+        color = lcd.color565(38, 198, 218);
+        strcpy(caption, "Humid");
+      }
+      sprintf(value, "%.0f%%", humidity);
+      render_gauge("Humidty", value, caption, (humidity / 100.0f) * 360, color, is_night);
+    break;
+    case MODE_PRESSURE:
+      color = lcd.color565(33, 150, 243);
+      sprintf(value, "%.0f hPa", pressure);
+      sprintf(caption, "Alt. %.0f m", altitude);
+      render_gauge("Pressure", value, caption, ((pressure - 400) / 600.0f) * 360, color, is_night);
+    break;
+    case MODE_REBOOT:
+      render_prompt("Reboot", "Hold button to reboot", is_night);
+    break;
+    case MODE_RESET:
+      render_prompt("Reset", "Hold button to reset", is_night);
+    break;
+    case MODE_TREND:
+      render_trend(is_night);
+    break;
+  }
+  if ( mode <= MODE_PRESSURE ) {
+    profiler.record(PROFILE_RENDER_CLOCK + mode, start);
+  } else {
+    profiler.record(mode == MODE_TREND ? PROFILE_RENDER_TREND : PROFILE_RENDER_PROMPT, start);
+  }
+}
 
-            value = ((pressure - 400) / 600.0f) * 360;
-            color = lcd.color565(33, 150, 243);
+void fill_stats(JsonObject data) {
+  for (uint8_t i = 0; i < profiler.sections(); i++) {
+    if ( !profiler.count(i) ) continue;
+    JsonObject section = data.createNestedObject(profiler.name(i));
+    section["count"] = profiler.count(i);
+    section["min"] = profiler.shortest(i);
+    section["avg"] = profiler.average(i);
+    section["max"] = profiler.longest(i);
+    section["p99"] = profiler.percentile(i, 99);
+  }
+  JsonObject heap = data.createNestedObject("heap");
+  heap["free"] = ESP.getFreeHeap();
+  heap["low"] = heap_low;
+  heap["block"] = ESP.getMaxFreeBlockSize();
+  heap["frag"] = ESP.getHeapFragmentation();
+  JsonObject buffered = data.createNestedObject("backlog");
+  buffered["pending"] = backlog.pending();
+  buffered["dropped"] = backlog.dropped();
+  JsonObject report = data.createNestedObject("report");
+  report["sent"] = deadbands.reported();
+  report["suppressed"] = deadbands.suppressed();
+}
 
-            //
+// Per-task CPU accounting: busy time in ms, longest run in us
+void fill_tasks(JsonObject data) {
+  data["uptime"] = millis();
+  for (uint8_t i = 0; i < scheduler.tasks(); i++) {
+    JsonObject task = data.createNestedObject(scheduler.name(i));
+    task["runs"] = scheduler.runs(i);
+    task["busy"] = (uint32_t)(scheduler.busy(i) / 1000);
+    task["max"] = scheduler.longest(i);
+    task["late"] = scheduler.late(i);
+    task["over"] = scheduler.overruns(i);
+  }
+}
 
-            lcd.loadFont(AA_FONT_LARGE);
+// Readings between from and to (UTC seconds), averaged over step seconds.
+// At most HISTORY_PAGE points are returned; "next" is where to resume.
+void fill_history(JsonObject data, uint32_t from, uint32_t to, uint32_t step) {
+  uint32_t time;
+  float low, high, mean;
+  uint8_t count = 0;
+  step = max((step + 59) / 60, 1U) * 60;
+  from = max(from, history.oldest()) / 60 * 60;
+  to = min(to, history.newest() + 59);
+  data["step"] = step;
+  JsonArray fields = data.createNestedArray("fields");
+  JsonArray points = data.createNestedArray("points");
+  JsonObject summary = data.createNestedObject("summary");
+  fields.add("time");
+  for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+    fields.add(History::name(c));
+    if ( history.summarize(from, to, c, low, high, mean) ) {
+      JsonObject channel = summary.createNestedObject(History::name(c));
+      channel["min"] = round(low * 100) / 100.0;
+      channel["max"] = round(high * 100) / 100.0;
+      channel["avg"] = round(mean * 100) / 100.0;
+    }
+  }
+  if ( !history.newest() ) return;
+  for (time = from; time <= to && count < HISTORY_PAGE; time += step) {
+    JsonArray point;
+    for (uint8_t c = 0; c < HISTORY_CHANNELS; c++) {
+      bool found = history.summarize(time, min(time + step - 1, to), c, low, high, mean);
+      if ( !found && point.isNull() ) continue;
+      if ( point.isNull() ) {
+        point = points.createNestedArray();
+        point.add(time);
+        for (uint8_t skipped = 0; skipped < c; skipped++) point.add((const char *)NULL);
+      }
+      if ( found ) {
+        point.add(round(mean * 100) / 100.0);
+      } else {
+        point.add((const char *)NULL);
+      }
+    }
+    if ( !point.isNull() ) count++;
+  }
+  if ( time <= to ) data["next"] = time;
+}
 
-            sprintf(buffer, "%.0f hPa", pressure);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE, TFT_BLACK, true);
-            lcd.drawCentreString(buffer, 120, 99, 6);
+// The packet buffer only grows while stats are on, since a report does
+// not fit the default one
+void apply_stats_policy() {
+  pubsub.setBufferSize(config.statsInterval ? MQTT_BUFFER_STATS : MQTT_BUFFER);
+  timer_stats.init(config.statsInterval);
+}
 
-            lcd.unloadFont();
+void publish_stats() {
+  if ( pubsub.connected() ) {
+    TextBuffer<40> topic;
+    topic.append(topic_prefix).append("stats");
+    fill_stats(response.to<JsonObject>());
+    size_t length = serializeJson(response, reply, sizeof(reply));
+    if ( !pubsub.publish(topic.c_str(), (const uint8_t *)reply, length) ) {
+      Serial.println(F("Failed to publish stats"));
+    }
+  }
+}
 
-            //
+void task_input() {
+  button_reset.read();
+  if ( !button_reset.isPressed() ) button_woken = false;
+}
 
-            lcd.loadFont(AA_FONT_SMALL);
+void task_http() {
+  uint32_t start = Profiler::stamp();
+  server.handleClient();
+  profiler.record(PROFILE_HTTP, start);
+}
 
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY, TFT_BLACK, true);
-            lcd.drawCentreString(F("Pressure"), 120, 73, 2);
+void task_clock() {
+  timeClient.update();
+  if ( timeClient.getSeconds() != second_last ) {
+    second_last = timeClient.getSeconds();
+    second_start = millis();
+  }
+}
 
-            sprintf(buffer, "Alt. %.0f m", altitude);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : color, TFT_BLACK, true);
-            lcd.drawCentreString(buffer, 120, 150, 2);
+void task_collect() {
+  uint32_t start = Profiler::stamp();
+  if ( sampler.update() ) {
+    profiler.record(PROFILE_SENSORS, start);
+    update_sensor_data();
+  }
+  if ( sampler.state() != SAMPLER_CONVERTING ) scheduler.enable(collect_task, false);
+}
 
-            lcd.unloadFont();
+void task_render() {
+  bool is_night;
+  if (update) {
+    is_night = timeClient.getHours() <= 6 || timeClient.getHours() >= 22;
+    render(is_night);
+    update = false;
+  }
+}
 
-            //
+void task_broker() {
+  uint32_t start = Profiler::stamp();
+  if ( broker.update() ) {
+    profiler.record(PROFILE_CONNECT, start);
+  }
+  if ( broker.state() != broker_state ) {
+    broker_state = broker.state();
+    // Each new session starts with a full report
+    if ( broker_state == MQTT_LINK_UP ) deadbands.reset();
+    Serial.println(broker_state == MQTT_LINK_UP ? "Connected to broker" : "Broker unreachable");
+    update = true;
+  }
+  pubsub.loop();
+}
 
-            lcd.drawSmoothArc(120, 120, 115, 100, 0, 360, is_night ? TFT_NIGHTR_RED_DARKER : TFT_DARKESTGREY, TFT_BLACK);
-            lcd.drawSmoothArc(120, 120, 110, 105, 0, value, is_night ? TFT_NIGHTR_RED_DARK : color, TFT_DARKESTGREY, true);
+void task_sample() {
+  sampler.start();
+  scheduler.enable(collect_task, true);
+}
 
-          break;
-          case MODE_REBOOT:
-          
-            lcd.loadFont(AA_FONT_MEDIUM);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE, TFT_BLACK, true);
-            lcd.drawCentreString(F("Reboot"), 120, 120, 6);
-            lcd.unloadFont();
+void task_rotate() {
+  switch (mode) {
+    case MODE_CLOCK:
+      mode = MODE_TEMP;
+    break;
+    case MODE_TEMP:
+      mode = MODE_HUMIDITY;
+    break;
+    case MODE_HUMIDITY:
+      mode = MODE_PRESSURE;
+    break;
+    case MODE_PRESSURE:
+      mode = MODE_TREND;
+    break;
+    case MODE_TREND:
+      mode = MODE_CLOCK;
+    break;
+  }
+  Serial.println("Change");
+  update = true;
+}
 
-            //
+void task_frame() {
+  if ( mode == MODE_CLOCK ) update = true;
+}
 
-            lcd.loadFont(AA_FONT_SMALL);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY, TFT_BLACK, true);
-            lcd.drawCentreString(F("Hold button to reboot"), 120, 96, 2);
-            lcd.unloadFont();
+void task_backlog() {
+  uint32_t start = Profiler::stamp();
+  if ( pubsub.connected() && backlog.pending() ) {
+    publish_backlog();
+    profiler.record(PROFILE_PUBLISH, start);
+  }
+}
 
-          break;
-          case MODE_RESET:
-          
-            lcd.loadFont(AA_FONT_MEDIUM);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_LIGHT : TFT_WHITE, TFT_BLACK, true);
-            lcd.drawCentreString(F("Reset"), 120, 120, 6);
-            lcd.unloadFont();
+void task_stats() {
+  publish_stats();
+}
 
-            //
+// A press pulls the pin low, which also wakes the chip from light sleep
+IRAM_ATTR void on_button_edge() {
+  button_woken = true;
+  esp_schedule();
+}
 
-            lcd.loadFont(AA_FONT_SMALL);
-            lcd.setTextColor(is_night ? TFT_NIGHTR_RED_DARK : TFT_DARKGREY, TFT_BLACK, true);
-            lcd.drawCentreString(F("Hold button to reset"), 120, 96, 2);
-            lcd.unloadFont();
+// With WIFI_LIGHT_SLEEP the SDK powers down the radio and CPU whenever
+// the loop task is suspended in esp_delay() for long enough
+void apply_sleep_mode() {
+  WiFi.setSleepMode(config.idleSleep ? WIFI_LIGHT_SLEEP : WIFI_MODEM_SLEEP);
+}
 
-          break;
-        }
+// Naps until the next task is due, or until the button is pressed. The
+// wake-up turns the button interrupt level-triggered, so it is armed only
+// for the nap and the edge interrupt is restored afterwards.
+void idle_sleep() {
+  uint32_t wait = scheduler.idle();
+  if ( wait < IDLE_NAP_MIN || button_reset.isPressed() ) return;
+  gpio_pin_wakeup_enable(GPIO_ID_PIN(PIN_BTN_RESET), GPIO_PIN_INTR_LOLEVEL);
+  esp_delay(wait, []() { return !button_woken; });
+  gpio_pin_wakeup_disable();
+  attachInterrupt(digitalPinToInterrupt(PIN_BTN_RESET), on_button_edge, FALLING);
+}
 
-        update = false;
-      }
-      if ( !pubsub.connected() && !config.apiKey.isEmpty() && !config.apiToken.isEmpty() ) {
-        pubsub.connect(device_serial.c_str(), config.apiKey.c_str(), config.apiToken.c_str());
-      }
-      pubsub.loop();
+void loop() {
+  uint32_t start = Profiler::stamp();
+  bool busy = true;
+  if ( state == STATE_CLIENT ) {
+    scheduler.enable(input_task, button_woken || button_reset.isPressed());
+    scheduler.enable(render_task, update);
+    busy = scheduler.run();
+  } else {
+    button_reset.read();
+    if ( state == STATE_SERVER ) {
+      if ( scans.poll() ) Serial.printf("Scan done, found %d networks\n", scans.count());
       server.handleClient();
-    break;
-    default:
-      //
-    break;
-  }
-  if ( timer_mode.hasFinished() ) {
-    switch (mode) {
-      case MODE_CLOCK:
-        mode = MODE_TEMP;
-      break;
-      case MODE_TEMP:
-        mode = MODE_HUMIDITY;
-      break;
-      case MODE_HUMIDITY:
-        mode = MODE_PRESSURE;
-      break;
-      case MODE_PRESSURE:
-        mode = MODE_CLOCK;
-      break;
     }
-    timer_mode.restart();
-    Serial.println("Change");
-    update = true;
-  }
-  if ( timer_read.hasFinished() ) {
-    update_sensor_data();
-    timer_read.restart();
   }
+  heap_low = min(heap_low, ESP.getFreeHeap());
+  profiler.record(PROFILE_LOOP, start);
+  if ( !busy && config.idleSleep ) idle_sleep();
 }
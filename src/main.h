@@ -2,10 +2,12 @@
 #define MAIN_h
 
 #include <Arduino.h>
+#include <ArduinoJson.h>
 
 void setup();
 void setup_ap();
 void setup_client();
+void send_json(const JsonDocument &json);
 void callback_xhr_scan();
 void callback_xhr_connect();
 void callback_xhr_ping();
@@ -16,10 +18,49 @@ void write_eeprom(String ssid, String password, String cloud_uid);
 void clear_eeprom();
 void on_hold_reset();
 void on_pressed_reset();
+uint32_t utc_time();
 void update_sensor_data();
-float convert_cto_f(float c);
-float convert_fto_c(float f);
+void publish_changes();
+void apply_report_policy();
+void apply_sampling_policy();
+void adapt_sampling();
+bool publish_reading(const char *name, float value);
+bool publish_telemetry();
+void publish_backlog();
 float compute_heat_index(float temperature, float percentHumidity, bool isFahrenheit);
+void stage_text(uint8_t slot, uint8_t font, const char *text, int y, uint16_t color);
+void draw_text(uint8_t slot, uint8_t font, const char *text, int y, uint16_t color, bool fill);
+void stage_status(bool is_night);
+void draw_status(bool is_night);
+uint32_t clock_frame_interval();
+uint32_t clock_poll_interval();
+void render_clock(bool is_night);
+void render_gauge(const char *label, const char *value, const char *caption, float sweep, uint16_t color, bool is_night);
+void render_prompt(const char *title, const char *hint, bool is_night);
+float trend_value(uint32_t column);
+void update_trend();
+void render_trend(bool is_night);
+uint16_t temperature_color(float value);
+void render(bool is_night);
+void fill_stats(JsonObject data);
+void fill_history(JsonObject data, uint32_t from, uint32_t to, uint32_t step);
+void apply_stats_policy();
+void publish_stats();
+void fill_tasks(JsonObject data);
+void task_input();
+void task_http();
+void task_clock();
+void task_collect();
+void task_render();
+void task_broker();
+void task_sample();
+void task_rotate();
+void task_frame();
+void task_backlog();
+void task_stats();
+void on_button_edge();
+void apply_sleep_mode();
+void idle_sleep();
 void loop();
 
 #endif
@@ -0,0 +1,37 @@
+// Sweeps HeatIndex::compute() against the double-precision reference
+// over the sensors' range:
+//   pio test -e native
+#include <unity.h>
+#include "HeatIndex.h"
+
+#define SWEEP_TOLERANCE 0.05f   // °C
+
+void setUp() {}
+void tearDown() {}
+
+// -40..60 °C and 0..100 %RH in 0.1 steps, counted in integer tenths so
+// the grid is exact
+void test_sweep() {
+  for (int t = -400; t <= 600; t++) {
+    for (int rh = 0; rh <= 1000; rh++) {
+      float fast = HeatIndex::compute(t / 10.0f, rh / 10.0f, false);
+      float slow = HeatIndex::reference(t / 10.0f, rh / 10.0f, false);
+      TEST_ASSERT_FLOAT_WITHIN(SWEEP_TOLERANCE, slow, fast);
+    }
+  }
+}
+
+void test_fahrenheit() {
+  TEST_ASSERT_FLOAT_WITHIN(SWEEP_TOLERANCE, HeatIndex::reference(95, 60, true), HeatIndex::compute(95, 60, true));
+  TEST_ASSERT_FLOAT_WITHIN(SWEEP_TOLERANCE, HeatIndex::compute(35, 60, false),
+                           HeatIndex::toCelsius(HeatIndex::compute(95, 60, true)));
+}
+
+int main(int argc, char **argv) {
+  (void)argc;
+  (void)argv;
+  UNITY_BEGIN();
+  RUN_TEST(test_sweep);
+  RUN_TEST(test_fahrenheit);
+  return UNITY_END();
+}
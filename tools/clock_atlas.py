@@ -0,0 +1,125 @@
+"""Pre-render the clock digits of the large font into RGB565 spans.
+
+The clock only ever draws 0-9 and ':' in NotoSansBold42, so the glyphs are
+blended here, once, against the black face in both the day and the night
+palette. Each row of a glyph becomes one or more spans of covered pixels;
+fully transparent pixels are skipped so the hands still show through.
+
+Runs as a PlatformIO pre: script (regenerating include/ClockDigits.h when
+the font is newer) or by hand:  python tools/clock_atlas.py
+"""
+import os
+import sys
+
+FONT = "fonts/NotoSans_Regular42pt7b.h"
+OUTPUT = "include/ClockDigits.h"
+CHARS = "0123456789:"
+
+BACKGROUND = 0x0000             # TFT_BLACK
+PALETTES = (
+    ("day", 0xFFFF),            # TFT_WHITE
+    ("night", 0x8000),          # TFT_NIGHTR_RED_LIGHT
+)
+
+
+def alpha_blend(alpha, fg, bg):
+    """Same integer maths as TFT_eSPI::alphaBlend(); drawGlyph() plots
+    fully covered pixels in the plain text colour."""
+    if alpha == 0xFF:
+        return fg
+    rxb = bg & 0xF81F
+    rxb += (((fg & 0xF81F) - rxb) * (alpha >> 2)) >> 6
+    xgx = bg & 0x07E0
+    xgx += (((fg & 0x07E0) - xgx) * alpha) >> 8
+    return (rxb & 0xF81F) | (xgx & 0x07E0)
+
+
+def spans(glyph):
+    for y in range(glyph.height):
+        x = 0
+        while x < glyph.width:
+            if glyph.alpha(x, y) == 0:
+                x += 1
+                continue
+            start = x
+            while x < glyph.width and glyph.alpha(x, y) and x - start < 255:
+                x += 1
+            yield y, start, x - start
+
+
+def words(values, per_line):
+    rows = []
+    for i in range(0, len(values), per_line):
+        rows.append("  " + ", ".join(values[i:i + per_line]))
+    return ",\n".join(rows)
+
+
+def generate(project_dir):
+    sys.dont_write_bytecode = True
+    sys.path.insert(0, os.path.join(project_dir, "tools"))
+    import vlw
+
+    font = vlw.read_header(os.path.join(project_dir, FONT))
+    glyphs, span_bytes = [], []
+    pixels = {name: [] for name, _ in PALETTES}
+    span_count = 0
+    for char in CHARS:
+        g = font.glyph(ord(char))
+        first_span, first_pixel = span_count, len(pixels[PALETTES[0][0]])
+        for row, x, length in spans(g):
+            span_bytes += ["%d" % row, "%d" % x, "%d" % length]
+            span_count += 1
+            for name, fg in PALETTES:
+                pixels[name] += ["0x%04X" % alpha_blend(g.alpha(x + i, row), fg, BACKGROUND) for i in range(length)]
+        glyphs.append("  { 0x%04X, %d, %d, %d, %d, %d, %d, %d },  // '%s'" % (
+            g.code, g.width, g.advance, g.dx, g.dy, first_span, span_count - first_span, first_pixel, char))
+
+    out = []
+    out.append("// Generated by tools/clock_atlas.py from %s, do not edit." % FONT)
+    out.append("#ifndef CLOCK_DIGITS_h")
+    out.append("#define CLOCK_DIGITS_h")
+    out.append("")
+    out.append('#include "GlyphAtlas.h"')
+    out.append("")
+    out.append("#define CLOCK_DIGITS_COUNT  %d" % len(CHARS))
+    out.append("#define CLOCK_DIGITS_ASCENT %d" % font.ascent)
+    out.append("")
+    out.append("const AtlasGlyph clock_digits_glyphs[] PROGMEM = {")
+    out.append("\n".join(glyphs))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t clock_digits_spans[] PROGMEM = {")
+    out.append(words(span_bytes, 24))
+    out.append("};")
+    for name, _ in PALETTES:
+        out.append("")
+        out.append("const uint16_t clock_digits_%s[] PROGMEM = {" % name)
+        out.append(words(pixels[name], 12))
+        out.append("};")
+    out.append("")
+    out.append("#endif")
+    with open(os.path.join(project_dir, OUTPUT), "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def stale(project_dir):
+    target = os.path.join(project_dir, OUTPUT)
+    if not os.path.exists(target):
+        return True
+    sources = [os.path.join(project_dir, FONT), os.path.join(project_dir, "tools", "clock_atlas.py")]
+    return any(os.path.getmtime(s) > os.path.getmtime(target) for s in sources)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+except NameError:
+    env = None
+
+if env is not None or __name__ == "__main__":
+    if env is not None:
+        PROJECT_DIR = env.subst("$PROJECT_DIR")
+    else:
+        PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    if env is None or stale(PROJECT_DIR):
+        print("Generating %s" % OUTPUT)
+        generate(PROJECT_DIR)
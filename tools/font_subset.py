@@ -0,0 +1,94 @@
+"""Cut the smooth fonts in fonts/ down to the glyphs the firmware can show.
+
+fonts/ holds the full VLW arrays as exported by the TFT_eSPI converter.
+This script gathers every string literal in src/, adds the characters
+produced at run time by number formatting, and writes a subset of each
+font to include/ under the same name. Glyph metrics and the header are
+copied verbatim, and the glyph that sets the font's max descent is always
+kept, so text is placed exactly as with the full font.
+
+Runs as a PlatformIO pre: script (only when a source is newer than its
+subset) or by hand:  python tools/font_subset.py
+"""
+import glob
+import os
+import re
+import sys
+
+# (file name, fixed charset or None to use the literals found in src/)
+FONTS = (
+    ("NotoSans_Regular16pt7b.h", None),
+    ("NotoSans_Regular24pt7b.h", None),
+    ("NotoSans_Regular42pt7b.h", None),
+    ("Sansation_Regular24.h", "vecode"),
+)
+
+# Built at run time: numbers, IP addresses, the serial number and units
+RUNTIME = "0123456789.-:%º"
+
+LITERAL_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+
+
+def literals(project_dir):
+    chars = set(RUNTIME)
+    for path in sorted(glob.glob(os.path.join(project_dir, "src", "*.*"))):
+        with open(path, encoding="utf-8") as f:
+            for text in LITERAL_RE.findall(f.read()):
+                chars.update(re.sub(r"\\.", "", text))
+    return chars
+
+
+def subset(font, chars):
+    keep = set(ord(c) for c in chars)
+    # Control and space glyphs are tiny and handled specially by TFT_eSPI
+    glyphs = [g for g in font.glyphs if g.code <= 0x20 or g.code in keep]
+    descent = font.max_descent()
+    kept = vlw.Font(font.name, font.header, glyphs, font.trailer)
+    if kept.max_descent() < descent:
+        for g in font.glyphs:
+            if g not in glyphs and ((0x20 < g.code < 0x7F) or g.code > 0xA0) and g.height - g.dy == descent:
+                glyphs.append(g)
+                break
+    font.glyphs = [g for g in font.glyphs if g in glyphs]
+    return font
+
+
+def generate(project_dir):
+    found = literals(project_dir)
+    for name, fixed in FONTS:
+        font = vlw.read_header(os.path.join(project_dir, "fonts", name))
+        total = len(font.glyphs)
+        subset(font, fixed if fixed else found)
+        banner = "// Generated by tools/font_subset.py from fonts/%s, do not edit.\n" % name
+        vlw.write_header(font, os.path.join(project_dir, "include", name), banner)
+        print("%s: %d of %d glyphs" % (name, len(font.glyphs), total))
+
+
+def stale(project_dir):
+    sources = glob.glob(os.path.join(project_dir, "src", "*.*"))
+    sources.append(os.path.join(project_dir, "tools", "font_subset.py"))
+    for name, _ in FONTS:
+        target = os.path.join(project_dir, "include", name)
+        if not os.path.exists(target):
+            return True
+        built = os.path.getmtime(target)
+        if any(os.path.getmtime(s) > built for s in sources + [os.path.join(project_dir, "fonts", name)]):
+            return True
+    return False
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+except NameError:
+    env = None
+
+if env is not None or __name__ == "__main__":
+    if env is not None:
+        PROJECT_DIR = env.subst("$PROJECT_DIR")
+    else:
+        PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    sys.dont_write_bytecode = True
+    sys.path.insert(0, os.path.join(PROJECT_DIR, "tools"))
+    import vlw
+    if env is None or stale(PROJECT_DIR):
+        generate(PROJECT_DIR)
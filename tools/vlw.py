@@ -0,0 +1,109 @@
+"""Read and write TFT_eSPI smooth font (VLW) arrays kept in C headers.
+
+A VLW blob is six big-endian int32 header fields (glyph count, version,
+point size, reserved, ascent, descent), one 28-byte record per glyph
+(unicode, height, width, xAdvance, dY, dX, padding), the 8-bit alpha
+bitmaps in record order, and a trailer holding the font names.
+"""
+import re
+import struct
+
+ARRAY_RE = re.compile(r"const\s+uint8_t\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", re.S)
+
+
+class Glyph:
+    def __init__(self, code, height, width, advance, dy, dx, bitmap):
+        self.code = code
+        self.height = height
+        self.width = width
+        self.advance = advance
+        self.dy = dy
+        self.dx = dx
+        self.bitmap = bitmap
+
+    def alpha(self, x, y):
+        return self.bitmap[y * self.width + x]
+
+
+class Font:
+    def __init__(self, name, header, glyphs, trailer, preamble=""):
+        self.name = name
+        self.header = list(header)
+        self.glyphs = glyphs
+        self.trailer = trailer
+        self.preamble = preamble
+
+    @property
+    def ascent(self):
+        return self.header[4]
+
+    @property
+    def descent(self):
+        return self.header[5]
+
+    def glyph(self, code):
+        for glyph in self.glyphs:
+            if glyph.code == code:
+                return glyph
+        return None
+
+    def max_descent(self):
+        """Mirror TFT_eSPI's loadMetrics(): yAdvance depends on this."""
+        descent = self.descent
+        for g in self.glyphs:
+            if (0x20 < g.code < 0x7F) or g.code > 0xA0:
+                descent = max(descent, g.height - g.dy)
+        return descent
+
+
+def parse(name, data, preamble=""):
+    header = struct.unpack_from(">6i", data, 0)
+    count = header[0]
+    offset = 24 + count * 28
+    glyphs = []
+    for i in range(count):
+        code, height, width, advance, dy, dx, _ = struct.unpack_from(">7i", data, 24 + i * 28)
+        size = width * height
+        glyphs.append(Glyph(code, height, width, advance, dy, dx, data[offset:offset + size]))
+        offset += size
+    return Font(name, header, glyphs, data[offset:], preamble)
+
+
+def serialize(font):
+    header = list(font.header)
+    header[0] = len(font.glyphs)
+    out = bytearray(struct.pack(">6i", *header))
+    for g in font.glyphs:
+        out += struct.pack(">7i", g.code, g.height, g.width, g.advance, g.dy, g.dx, 0)
+    for g in font.glyphs:
+        out += g.bitmap
+    out += font.trailer
+    return bytes(out)
+
+
+def read_header(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    # The converter's boilerplate comment contains a sample declaration too
+    match = None
+    for candidate in ARRAY_RE.finditer(text):
+        if "0x" in candidate.group(2):
+            match = candidate
+            break
+    if not match:
+        raise ValueError("no PROGMEM font array in %s" % path)
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", match.group(2)))
+    return parse(match.group(1), data, text[:match.start()])
+
+
+def write_header(font, path, banner=""):
+    data = serialize(font)
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(", ".join("0x%02X" % b for b in data[i:i + 16]))
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(banner)
+        f.write(font.preamble)
+        f.write("const uint8_t  %s[] PROGMEM = {\n" % font.name)
+        f.write(",\n".join(lines))
+        f.write("\n};")